@@ -0,0 +1,59 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "control-parameters-list.hpp"
+
+namespace nfd {
+
+Block
+ControlParametersList::wireEncode() const
+{
+  Block block(TLV_TYPE);
+  for (const auto& item : m_items) {
+    block.push_back(item.wireEncode());
+  }
+  block.encode();
+  return block;
+}
+
+void
+ControlParametersList::wireDecode(const Block& block)
+{
+  if (block.type() != TLV_TYPE) {
+    NDN_THROW(Error("ControlParametersList", block.type()));
+  }
+
+  std::vector<ndn::nfd::ControlParameters> items;
+  block.parse();
+  for (const auto& element : block.elements()) {
+    if (element.type() != tlv::nfd::ControlParameters) {
+      NDN_THROW(Error("ControlParameters", element.type()));
+    }
+    items.emplace_back(element);
+  }
+  m_items = std::move(items);
+}
+
+} // namespace nfd
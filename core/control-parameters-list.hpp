@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_CORE_CONTROL_PARAMETERS_LIST_HPP
+#define NFD_CORE_CONTROL_PARAMETERS_LIST_HPP
+
+#include "common.hpp"
+
+#include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
+
+namespace nfd {
+
+/**
+ * \brief A sequence of ControlParameters carried by a single control command.
+ *
+ * It is the parameters of the rib/register-batch and rib/unregister-batch commands,
+ * and is encoded as a ControlParametersList element that contains one ControlParameters
+ * element per item, in order.
+ */
+class ControlParametersList : public ndn::mgmt::ControlParameters
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  /** \brief TLV-TYPE of the ControlParametersList element.
+   *
+   *  This number is not used by the NFD Management protocol.
+   */
+  static constexpr uint32_t TLV_TYPE = 800;
+
+  ControlParametersList() = default;
+
+  explicit
+  ControlParametersList(std::vector<ndn::nfd::ControlParameters> items)
+    : m_items(std::move(items))
+  {
+  }
+
+  /** \throw Error \p block cannot be decoded
+   */
+  explicit
+  ControlParametersList(const Block& block)
+  {
+    wireDecode(block);
+  }
+
+  const std::vector<ndn::nfd::ControlParameters>&
+  getItems() const noexcept
+  {
+    return m_items;
+  }
+
+  ControlParametersList&
+  addItem(const ndn::nfd::ControlParameters& item)
+  {
+    m_items.push_back(item);
+    return *this;
+  }
+
+  Block
+  wireEncode() const final;
+
+  /** \throw Error \p block cannot be decoded
+   */
+  void
+  wireDecode(const Block& block) final;
+
+private:
+  std::vector<ndn::nfd::ControlParameters> m_items;
+};
+
+} // namespace nfd
+
+#endif // NFD_CORE_CONTROL_PARAMETERS_LIST_HPP
@@ -97,4 +97,34 @@ runOnRibIoService(const std::function<void()>& f)
   getRibIoService().post(f);
 }
 
+bool
+AliveToken::post(std::function<void()> f)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_io == nullptr) {
+    return false;
+  }
+
+  m_io->post([self = shared_from_this(), f = std::move(f)] {
+    if (self->isOpen()) {
+      f();
+    }
+  });
+  return true;
+}
+
+void
+AliveToken::close()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_io = nullptr;
+}
+
+bool
+AliveToken::isOpen() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_io != nullptr;
+}
+
 } // namespace nfd
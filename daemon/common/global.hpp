@@ -29,6 +29,8 @@
 
 #include <boost/asio/io_service.hpp>
 
+#include <mutex>
+
 namespace nfd {
 
 /** \brief Returns the global io_service instance for the calling thread.
@@ -63,6 +65,49 @@ runOnMainIoService(const std::function<void()>& f);
 void
 runOnRibIoService(const std::function<void()>& f);
 
+/** \brief Posts functions back to the thread of an object, for as long as the object is alive.
+ *
+ *  An object that hands work to another thread owns an AliveToken, created on its own thread,
+ *  and closes it when it is destroyed. The other thread posts the results back through the
+ *  token instead of capturing the object's io_service or \c this. Nothing is posted once the
+ *  token is closed, and a function that was posted earlier does not run if the token has been
+ *  closed by the time it is invoked. The token must be owned by a shared_ptr.
+ */
+class AliveToken : noncopyable, public std::enable_shared_from_this<AliveToken>
+{
+public:
+  /** \brief Creates an open token that posts to \p io.
+   */
+  explicit
+  AliveToken(boost::asio::io_service& io = getGlobalIoService())
+    : m_io(&io)
+  {
+  }
+
+  /** \brief Posts \p f to the io_service of the token, if the token is open.
+   *
+   *  This can be invoked from any thread.
+   *  \return whether \p f has been posted
+   */
+  bool
+  post(std::function<void()> f);
+
+  /** \brief Closes the token.
+   *
+   *  This must be invoked on the thread of the io_service of the token, and before that
+   *  io_service is destroyed.
+   */
+  void
+  close();
+
+  [[nodiscard]] bool
+  isOpen() const;
+
+private:
+  mutable std::mutex m_mutex;
+  boost::asio::io_service* m_io;
+};
+
 #ifdef NFD_WITH_TESTS
 /** \brief Destroy the global io_service instance.
  *
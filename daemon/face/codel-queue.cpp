@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "codel-queue.hpp"
+
+#include <cmath>
+
+namespace nfd::face {
+
+CoDelQueue::CoDelQueue(const Options& options)
+  : m_options(options)
+{
+}
+
+void
+CoDelQueue::setOptions(const Options& options)
+{
+  m_options = options;
+  if (!m_options.isCoDelEnabled) {
+    m_firstAboveTime = {};
+    m_isDropping = false;
+  }
+}
+
+bool
+CoDelQueue::push(const Block& packet)
+{
+  if (m_options.capacity > 0 && m_nBytes + packet.size() > m_options.capacity) {
+    afterDrop(packet);
+    return false;
+  }
+
+  m_queue.push({packet, time::steady_clock::now()});
+  m_nBytes += packet.size();
+  return true;
+}
+
+CoDelQueue::DequeueResult
+CoDelQueue::doDequeue(time::steady_clock::time_point now)
+{
+  DequeueResult res;
+  if (m_queue.empty()) {
+    m_firstAboveTime = {};
+    return res;
+  }
+
+  Item& item = m_queue.front();
+  auto sojournTime = now - item.enqueueTime;
+  m_nBytes -= item.packet.size();
+  res.packet = std::move(item.packet);
+  m_queue.pop();
+
+  if (!m_options.isCoDelEnabled) {
+    return res;
+  }
+
+  // the queue is not considered to be standing if less than one maximum-size packet is left
+  if (sojournTime < m_options.target || m_nBytes <= ndn::MAX_NDN_PACKET_SIZE) {
+    m_firstAboveTime = {};
+  }
+  else if (m_firstAboveTime == time::steady_clock::time_point{}) {
+    m_firstAboveTime = now + m_options.interval;
+  }
+  else if (now >= m_firstAboveTime) {
+    res.isOkToDrop = true;
+  }
+  return res;
+}
+
+std::optional<Block>
+CoDelQueue::pop()
+{
+  auto now = time::steady_clock::now();
+  auto res = doDequeue(now);
+  if (!res.packet) {
+    m_isDropping = false;
+    return std::nullopt;
+  }
+
+  if (m_isDropping) {
+    if (!res.isOkToDrop) {
+      // sojourn time fell below target, leave dropping state
+      m_isDropping = false;
+    }
+    while (m_isDropping && now >= m_dropNext) {
+      afterDrop(*res.packet);
+      ++m_count;
+      res = doDequeue(now);
+      if (!res.packet || !res.isOkToDrop) {
+        m_isDropping = false;
+      }
+      else {
+        m_dropNext = controlLaw(m_dropNext);
+      }
+    }
+  }
+  else if (res.isOkToDrop) {
+    afterDrop(*res.packet);
+    res = doDequeue(now);
+    m_isDropping = true;
+
+    // if min went above target close to when it last went below,
+    // assume that the drop rate that controlled the queue on the
+    // last cycle is a good starting point to control it now
+    size_t delta = m_count - m_lastCount;
+    if (delta > 1 && now - m_dropNext < 16 * m_options.interval) {
+      m_count = delta;
+    }
+    else {
+      m_count = 1;
+    }
+    m_dropNext = controlLaw(now);
+    m_lastCount = m_count;
+  }
+
+  return std::move(res.packet);
+}
+
+void
+CoDelQueue::clear()
+{
+  m_queue = {};
+  m_nBytes = 0;
+  m_firstAboveTime = {};
+  m_isDropping = false;
+}
+
+time::steady_clock::time_point
+CoDelQueue::controlLaw(time::steady_clock::time_point t) const
+{
+  return t + time::nanoseconds(static_cast<time::nanoseconds::rep>(
+                                 m_options.interval.count() / std::sqrt(m_count)));
+}
+
+} // namespace nfd::face
@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_CODEL_QUEUE_HPP
+#define NFD_DAEMON_FACE_CODEL_QUEUE_HPP
+
+#include "core/common.hpp"
+
+#include <queue>
+
+namespace nfd::face {
+
+/**
+ * \brief A FIFO packet queue with CoDel active queue management.
+ *
+ * Every packet is timestamped when it is pushed. When a packet is popped, its sojourn time
+ * is compared against Options::target; once the sojourn time has stayed above target for at
+ * least one Options::interval, the queue enters the dropping state and drops packets from the
+ * head at a rate that grows with the square root of the number of drops, until the sojourn
+ * time falls below target again.
+ *
+ * Independently of CoDel, the queue can enforce a hard capacity in octets, in which case
+ * packets that do not fit are dropped on arrival.
+ *
+ * \sa https://tools.ietf.org/html/rfc8289
+ */
+class CoDelQueue : noncopyable
+{
+public:
+  /** \brief %Options that control the behavior of CoDelQueue.
+   */
+  struct Options
+  {
+    /** \brief Enables CoDel dropping.
+     *
+     *  If false, the queue behaves as a plain FIFO, subject only to #capacity.
+     */
+    bool isCoDelEnabled = false;
+
+    /** \brief Acceptable standing queue delay.
+     *
+     *  The default value (5 ms) is taken from RFC 8289.
+     */
+    time::nanoseconds target = 5_ms;
+
+    /** \brief Sliding window over which the minimum sojourn time is evaluated.
+     *
+     *  The default value (100 ms) is taken from RFC 8289.
+     */
+    time::nanoseconds interval = 100_ms;
+
+    /** \brief Maximum number of octets held in the queue; zero means unlimited.
+     */
+    size_t capacity = 0;
+  };
+
+  explicit
+  CoDelQueue(const Options& options);
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+  /** \brief Set options for the queue.
+   *
+   *  The new capacity applies to subsequent push() operations only; packets already queued
+   *  are not dropped.
+   */
+  void
+  setOptions(const Options& options);
+
+  /** \brief Appends a packet to the tail of the queue.
+   *  \retval false the packet was dropped because the queue is full
+   */
+  bool
+  push(const Block& packet);
+
+  /** \brief Removes the next packet to be transmitted from the head of the queue.
+   *
+   *  Packets dropped by CoDel while looking for the next packet are reported via #afterDrop.
+   *
+   *  \return the packet, or std::nullopt if no packets are left in the queue
+   */
+  std::optional<Block>
+  pop();
+
+  /** \brief Drops all queued packets and resets the CoDel state.
+   *
+   *  #afterDrop is not emitted for packets removed in this way.
+   */
+  void
+  clear();
+
+  bool
+  empty() const
+  {
+    return m_queue.empty();
+  }
+
+  /** \brief Returns the number of packets in the queue.
+   */
+  size_t
+  size() const
+  {
+    return m_queue.size();
+  }
+
+  /** \brief Returns the total size of the packets in the queue, in octets.
+   */
+  size_t
+  getBytes() const
+  {
+    return m_nBytes;
+  }
+
+  /** \brief Returns whether the queue is currently in the CoDel dropping state.
+   */
+  bool
+  isDropping() const
+  {
+    return m_isDropping;
+  }
+
+  /** \brief Signals when a packet is dropped, either on push() due to a full queue
+   *         or on pop() by the CoDel algorithm.
+   */
+  signal::Signal<CoDelQueue, Block> afterDrop;
+
+private:
+  struct DequeueResult
+  {
+    std::optional<Block> packet;
+    bool isOkToDrop = false;
+  };
+
+  DequeueResult
+  doDequeue(time::steady_clock::time_point now);
+
+  time::steady_clock::time_point
+  controlLaw(time::steady_clock::time_point t) const;
+
+private:
+  struct Item
+  {
+    Block packet;
+    time::steady_clock::time_point enqueueTime;
+  };
+
+  Options m_options;
+  std::queue<Item> m_queue;
+  size_t m_nBytes = 0;
+
+  /// time when the sojourn time will have been above target for one interval, if not cleared
+  time::steady_clock::time_point m_firstAboveTime;
+  /// time to drop next packet while in dropping state
+  time::steady_clock::time_point m_dropNext;
+  /// number of packets dropped since entering the dropping state
+  size_t m_count = 0;
+  /// value of m_count when the dropping state was last exited
+  size_t m_lastCount = 0;
+  bool m_isDropping = false;
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_CODEL_QUEUE_HPP
@@ -88,6 +88,14 @@ protected:
   void
   resetRecentlyReceived();
 
+public:
+  /** \brief Maximum number of datagrams processed per receive completion.
+   *
+   *  After an asynchronous receive completes, datagrams already waiting in the socket buffer
+   *  are read synchronously, saving a round trip through the event loop for each of them.
+   */
+  static constexpr size_t MAX_RECEIVE_BATCH = 32;
+
 protected:
   typename protocol::socket m_socket;
   typename protocol::endpoint m_sender;
@@ -202,6 +210,18 @@ DatagramTransport<T, U>::handleReceive(const boost::system::error_code& error, s
 {
   receiveDatagram(ndn::make_span(m_receiveBuffer).first(nBytesReceived), error);
 
+  for (size_t i = 1; !error && i < MAX_RECEIVE_BATCH && m_socket.is_open(); ++i) {
+    // available() returns the size of the next datagram, so a read cannot block
+    boost::system::error_code ec;
+    if (m_socket.available(ec) == 0 || ec)
+      break;
+
+    nBytesReceived = m_socket.receive_from(boost::asio::buffer(m_receiveBuffer), m_sender, 0, ec);
+    receiveDatagram(ndn::make_span(m_receiveBuffer).first(nBytesReceived), ec);
+    if (ec)
+      break;
+  }
+
   if (m_socket.is_open())
     m_socket.async_receive_from(boost::asio::buffer(m_receiveBuffer), m_sender,
                                 [this] (auto&&... args) {
@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "egress-scheduler.hpp"
+
+#include <algorithm>
+#include <map>
+
+namespace nfd::face {
+
+EgressScheduler::EgressScheduler(const Options& options)
+  : m_options(options)
+{
+  rebuildClasses();
+}
+
+static bool
+hasSameCriteria(const EgressScheduler::Class& a, const EgressScheduler::Class& b)
+{
+  return a.packetTypes == b.packetTypes && a.prefixes == b.prefixes;
+}
+
+void
+EgressScheduler::setOptions(const Options& options)
+{
+  // queued packets keep their class only if every class still matches the same traffic
+  bool isSameClassification = options.classes.size() == m_options.classes.size() &&
+                              std::equal(options.classes.begin(), options.classes.end(),
+                                         m_options.classes.begin(), &hasSameCriteria);
+
+  std::vector<ClassState> oldClasses = std::move(m_classes);
+  m_options = options;
+  rebuildClasses();
+
+  // preserve queued packets, keeping their relative order within each old class
+  for (size_t i = 0; i < oldClasses.size(); ++i) {
+    size_t newClass = isSameClassification ? i : 0;
+    while (!oldClasses[i].queue.empty()) {
+      Block packet = std::move(oldClasses[i].queue.front());
+      oldClasses[i].queue.pop();
+      m_nBytes -= packet.size();
+      --m_nPackets;
+      push(packet, newClass);
+    }
+  }
+}
+
+void
+EgressScheduler::rebuildClasses()
+{
+  m_classes.clear();
+  m_classes.push_back({&m_options.defaultClass});
+  for (const auto& cls : m_options.classes) {
+    m_classes.push_back({&cls});
+  }
+
+  m_groups.clear();
+  m_groupOfClass.assign(m_classes.size(), 0);
+  std::map<uint8_t, std::vector<size_t>> byPriority;
+  for (size_t i = 0; i < m_classes.size(); ++i) {
+    byPriority[m_classes[i].def->priority].push_back(i);
+  }
+  for (auto& [priority, members] : byPriority) {
+    for (size_t i : members) {
+      m_groupOfClass[i] = m_groups.size();
+    }
+    m_groups.push_back({std::move(members)});
+  }
+}
+
+size_t
+EgressScheduler::classify(PacketType type, const Name& name) const
+{
+  for (size_t i = 0; i < m_options.classes.size(); ++i) {
+    const Class& cls = m_options.classes[i];
+    if (cls.packetTypes != 0 && (cls.packetTypes & static_cast<uint8_t>(type)) == 0) {
+      continue;
+    }
+    if (!cls.prefixes.empty() &&
+        std::none_of(cls.prefixes.begin(), cls.prefixes.end(),
+                     [&name] (const Name& prefix) { return prefix.isPrefixOf(name); })) {
+      continue;
+    }
+    return i + 1;
+  }
+  return 0;
+}
+
+void
+EgressScheduler::push(const Block& packet, size_t trafficClass)
+{
+  BOOST_ASSERT(trafficClass < m_classes.size());
+  m_classes[trafficClass].queue.push(packet);
+  ++m_groups[m_groupOfClass[trafficClass]].nPackets;
+  ++m_nPackets;
+  m_nBytes += packet.size();
+}
+
+std::optional<Block>
+EgressScheduler::pop()
+{
+  for (auto& group : m_groups) {
+    if (group.nPackets == 0) {
+      continue;
+    }
+
+    // Deficit round robin: each visit to a backlogged class adds quantum * weight to its deficit,
+    // and the class is served as long as its deficit covers the packet at the head of its queue.
+    // This loop terminates because the group has at least one backlogged class, whose deficit
+    // grows on every visit.
+    while (true) {
+      ClassState& cls = m_classes[group.members[group.current]];
+      if (!cls.isVisited && !cls.queue.empty()) {
+        cls.deficit += m_options.quantum * std::max<uint32_t>(cls.def->weight, 1);
+        cls.isVisited = true;
+      }
+
+      if (!cls.queue.empty() && cls.deficit >= cls.queue.front().size()) {
+        Block packet = std::move(cls.queue.front());
+        cls.queue.pop();
+        cls.deficit -= packet.size();
+        --group.nPackets;
+        --m_nPackets;
+        m_nBytes -= packet.size();
+        return packet;
+      }
+
+      // end of visit: an idle class does not accumulate credit
+      if (cls.queue.empty()) {
+        cls.deficit = 0;
+      }
+      cls.isVisited = false;
+      group.current = (group.current + 1) % group.members.size();
+    }
+  }
+  return std::nullopt;
+}
+
+void
+EgressScheduler::clear()
+{
+  for (auto& cls : m_classes) {
+    cls.queue = {};
+    cls.deficit = 0;
+    cls.isVisited = false;
+  }
+  for (auto& group : m_groups) {
+    group.nPackets = 0;
+  }
+  m_nPackets = 0;
+  m_nBytes = 0;
+}
+
+} // namespace nfd::face
@@ -0,0 +1,228 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_EGRESS_SCHEDULER_HPP
+#define NFD_DAEMON_FACE_EGRESS_SCHEDULER_HPP
+
+#include "core/common.hpp"
+
+#include <queue>
+
+namespace nfd::face {
+
+/**
+ * \brief Kinds of network-layer packets, used to classify outgoing traffic.
+ */
+enum class PacketType : uint8_t {
+  INTEREST = 1 << 0,
+  DATA     = 1 << 1,
+  NACK     = 1 << 2,
+};
+
+/**
+ * \brief Multi-class packet queue with strict priority and deficit round robin scheduling.
+ *
+ * Outgoing packets are assigned to traffic classes by classify(). Among classes that have
+ * queued packets, those with the numerically lowest Class::priority are always served first;
+ * classes sharing the same priority are served by deficit round robin in proportion to their
+ * Class::weight.
+ *
+ * Class 0 is the default class, which receives every packet that does not match any rule.
+ */
+class EgressScheduler : noncopyable
+{
+public:
+  /** \brief Definition of a traffic class.
+   */
+  struct Class
+  {
+    /** \brief Label used in logging and configuration.
+     */
+    std::string name;
+
+    /** \brief Strict priority of the class; lower values are served first.
+     */
+    uint8_t priority = 128;
+
+    /** \brief DRR weight relative to other classes with the same priority.
+     */
+    uint32_t weight = 1;
+
+    /** \brief Packet types matched by this class, as a bitmask of PacketType; zero matches any.
+     */
+    uint8_t packetTypes = 0;
+
+    /** \brief Name prefixes matched by this class; empty matches any name.
+     */
+    std::vector<Name> prefixes;
+  };
+
+  /** \brief %Options that control the behavior of EgressScheduler.
+   */
+  struct Options
+  {
+    /** \brief Traffic classes in matching order, excluding the default class.
+     *
+     *  If empty, all packets share the default class and are served in FIFO order.
+     */
+    std::vector<Class> classes;
+
+    /** \brief Default class, which receives unmatched packets.
+     *
+     *  Its matching criteria are ignored.
+     */
+    Class defaultClass;
+
+    /** \brief Number of octets added to the deficit of a class per unit of weight in each round.
+     */
+    size_t quantum = ndn::MAX_NDN_PACKET_SIZE;
+
+    /** \brief Packets are held back while the transport has more than this many octets queued.
+     *
+     *  This keeps the backlog in the scheduler, where it can be reordered, rather than in
+     *  the FIFO send queue of the transport. Only effective if #classes is not empty.
+     */
+    size_t maxTransportBacklog = 65536;
+
+    /** \brief Returns whether traffic classes are configured.
+     */
+    bool
+    isEnabled() const
+    {
+      return !classes.empty();
+    }
+  };
+
+  explicit
+  EgressScheduler(const Options& options);
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+  /** \brief Set options for the scheduler.
+   *
+   *  Packets already queued keep their traffic class if every class matches the same packet
+   *  types and prefixes as before. Otherwise, they are moved to the default class, because
+   *  their names are no longer available to classify() once they are queued.
+   */
+  void
+  setOptions(const Options& options);
+
+  /** \brief Returns the number of traffic classes, including the default class.
+   */
+  size_t
+  getNClasses() const
+  {
+    return m_classes.size();
+  }
+
+  /** \brief Determines the traffic class of an outgoing packet.
+   *  \return index of the first matching class, or 0 if no class matches
+   */
+  size_t
+  classify(PacketType type, const Name& name) const;
+
+  /** \brief Appends a packet to the queue of the specified traffic class.
+   *  \pre trafficClass < getNClasses()
+   */
+  void
+  push(const Block& packet, size_t trafficClass);
+
+  /** \brief Removes the next packet to be transmitted.
+   *  \return the packet, or std::nullopt if all queues are empty
+   */
+  std::optional<Block>
+  pop();
+
+  /** \brief Drops all queued packets.
+   */
+  void
+  clear();
+
+  bool
+  empty() const
+  {
+    return m_nPackets == 0;
+  }
+
+  /** \brief Returns the total number of queued packets.
+   */
+  size_t
+  size() const
+  {
+    return m_nPackets;
+  }
+
+  /** \brief Returns the total size of queued packets, in octets.
+   */
+  size_t
+  getBytes() const
+  {
+    return m_nBytes;
+  }
+
+  /** \brief Returns the number of packets queued in the specified traffic class.
+   */
+  size_t
+  getQueueLength(size_t trafficClass) const
+  {
+    return m_classes.at(trafficClass).queue.size();
+  }
+
+private:
+  void
+  rebuildClasses();
+
+private:
+  struct ClassState
+  {
+    const Class* def;
+    std::queue<Block> queue;
+    size_t deficit = 0;
+    bool isVisited = false;
+  };
+
+  /// classes sharing the same priority, served by DRR
+  struct PriorityGroup
+  {
+    std::vector<size_t> members; ///< indices into m_classes
+    size_t current = 0; ///< position in members of the class being visited
+    size_t nPackets = 0;
+  };
+
+  Options m_options;
+  std::vector<ClassState> m_classes; ///< index 0 is the default class
+  std::vector<PriorityGroup> m_groups; ///< sorted by increasing priority value
+  std::vector<size_t> m_groupOfClass; ///< class index => index into m_groups
+  size_t m_nPackets = 0;
+  size_t m_nBytes = 0;
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_EGRESS_SCHEDULER_HPP
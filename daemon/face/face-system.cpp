@@ -24,6 +24,7 @@
  */
 
 #include "face-system.hpp"
+#include "generic-link-service.hpp"
 #include "protocol-factory.hpp"
 #include "netdev-bound.hpp"
 #include "common/global.hpp"
@@ -36,8 +37,198 @@ NFD_LOG_INIT(FaceSystem);
 const std::string CFGSEC_FACESYSTEM = "face_system";
 const std::string CFGSEC_GENERAL = "general";
 const std::string CFGSEC_GENERAL_FQ = CFGSEC_FACESYSTEM + ".general";
+const std::string CFGSEC_SENDQUEUE = "send_queue";
+const std::string CFGSEC_SENDQUEUE_FQ = CFGSEC_GENERAL_FQ + "." + CFGSEC_SENDQUEUE;
+const std::string CFGSEC_RATELIMIT = "rate_limit";
+const std::string CFGSEC_RATELIMIT_FQ = CFGSEC_GENERAL_FQ + "." + CFGSEC_RATELIMIT;
+const std::string CFGSEC_TRAFFICCLASSES = "traffic_classes";
+const std::string CFGSEC_TRAFFICCLASSES_FQ = CFGSEC_GENERAL_FQ + "." + CFGSEC_TRAFFICCLASSES;
 const std::string CFGSEC_NETDEVBOUND = "netdev_bound";
 
+static CoDelQueue::Options
+parseSendQueueSection(const ConfigSection& section)
+{
+  // send_queue
+  // {
+  //   capacity 0
+  //   enable_codel no
+  //   codel_target 5
+  //   codel_interval 100
+  // }
+
+  CoDelQueue::Options options;
+  for (const auto& pair : section) {
+    const std::string& key = pair.first;
+    if (key == "capacity") {
+      options.capacity = ConfigFile::parseNumber<size_t>(pair, CFGSEC_SENDQUEUE_FQ);
+    }
+    else if (key == "enable_codel") {
+      options.isCoDelEnabled = ConfigFile::parseYesNo(pair, CFGSEC_SENDQUEUE_FQ);
+    }
+    else if (key == "codel_target") {
+      options.target = time::milliseconds(ConfigFile::parseNumber<uint32_t>(pair, CFGSEC_SENDQUEUE_FQ));
+    }
+    else if (key == "codel_interval") {
+      options.interval = time::milliseconds(ConfigFile::parseNumber<uint32_t>(pair, CFGSEC_SENDQUEUE_FQ));
+    }
+    else {
+      NDN_THROW(ConfigFile::Error("Unrecognized option " + CFGSEC_SENDQUEUE_FQ + "." + key));
+    }
+  }
+
+  if (options.isCoDelEnabled && options.interval <= options.target) {
+    NDN_THROW(ConfigFile::Error(CFGSEC_SENDQUEUE_FQ + ".codel_interval must be greater than "
+                                "codel_target"));
+  }
+  return options;
+}
+
+static TokenBucketShaper::Options
+parseRateLimitSection(const ConfigSection& section)
+{
+  // rate_limit
+  // {
+  //   byte_rate 0
+  //   packet_rate 0
+  //   byte_burst 65536
+  //   packet_burst 32
+  //   queue_capacity 262144
+  // }
+
+  TokenBucketShaper::Options options;
+  for (const auto& pair : section) {
+    const std::string& key = pair.first;
+    if (key == "byte_rate") {
+      options.byteRate = ConfigFile::parseNumber<uint64_t>(pair, CFGSEC_RATELIMIT_FQ);
+    }
+    else if (key == "packet_rate") {
+      options.packetRate = ConfigFile::parseNumber<uint64_t>(pair, CFGSEC_RATELIMIT_FQ);
+    }
+    else if (key == "byte_burst") {
+      options.byteBurst = ConfigFile::parseNumber<size_t>(pair, CFGSEC_RATELIMIT_FQ);
+      ConfigFile::checkRange<size_t>(options.byteBurst, 1, std::numeric_limits<size_t>::max(),
+                                     key, CFGSEC_RATELIMIT_FQ);
+    }
+    else if (key == "packet_burst") {
+      options.packetBurst = ConfigFile::parseNumber<size_t>(pair, CFGSEC_RATELIMIT_FQ);
+      ConfigFile::checkRange<size_t>(options.packetBurst, 1, std::numeric_limits<size_t>::max(),
+                                     key, CFGSEC_RATELIMIT_FQ);
+    }
+    else if (key == "queue_capacity") {
+      options.queueCapacity = ConfigFile::parseNumber<size_t>(pair, CFGSEC_RATELIMIT_FQ);
+    }
+    else {
+      NDN_THROW(ConfigFile::Error("Unrecognized option " + CFGSEC_RATELIMIT_FQ + "." + key));
+    }
+  }
+  return options;
+}
+
+static EgressScheduler::Class
+parseTrafficClass(const ConfigSection& section, const std::string& sectionName, bool isDefault)
+{
+  EgressScheduler::Class cls;
+  cls.name = isDefault ? "default" : "";
+  for (const auto& pair : section) {
+    const std::string& key = pair.first;
+    const std::string& value = pair.second.get_value<std::string>();
+    if (key == "name" && !isDefault) {
+      cls.name = value;
+    }
+    else if (key == "priority") {
+      auto priority = ConfigFile::parseNumber<uint32_t>(pair, sectionName);
+      ConfigFile::checkRange<uint32_t>(priority, 0, std::numeric_limits<uint8_t>::max(),
+                                       key, sectionName);
+      cls.priority = static_cast<uint8_t>(priority);
+    }
+    else if (key == "weight") {
+      cls.weight = ConfigFile::parseNumber<uint32_t>(pair, sectionName);
+      ConfigFile::checkRange<uint32_t>(cls.weight, 1, std::numeric_limits<uint32_t>::max(),
+                                       key, sectionName);
+    }
+    else if (key == "packet_type" && !isDefault) {
+      if (value == "interest") {
+        cls.packetTypes |= static_cast<uint8_t>(PacketType::INTEREST);
+      }
+      else if (value == "data") {
+        cls.packetTypes |= static_cast<uint8_t>(PacketType::DATA);
+      }
+      else if (value == "nack") {
+        cls.packetTypes |= static_cast<uint8_t>(PacketType::NACK);
+      }
+      else {
+        NDN_THROW(ConfigFile::Error("Invalid value for option " + sectionName + "." + key +
+                                    ": '" + value + "'"));
+      }
+    }
+    else if (key == "prefix" && !isDefault) {
+      try {
+        cls.prefixes.emplace_back(value);
+      }
+      catch (const ndn::tlv::Error&) {
+        NDN_THROW(ConfigFile::Error("Invalid value for option " + sectionName + "." + key +
+                                    ": '" + value + "'"));
+      }
+    }
+    else {
+      NDN_THROW(ConfigFile::Error("Unrecognized option " + sectionName + "." + key));
+    }
+  }
+
+  if (cls.name.empty()) {
+    NDN_THROW(ConfigFile::Error("Missing option " + sectionName + ".name"));
+  }
+  return cls;
+}
+
+static EgressScheduler::Options
+parseTrafficClassesSection(const ConfigSection& section)
+{
+  // traffic_classes
+  // {
+  //   quantum 8800
+  //   max_transport_backlog 65536
+  //   class
+  //   {
+  //     name control
+  //     priority 0
+  //     weight 1
+  //     packet_type nack
+  //     prefix /localhop
+  //   }
+  //   default
+  //   {
+  //     priority 128
+  //     weight 1
+  //   }
+  // }
+
+  EgressScheduler::Options options;
+  for (const auto& pair : section) {
+    const std::string& key = pair.first;
+    if (key == "quantum") {
+      options.quantum = ConfigFile::parseNumber<size_t>(pair, CFGSEC_TRAFFICCLASSES_FQ);
+      ConfigFile::checkRange<size_t>(options.quantum, 1, std::numeric_limits<size_t>::max(),
+                                     key, CFGSEC_TRAFFICCLASSES_FQ);
+    }
+    else if (key == "max_transport_backlog") {
+      options.maxTransportBacklog = ConfigFile::parseNumber<size_t>(pair, CFGSEC_TRAFFICCLASSES_FQ);
+    }
+    else if (key == "class") {
+      options.classes.push_back(parseTrafficClass(pair.second, CFGSEC_TRAFFICCLASSES_FQ + ".class",
+                                                  false));
+    }
+    else if (key == "default") {
+      options.defaultClass = parseTrafficClass(pair.second, CFGSEC_TRAFFICCLASSES_FQ + ".default",
+                                               true);
+    }
+    else {
+      NDN_THROW(ConfigFile::Error("Unrecognized option " + CFGSEC_TRAFFICCLASSES_FQ + "." + key));
+    }
+  }
+  return options;
+}
+
 FaceSystem::FaceSystem(FaceTable& faceTable, shared_ptr<ndn::net::NetworkMonitor> netmon)
   : m_faceTable(faceTable)
   , m_netmon(std::move(netmon))
@@ -49,6 +240,10 @@ FaceSystem::FaceSystem(FaceTable& faceTable, shared_ptr<ndn::net::NetworkMonitor
   }
 
   m_netdevBound = make_unique<NetdevBound>(pfCtorParams, *this);
+
+  m_faceAddConn = m_faceTable.afterAdd.connect([this] (const Face& face) {
+    applyEgressOptions(face);
+  });
 }
 
 ProtocolFactoryCtorParams
@@ -112,6 +307,15 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
       if (key == "enable_congestion_marking") {
         context.generalConfig.wantCongestionMarking = ConfigFile::parseYesNo(pair, CFGSEC_GENERAL_FQ);
       }
+      else if (key == CFGSEC_SENDQUEUE) {
+        context.generalConfig.streamSendQueueOptions = parseSendQueueSection(pair.second);
+      }
+      else if (key == CFGSEC_RATELIMIT) {
+        context.generalConfig.rateLimitOptions = parseRateLimitSection(pair.second);
+      }
+      else if (key == CFGSEC_TRAFFICCLASSES) {
+        context.generalConfig.trafficClassOptions = parseTrafficClassesSection(pair.second);
+      }
       else {
         NDN_THROW(ConfigFile::Error("Unrecognized option " + CFGSEC_GENERAL_FQ + "." + key));
       }
@@ -139,6 +343,15 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
     }
   }
 
+  // apply rate limit and traffic classes to new faces and to existing faces
+  if (!isDryRun) {
+    m_rateLimitOptions = context.generalConfig.rateLimitOptions;
+    m_trafficClassOptions = context.generalConfig.trafficClassOptions;
+    for (const Face& face : m_faceTable) {
+      applyEgressOptions(face);
+    }
+  }
+
   // process netdev_bound section, after factories start providing *+dev schemes
   auto netdevBoundSection = configSection.get_child_optional(CFGSEC_NETDEVBOUND);
   m_netdevBound->processConfig(netdevBoundSection, context);
@@ -162,4 +375,26 @@ FaceSystem::processConfig(const ConfigSection& configSection, bool isDryRun, con
   }
 }
 
+void
+FaceSystem::applyEgressOptions(const Face& face) const
+{
+  if (face.getScope() == ndn::nfd::FACE_SCOPE_LOCAL) {
+    return;
+  }
+
+  auto linkService = dynamic_cast<GenericLinkService*>(face.getLinkService());
+  if (linkService == nullptr) {
+    return;
+  }
+
+  auto options = linkService->getOptions();
+  if (!options.shaperOptions.isEnabled() && !m_rateLimitOptions.isEnabled() &&
+      !options.schedulerOptions.isEnabled() && !m_trafficClassOptions.isEnabled()) {
+    return;
+  }
+  options.shaperOptions = m_rateLimitOptions;
+  options.schedulerOptions = m_trafficClassOptions;
+  linkService->setOptions(options);
+}
+
 } // namespace nfd::face
@@ -26,7 +26,9 @@
 #ifndef NFD_DAEMON_FACE_FACE_SYSTEM_HPP
 #define NFD_DAEMON_FACE_FACE_SYSTEM_HPP
 
+#include "codel-queue.hpp"
 #include "network-predicate.hpp"
+#include "token-bucket-shaper.hpp"
 #include "common/config-file.hpp"
 
 #include <ndn-cxx/net/network-address.hpp>
@@ -39,6 +41,7 @@ class FaceTable;
 
 namespace face {
 
+class Face;
 class NetdevBound;
 class ProtocolFactory;
 struct ProtocolFactoryCtorParams;
@@ -91,6 +94,9 @@ public:
   struct GeneralConfig
   {
     bool wantCongestionMarking = true;
+    CoDelQueue::Options streamSendQueueOptions;
+    TokenBucketShaper::Options rateLimitOptions;
+    EgressScheduler::Options trafficClassOptions;
   };
 
   /** \brief Context for processing a config section in ProtocolFactory.
@@ -111,6 +117,11 @@ private:
   processConfig(const ConfigSection& configSection, bool isDryRun,
                 const std::string& filename);
 
+  /** \brief Applies the configured egress rate limit and traffic classes to a non-local face.
+   */
+  void
+  applyEgressOptions(const Face& face) const;
+
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /** \brief Config section name => protocol factory.
    */
@@ -126,6 +137,9 @@ private:
 
   FaceTable& m_faceTable;
   shared_ptr<ndn::net::NetworkMonitor> m_netmon;
+  TokenBucketShaper::Options m_rateLimitOptions;
+  EgressScheduler::Options m_trafficClassOptions;
+  signal::ScopedConnection m_faceAddConn;
 };
 
 } // namespace face
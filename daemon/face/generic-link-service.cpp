@@ -24,6 +24,7 @@
  */
 
 #include "generic-link-service.hpp"
+#include "common/global.hpp"
 
 #include <ndn-cxx/lp/pit-token.hpp>
 #include <ndn-cxx/lp/tags.hpp>
@@ -43,7 +44,10 @@ GenericLinkService::GenericLinkService(const GenericLinkService::Options& option
   , m_fragmenter(m_options.fragmenterOptions, this)
   , m_reassembler(m_options.reassemblerOptions, this)
   , m_reliability(m_options.reliabilityOptions, this)
+  , m_shaper(m_options.shaperOptions)
   , m_lastSeqNo(-2)
+  , m_egressScheduler(m_options.schedulerOptions)
+  , m_transportRetryDelay(MIN_TRANSPORT_RETRY_DELAY)
   , m_nextMarkTime(time::steady_clock::time_point::max())
   , m_nMarkedSinceInMarkingState(0)
 {
@@ -59,6 +63,10 @@ GenericLinkService::setOptions(const GenericLinkService::Options& options)
   m_fragmenter.setOptions(m_options.fragmenterOptions);
   m_reassembler.setOptions(m_options.reassemblerOptions);
   m_reliability.setOptions(m_options.reliabilityOptions);
+  m_shaper.setOptions(m_options.shaperOptions);
+  m_egressScheduler.setOptions(m_options.schedulerOptions);
+  // packets that are no longer held back are sent immediately
+  this->drainEgressQueue();
 }
 
 ssize_t
@@ -111,6 +119,74 @@ GenericLinkService::sendLpPacket(lp::Packet&& pkt)
   this->sendPacket(block);
 }
 
+bool
+GenericLinkService::canTransmit()
+{
+  if (!m_egressScheduler.getOptions().isEnabled()) {
+    return true;
+  }
+
+  ssize_t backlog = getTransport()->getSendQueueLength();
+  return backlog < 0 ||
+         static_cast<size_t>(backlog) <= m_options.schedulerOptions.maxTransportBacklog;
+}
+
+void
+GenericLinkService::drainEgressQueue()
+{
+  m_egressEvent.cancel();
+
+  bool isActive = this->isShapingActive();
+  while (true) {
+    if (!m_egressHead) {
+      m_egressHead = m_egressScheduler.pop();
+      if (!m_egressHead) {
+        return;
+      }
+    }
+
+    if (isActive) {
+      if (!this->canTransmit()) {
+        this->waitForTransport();
+        return;
+      }
+      m_transportRetryDelay = MIN_TRANSPORT_RETRY_DELAY;
+
+      if (!m_shaper.canSend(m_egressHead->size())) {
+        m_egressEvent = getScheduler().schedule(m_shaper.getDelay(m_egressHead->size()),
+                                                [this] { drainEgressQueue(); });
+        return;
+      }
+      m_shaper.consume(m_egressHead->size());
+    }
+
+    Block wire = std::move(*m_egressHead);
+    m_egressHead.reset();
+    this->transmitShapedPacket(wire);
+  }
+}
+
+void
+GenericLinkService::waitForTransport()
+{
+  Transport* transport = getTransport();
+  if (transport->isSendQueueDrainPending()) {
+    // resume as soon as the transport has flushed its queue
+    if (!m_sendQueueDrainedConn.isConnected()) {
+      m_sendQueueDrainedConn = transport->afterSendQueueDrained.connect([this] {
+        if (m_egressHead) {
+          drainEgressQueue();
+        }
+      });
+    }
+    return;
+  }
+
+  // the backlog may be entirely in the kernel, in which case no notification will come
+  m_egressEvent = getScheduler().schedule(m_transportRetryDelay, [this] { drainEgressQueue(); });
+  m_transportRetryDelay = std::min(m_transportRetryDelay * 2, MAX_TRANSPORT_RETRY_DELAY);
+}
+
 void
 GenericLinkService::doSendInterest(const Interest& interest)
 {
@@ -118,7 +194,8 @@ GenericLinkService::doSendInterest(const Interest& interest)
 
   encodeLpFields(interest, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), true);
+  auto trafficClass = m_egressScheduler.classify(PacketType::INTEREST, interest.getName());
+  this->sendNetPacket(std::move(lpPacket), true, trafficClass);
 }
 
 void
@@ -128,7 +205,8 @@ GenericLinkService::doSendData(const Data& data)
 
   encodeLpFields(data, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), false);
+  auto trafficClass = m_egressScheduler.classify(PacketType::DATA, data.getName());
+  this->sendNetPacket(std::move(lpPacket), false, trafficClass);
 }
 
 void
@@ -139,7 +217,8 @@ GenericLinkService::doSendNack(const lp::Nack& nack)
 
   encodeLpFields(nack, lpPacket);
 
-  this->sendNetPacket(std::move(lpPacket), false);
+  auto trafficClass = m_egressScheduler.classify(PacketType::NACK, nack.getInterest().getName());
+  this->sendNetPacket(std::move(lpPacket), false, trafficClass);
 }
 
 void
@@ -184,7 +263,51 @@ GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lp
 }
 
 void
-GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest)
+GenericLinkService::sendNetPacket(lp::Packet&& pkt, bool isInterest, size_t trafficClass)
+{
+  if (!this->isShapingActive()) {
+    this->transmitNetPacket(std::move(pkt), isInterest);
+    return;
+  }
+
+  // Shape before fragmentation and reliability, so that sequence numbers are assigned and
+  // retransmission timers are started only when the packet is transmitted
+  Block wire = pkt.wireEncode();
+  if (!m_egressHead && m_egressScheduler.empty() &&
+      this->canTransmit() && m_shaper.canSend(wire.size())) {
+    m_shaper.consume(wire.size());
+    this->transmitNetPacket(std::move(pkt), isInterest);
+    return;
+  }
+
+  if (this->getEgressQueueBytes() + wire.size() > m_options.shaperOptions.queueCapacity) {
+    NFD_LOG_FACE_DEBUG("egress queue is full: DROP");
+    return;
+  }
+
+  bool wasEmpty = !m_egressHead && m_egressScheduler.empty();
+  m_egressScheduler.push(wire, trafficClass);
+  if (wasEmpty) {
+    this->drainEgressQueue();
+  }
+}
+
+void
+GenericLinkService::transmitShapedPacket(const Block& wire)
+{
+  lp::Packet pkt(wire);
+
+  // a Nack is carried as an Interest with a Nack header field
+  auto [fragBegin, fragEnd] = pkt.get<lp::FragmentField>();
+  uint32_t type = 0;
+  bool isInterest = tlv::readType(fragBegin, fragEnd, type) && type == tlv::Interest &&
+                    !pkt.has<lp::NackField>();
+
+  this->transmitNetPacket(std::move(pkt), isInterest);
+}
+
+void
+GenericLinkService::transmitNetPacket(lp::Packet&& pkt, bool isInterest)
 {
   std::vector<lp::Packet> frags;
   ssize_t mtu = getEffectiveMtu();
@@ -245,6 +368,10 @@ void
 GenericLinkService::checkCongestionLevel(lp::Packet& pkt)
 {
   ssize_t sendQueueLength = getTransport()->getSendQueueLength();
+  if (this->isShapingActive()) {
+    // Packets held back by the rate limiter or the egress scheduler are part of the send queue
+    sendQueueLength = std::max<ssize_t>(0, sendQueueLength) + this->getEgressQueueBytes();
+  }
   // The transport must support retrieving the current send queue length
   if (sendQueueLength < 0) {
     return;
@@ -29,7 +29,9 @@
 #include "link-service.hpp"
 #include "lp-fragmenter.hpp"
 #include "lp-reassembler.hpp"
+#include "egress-scheduler.hpp"
 #include "lp-reliability.hpp"
+#include "token-bucket-shaper.hpp"
 
 namespace nfd::face {
 
@@ -164,6 +166,22 @@ public:
      *  being set with canOverrideMtuTo().
      */
     ssize_t overrideMtu = std::numeric_limits<ssize_t>::max();
+
+    /** \brief Options for egress rate limiting.
+     *
+     *  Rate limiting is disabled unless a byte rate or a packet rate is set. It applies to
+     *  network-layer packets before fragmentation and reliability, so that retransmission
+     *  timers start only when a packet is handed to the transport.
+     */
+    TokenBucketShaper::Options shaperOptions;
+
+    /** \brief Options for scheduling of outgoing packets among traffic classes.
+     *
+     *  If no traffic class is configured, packets are sent in FIFO order. Otherwise, packets
+     *  are also held back while the transport has more than
+     *  EgressScheduler::Options::maxTransportBacklog octets queued.
+     */
+    EgressScheduler::Options schedulerOptions;
   };
 
   /** \brief %Counters provided by GenericLinkService.
@@ -209,6 +227,7 @@ NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE: // send path
   requestIdlePacket();
 
   /** \brief Send an LpPacket.
+   *  \param pkt the LpPacket
    */
   void
   sendLpPacket(lp::Packet&& pkt);
@@ -235,12 +254,64 @@ private: // send path
   void
   encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lpPacket);
 
-  /** \brief Send a complete network layer packet.
+  /** \brief Send a complete network layer packet, or queue it in the egress scheduler.
    *  \param pkt LpPacket containing a complete network layer packet
    *  \param isInterest whether the network layer packet is an Interest
+   *  \param trafficClass traffic class of the network layer packet
+   */
+  void
+  sendNetPacket(lp::Packet&& pkt, bool isInterest, size_t trafficClass);
+
+  /** \brief Fragment a complete network layer packet, and transmit the fragments.
+   *  \param pkt LpPacket containing a complete network layer packet
+   *  \param isInterest whether the network layer packet is an Interest
+   */
+  void
+  transmitNetPacket(lp::Packet&& pkt, bool isInterest);
+
+  /** \brief Transmit a network layer packet released from the egress scheduler.
+   *  \param wire encoding of the LpPacket passed to sendNetPacket()
+   */
+  void
+  transmitShapedPacket(const Block& wire);
+
+  /** \brief Returns whether outgoing packets may be delayed, i.e., a rate limit or traffic
+   *         classes are configured.
+   */
+  bool
+  isShapingActive() const
+  {
+    return m_shaper.getOptions().isEnabled() || m_egressScheduler.getOptions().isEnabled();
+  }
+
+  /** \brief Returns the total size of the packets waiting in the egress scheduler, in octets.
+   */
+  size_t
+  getEgressQueueBytes() const
+  {
+    return m_egressScheduler.getBytes() + (m_egressHead ? m_egressHead->size() : 0);
+  }
+
+  /** \brief Returns whether the transport can accept more packets from the egress scheduler.
+   */
+  bool
+  canTransmit();
+
+  /** \brief Transmit queued packets as long as they conform to the rate limits and the
+   *         transport can accept them, then arrange to be invoked again.
+   */
+  void
+  drainEgressQueue();
+
+  /** \brief Arrange for drainEgressQueue() to be invoked when the transport may have room.
+   *
+   *  If the transport flushes its own send queue, draining resumes on afterSendQueueDrained.
+   *  Otherwise, e.g., if the backlog is in the kernel, transmission is retried after a delay
+   *  that doubles on every attempt, from MIN_TRANSPORT_RETRY_DELAY up to
+   *  MAX_TRANSPORT_RETRY_DELAY.
    */
   void
-  sendNetPacket(lp::Packet&& pkt, bool isInterest);
+  waitForTransport();
 
   /** \brief If the send queue is found to be congested, add a congestion mark to the packet
    *         according to CoDel.
@@ -308,7 +379,17 @@ NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE:
   LpFragmenter m_fragmenter;
   LpReassembler m_reassembler;
   LpReliability m_reliability;
+  TokenBucketShaper m_shaper;
   lp::Sequence m_lastSeqNo;
+  EgressScheduler m_egressScheduler;
+  /// packet selected by the egress scheduler, waiting for tokens or for the transport
+  std::optional<Block> m_egressHead;
+  scheduler::ScopedEventId m_egressEvent;
+  time::nanoseconds m_transportRetryDelay;
+  signal::ScopedConnection m_sendQueueDrainedConn;
+
+  static constexpr time::nanoseconds MIN_TRANSPORT_RETRY_DELAY = 1_ms;
+  static constexpr time::nanoseconds MAX_TRANSPORT_RETRY_DELAY = 32_ms;
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   /// Time to mark next packet due to send queue congestion
@@ -27,11 +27,10 @@
 #define NFD_DAEMON_FACE_STREAM_TRANSPORT_HPP
 
 #include "transport.hpp"
+#include "codel-queue.hpp"
 #include "socket-utils.hpp"
 #include "common/global.hpp"
 
-#include <queue>
-
 #include <boost/asio/write.hpp>
 
 namespace nfd::face {
@@ -49,13 +48,21 @@ public:
   /** \brief Construct stream transport.
    *
    *  \param socket Protocol-specific socket for the created transport
+   *  \param sendQueueOptions Options for the send queue of the created transport
    */
   explicit
-  StreamTransport(typename protocol::socket&& socket);
+  StreamTransport(typename protocol::socket&& socket,
+                  const CoDelQueue::Options& sendQueueOptions = {});
 
   ssize_t
   getSendQueueLength() override;
 
+  bool
+  isSendQueueDrainPending() const override
+  {
+    return !m_sendingPackets.empty() || !m_sendQueue.empty();
+  }
+
 protected:
   void
   doClose() override;
@@ -95,28 +102,58 @@ protected:
   size_t
   getSendQueueBytes() const;
 
+public:
+  /** \brief Maximum number of queued packets written to the socket by one gather-write.
+   *
+   *  Batching coalesces consecutive packets into a single writev(2) and a single completion
+   *  handler, instead of one system call and one handler invocation per packet.
+   */
+  static constexpr size_t MAX_SEND_BATCH = 64;
+
+  /** \brief Size of each chunk of the receive buffer.
+   *
+   *  Incoming packets are delivered as Blocks that share the chunk they were received into,
+   *  so that no per-packet copy is made. A chunk is recycled once no such Block remains;
+   *  otherwise a new chunk is allocated when the current one cannot hold another packet.
+   *  Packets that are kept for a long time, i.e., Data in the Content Store, are copied out
+   *  of the chunk by their holder, so that they do not keep the whole chunk alive.
+   */
+  static constexpr size_t RECEIVE_CHUNK_SIZE = 8 * ndn::MAX_NDN_PACKET_SIZE;
+
 protected:
   typename protocol::socket m_socket;
 
   NFD_LOG_MEMBER_DECL();
 
 private:
-  uint8_t m_receiveBuffer[ndn::MAX_NDN_PACKET_SIZE];
-  size_t m_receiveBufferSize;
-  std::queue<Block> m_sendQueue;
-  size_t m_sendQueueBytes;
+  shared_ptr<ndn::Buffer> m_receiveBuffer;
+  size_t m_receiveBegin; ///< offset of the first octet not yet parsed
+  size_t m_receiveEnd; ///< offset past the last octet received
+  CoDelQueue m_sendQueue;
+  /// packets currently being written to the socket, not counted in m_sendQueue
+  std::vector<Block> m_sendingPackets;
+  size_t m_sendingBytes = 0;
 };
 
 
 template<class T>
-StreamTransport<T>::StreamTransport(typename StreamTransport::protocol::socket&& socket)
+StreamTransport<T>::StreamTransport(typename StreamTransport::protocol::socket&& socket,
+                                    const CoDelQueue::Options& sendQueueOptions)
   : m_socket(std::move(socket))
-  , m_receiveBufferSize(0)
-  , m_sendQueueBytes(0)
+  , m_receiveBuffer(make_shared<ndn::Buffer>(RECEIVE_CHUNK_SIZE))
+  , m_receiveBegin(0)
+  , m_receiveEnd(0)
+  , m_sendQueue(sendQueueOptions)
 {
-  // No queue capacity is set because there is no theoretical limit to the size of m_sendQueue.
-  // Therefore, protecting against send queue overflows is less critical than in other transport
-  // types. Instead, we use the default threshold specified in the GenericLinkService options.
+  // No queue capacity is reported to the link service, because m_sendQueue is unbounded unless
+  // configured otherwise, and the kernel socket buffer is not the bottleneck. Instead, we use the
+  // default threshold specified in the GenericLinkService options for congestion marking.
+
+  m_sendQueue.afterDrop.connect([this] (const Block&) {
+    ++this->nOutQueueDrops;
+    NFD_LOG_FACE_DEBUG("Send queue drop: queued=" << m_sendQueue.getBytes() <<
+                       (m_sendQueue.isDropping() ? " codel" : " overflow"));
+  });
 
   startReceive();
 }
@@ -188,11 +225,10 @@ StreamTransport<T>::doSend(const Block& packet)
   if (getState() != TransportState::UP)
     return;
 
-  bool wasQueueEmpty = m_sendQueue.empty();
-  m_sendQueue.push(packet);
-  m_sendQueueBytes += packet.size();
+  if (!m_sendQueue.push(packet))
+    return;
 
-  if (wasQueueEmpty)
+  if (m_sendingPackets.empty())
     sendFromQueue();
 }
 
@@ -200,7 +236,24 @@ template<class T>
 void
 StreamTransport<T>::sendFromQueue()
 {
-  boost::asio::async_write(m_socket, boost::asio::buffer(m_sendQueue.front()),
+  BOOST_ASSERT(m_sendingPackets.empty());
+  while (m_sendingPackets.size() < MAX_SEND_BATCH) {
+    auto packet = m_sendQueue.pop();
+    if (!packet)
+      break;
+    m_sendingBytes += packet->size();
+    m_sendingPackets.push_back(std::move(*packet));
+  }
+  if (m_sendingPackets.empty())
+    return;
+
+  std::vector<boost::asio::const_buffer> buffers;
+  buffers.reserve(m_sendingPackets.size());
+  for (const auto& packet : m_sendingPackets) {
+    buffers.push_back(boost::asio::buffer(packet));
+  }
+
+  boost::asio::async_write(m_socket, buffers,
                            [this] (auto&&... args) { this->handleSend(std::forward<decltype(args)>(args)...); });
 }
 
@@ -214,13 +267,15 @@ StreamTransport<T>::handleSend(const boost::system::error_code& error,
 
   NFD_LOG_FACE_TRACE("Successfully sent: " << nBytesSent << " bytes");
 
-  BOOST_ASSERT(!m_sendQueue.empty());
-  BOOST_ASSERT(m_sendQueue.front().size() == nBytesSent);
-  m_sendQueueBytes -= nBytesSent;
-  m_sendQueue.pop();
+  BOOST_ASSERT(!m_sendingPackets.empty());
+  BOOST_ASSERT(m_sendingBytes == nBytesSent);
+  m_sendingPackets.clear();
+  m_sendingBytes = 0;
 
   if (!m_sendQueue.empty())
     sendFromQueue();
+  else
+    this->notifySendQueueDrained();
 }
 
 template<class T>
@@ -229,8 +284,11 @@ StreamTransport<T>::startReceive()
 {
   BOOST_ASSERT(getState() == TransportState::UP);
 
-  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer + m_receiveBufferSize,
-                                             ndn::MAX_NDN_PACKET_SIZE - m_receiveBufferSize),
+  BOOST_ASSERT(m_receiveBuffer->size() - m_receiveBegin >= ndn::MAX_NDN_PACKET_SIZE);
+  BOOST_ASSERT(m_receiveEnd < m_receiveBuffer->size());
+
+  m_socket.async_receive(boost::asio::buffer(m_receiveBuffer->data() + m_receiveEnd,
+                                             m_receiveBuffer->size() - m_receiveEnd),
                          [this] (auto&&... args) { this->handleReceive(std::forward<decltype(args)>(args)...); });
 }
 
@@ -244,37 +302,61 @@ StreamTransport<T>::handleReceive(const boost::system::error_code& error,
 
   NFD_LOG_FACE_TRACE("Received: " << nBytesReceived << " bytes");
 
-  m_receiveBufferSize += nBytesReceived;
-  auto bufferView = ndn::make_span(m_receiveBuffer, m_receiveBufferSize);
-  size_t offset = 0;
-  bool isOk = true;
-  while (offset < bufferView.size()) {
-    Block element;
-    std::tie(isOk, element) = Block::fromBuffer(bufferView.subspan(offset));
-    if (!isOk)
+  m_receiveEnd += nBytesReceived;
+  BOOST_ASSERT(m_receiveEnd <= m_receiveBuffer->size());
+
+  bool isTooLarge = false;
+  while (m_receiveBegin < m_receiveEnd) {
+    // Determine the size of the next element from its TLV-TYPE and TLV-LENGTH, because the
+    // chunk past m_receiveEnd contains stale data and must not be looked at
+    auto begin = m_receiveBuffer->cbegin() + m_receiveBegin;
+    auto end = m_receiveBuffer->cbegin() + m_receiveEnd;
+    auto pos = begin;
+    uint32_t type = 0;
+    uint64_t length = 0;
+    if (!ndn::tlv::readType(pos, end, type) || !ndn::tlv::readVarNumber(pos, end, length))
       break;
 
-    offset += element.size();
-    BOOST_ASSERT(offset <= bufferView.size());
+    size_t headerSize = static_cast<size_t>(pos - begin);
+    if (length > ndn::MAX_NDN_PACKET_SIZE - headerSize) {
+      isTooLarge = true;
+      break;
+    }
+    if (length > static_cast<size_t>(end - pos))
+      break;
 
+    // the element shares the chunk instead of copying it
+    Block element(m_receiveBuffer, begin, pos + length);
+    m_receiveBegin += element.size();
     this->receive(element);
   }
 
-  if (!isOk && m_receiveBufferSize == ndn::MAX_NDN_PACKET_SIZE && offset == 0) {
+  if (isTooLarge || m_receiveEnd - m_receiveBegin >= ndn::MAX_NDN_PACKET_SIZE) {
     NFD_LOG_FACE_ERROR("Failed to parse incoming packet or packet too large to process");
     this->setState(TransportState::FAILED);
     doClose();
     return;
   }
 
-  if (offset > 0) {
-    if (offset != m_receiveBufferSize) {
-      std::copy(m_receiveBuffer + offset, m_receiveBuffer + m_receiveBufferSize, m_receiveBuffer);
-      m_receiveBufferSize -= offset;
+  if (m_receiveBegin == m_receiveEnd && m_receiveBuffer.use_count() == 1) {
+    // the chunk is fully consumed and no Block references it, start over from its beginning
+    m_receiveBegin = m_receiveEnd = 0;
+  }
+  else if (m_receiveBuffer->size() - m_receiveBegin < ndn::MAX_NDN_PACKET_SIZE) {
+    // the next packet may not fit, so move the remaining octets to the beginning of a chunk;
+    // the current chunk can be overwritten only if no Block references it
+    if (m_receiveBuffer.use_count() > 1) {
+      auto chunk = make_shared<ndn::Buffer>(RECEIVE_CHUNK_SIZE);
+      std::copy(m_receiveBuffer->begin() + m_receiveBegin, m_receiveBuffer->begin() + m_receiveEnd,
+                chunk->begin());
+      m_receiveBuffer = std::move(chunk);
     }
     else {
-      m_receiveBufferSize = 0;
+      std::copy(m_receiveBuffer->begin() + m_receiveBegin, m_receiveBuffer->begin() + m_receiveEnd,
+                m_receiveBuffer->begin());
     }
+    m_receiveEnd -= m_receiveBegin;
+    m_receiveBegin = 0;
   }
 
   startReceive();
@@ -315,23 +397,27 @@ template<class T>
 void
 StreamTransport<T>::resetReceiveBuffer()
 {
-  m_receiveBufferSize = 0;
+  if (m_receiveBuffer.use_count() > 1) {
+    m_receiveBuffer = make_shared<ndn::Buffer>(RECEIVE_CHUNK_SIZE);
+  }
+  m_receiveBegin = 0;
+  m_receiveEnd = 0;
 }
 
 template<class T>
 void
 StreamTransport<T>::resetSendQueue()
 {
-  std::queue<Block> emptyQueue;
-  std::swap(emptyQueue, m_sendQueue);
-  m_sendQueueBytes = 0;
+  m_sendQueue.clear();
+  m_sendingPackets.clear();
+  m_sendingBytes = 0;
 }
 
 template<class T>
 size_t
 StreamTransport<T>::getSendQueueBytes() const
 {
-  return m_sendQueueBytes;
+  return m_sendQueue.getBytes() + m_sendingBytes;
 }
 
 } // namespace nfd::face
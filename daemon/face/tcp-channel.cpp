@@ -38,12 +38,14 @@ NFD_LOG_INIT(TcpChannel);
 namespace ip = boost::asio::ip;
 
 TcpChannel::TcpChannel(const tcp::Endpoint& localEndpoint, bool wantCongestionMarking,
-                       DetermineFaceScopeFromAddress determineFaceScope)
+                       DetermineFaceScopeFromAddress determineFaceScope,
+                       const CoDelQueue::Options& sendQueueOptions)
   : m_localEndpoint(localEndpoint)
   , m_acceptor(getGlobalIoService())
   , m_socket(getGlobalIoService())
   , m_wantCongestionMarking(wantCongestionMarking)
   , m_determineFaceScope(std::move(determineFaceScope))
+  , m_sendQueueOptions(sendQueueOptions)
 {
   setUri(FaceUri(m_localEndpoint));
   NFD_LOG_CHAN_INFO("Creating channel");
@@ -137,7 +139,8 @@ TcpChannel::createFace(ip::tcp::socket&& socket,
     auto linkService = make_unique<GenericLinkService>(options);
     auto faceScope = m_determineFaceScope(socket.local_endpoint().address(),
                                           socket.remote_endpoint().address());
-    auto transport = make_unique<TcpTransport>(std::move(socket), params.persistency, faceScope);
+    auto transport = make_unique<TcpTransport>(std::move(socket), params.persistency, faceScope,
+                                               m_sendQueueOptions);
     face = make_shared<Face>(std::move(linkService), std::move(transport));
     face->setChannel(weak_from_this());
 
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FACE_TCP_CHANNEL_HPP
 
 #include "channel.hpp"
+#include "codel-queue.hpp"
 
 #include <boost/asio/ip/tcp.hpp>
 
@@ -56,7 +57,8 @@ public:
    * one needs to explicitly call TcpChannel::listen method.
    */
   TcpChannel(const tcp::Endpoint& localEndpoint, bool wantCongestionMarking,
-             DetermineFaceScopeFromAddress determineFaceScope);
+             DetermineFaceScopeFromAddress determineFaceScope,
+             const CoDelQueue::Options& sendQueueOptions = {});
 
   bool
   isListening() const final
@@ -131,6 +133,7 @@ private:
   std::map<tcp::Endpoint, shared_ptr<Face>> m_channelFaces;
   bool m_wantCongestionMarking;
   DetermineFaceScopeFromAddress m_determineFaceScope;
+  CoDelQueue::Options m_sendQueueOptions;
 };
 
 } // namespace nfd::face
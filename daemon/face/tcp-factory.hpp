@@ -74,6 +74,7 @@ private:
 
 private:
   bool m_wantCongestionMarking = false;
+  CoDelQueue::Options m_sendQueueOptions;
   std::map<tcp::Endpoint, shared_ptr<TcpChannel>> m_channels;
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
@@ -37,8 +37,9 @@ NFD_LOG_MEMBER_INIT_SPECIALIZED(StreamTransport<boost::asio::ip::tcp>, TcpTransp
 
 TcpTransport::TcpTransport(protocol::socket&& socket,
                            ndn::nfd::FacePersistency persistency,
-                           ndn::nfd::FaceScope faceScope)
-  : StreamTransport(std::move(socket))
+                           ndn::nfd::FaceScope faceScope,
+                           const CoDelQueue::Options& sendQueueOptions)
+  : StreamTransport(std::move(socket), sendQueueOptions)
   , m_remoteEndpoint(m_socket.remote_endpoint())
   , m_nextReconnectWait(INITIAL_RECONNECT_DELAY)
 {
@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "token-bucket-shaper.hpp"
+
+#include <cmath>
+
+namespace nfd::face {
+
+TokenBucketShaper::TokenBucketShaper(const Options& options)
+  : m_options(options)
+  , m_byteTokens(options.byteBurst)
+  , m_packetTokens(options.packetBurst)
+  , m_lastRefill(time::steady_clock::now())
+{
+}
+
+void
+TokenBucketShaper::setOptions(const Options& options)
+{
+  refill();
+  m_options = options;
+  m_byteTokens = std::min<double>(m_byteTokens, m_options.byteBurst);
+  m_packetTokens = std::min<double>(m_packetTokens, m_options.packetBurst);
+}
+
+void
+TokenBucketShaper::refill()
+{
+  auto now = time::steady_clock::now();
+  double elapsed = time::nanoseconds(now - m_lastRefill).count() / 1e9;
+  m_lastRefill = now;
+
+  if (m_options.byteRate > 0) {
+    m_byteTokens = std::min<double>(m_byteTokens + elapsed * m_options.byteRate, m_options.byteBurst);
+  }
+  if (m_options.packetRate > 0) {
+    m_packetTokens = std::min<double>(m_packetTokens + elapsed * m_options.packetRate,
+                                      m_options.packetBurst);
+  }
+}
+
+bool
+TokenBucketShaper::canSend(size_t size)
+{
+  refill();
+  // a packet larger than the bucket depth is allowed to leave the bucket in debt
+  return (m_options.byteRate == 0 ||
+          m_byteTokens >= std::min<double>(size, m_options.byteBurst)) &&
+         (m_options.packetRate == 0 || m_packetTokens >= 1.0);
+}
+
+void
+TokenBucketShaper::consume(size_t size)
+{
+  if (m_options.byteRate > 0) {
+    m_byteTokens -= size;
+  }
+  if (m_options.packetRate > 0) {
+    m_packetTokens -= 1.0;
+  }
+}
+
+time::nanoseconds
+TokenBucketShaper::getDelay(size_t size)
+{
+  refill();
+
+  double wait = 0.0;
+  if (m_options.byteRate > 0) {
+    double needed = std::min<double>(size, m_options.byteBurst) - m_byteTokens;
+    wait = std::max(wait, needed / m_options.byteRate);
+  }
+  if (m_options.packetRate > 0) {
+    wait = std::max(wait, (1.0 - m_packetTokens) / m_options.packetRate);
+  }
+
+  // round up to avoid waking up just before the tokens are available
+  return time::nanoseconds(static_cast<time::nanoseconds::rep>(std::ceil(wait * 1e9)));
+}
+
+} // namespace nfd::face
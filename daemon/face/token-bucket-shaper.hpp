@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FACE_TOKEN_BUCKET_SHAPER_HPP
+#define NFD_DAEMON_FACE_TOKEN_BUCKET_SHAPER_HPP
+
+#include "core/common.hpp"
+
+namespace nfd::face {
+
+/**
+ * \brief Decides when outgoing packets conform to a rate limit, with a pair of token buckets.
+ *
+ * One bucket is filled with octets at Options::byteRate, the other with packets at
+ * Options::packetRate. A packet conforms if both buckets hold enough tokens for it.
+ *
+ * TokenBucketShaper does not hold packets itself: the owner keeps nonconforming packets in its
+ * own queue, and sends them after getDelay() has elapsed.
+ */
+class TokenBucketShaper : noncopyable
+{
+public:
+  /** \brief %Options that control the behavior of TokenBucketShaper.
+   */
+  struct Options
+  {
+    /** \brief Sustained rate in octets per second; zero means unlimited.
+     */
+    uint64_t byteRate = 0;
+
+    /** \brief Sustained rate in packets per second; zero means unlimited.
+     */
+    uint64_t packetRate = 0;
+
+    /** \brief Depth of the octet bucket, i.e., the largest burst sent at line rate.
+     */
+    size_t byteBurst = 65536;
+
+    /** \brief Depth of the packet bucket.
+     */
+    size_t packetBurst = 32;
+
+    /** \brief Maximum number of octets that the owner holds while waiting for tokens.
+     */
+    size_t queueCapacity = 262144;
+
+    /** \brief Returns whether at least one rate limit is configured.
+     */
+    bool
+    isEnabled() const
+    {
+      return byteRate > 0 || packetRate > 0;
+    }
+  };
+
+  explicit
+  TokenBucketShaper(const Options& options = {});
+
+  const Options&
+  getOptions() const
+  {
+    return m_options;
+  }
+
+  /** \brief Set options for the shaper.
+   *
+   *  Tokens in excess of the new bucket depths are discarded.
+   */
+  void
+  setOptions(const Options& options);
+
+  /** \brief Returns whether a packet of \p size octets may be sent now.
+   */
+  bool
+  canSend(size_t size);
+
+  /** \brief Takes the tokens for a packet of \p size octets.
+   *
+   *  A packet larger than the depth of the octet bucket leaves the bucket in debt.
+   */
+  void
+  consume(size_t size);
+
+  /** \brief Returns the time until a packet of \p size octets may be sent.
+   */
+  time::nanoseconds
+  getDelay(size_t size);
+
+private:
+  void
+  refill();
+
+private:
+  Options m_options;
+  double m_byteTokens;
+  double m_packetTokens;
+  time::steady_clock::time_point m_lastRefill;
+};
+
+} // namespace nfd::face
+
+#endif // NFD_DAEMON_FACE_TOKEN_BUCKET_SHAPER_HPP
@@ -84,6 +84,14 @@ public:
    *  This counter is increased only if transport is UP.
    */
   ByteCounter nOutBytes;
+
+  /** \brief Count of outgoing packets dropped by the send queue of the transport.
+   *
+   *  A packet is dropped when it does not fit into a bounded send queue, or when it is
+   *  discarded by active queue management. Dropped packets are still counted in
+   *  nOutPackets and nOutBytes.
+   */
+  PacketCounter nOutQueueDrops;
 };
 
 /**
@@ -319,6 +327,23 @@ public: // dynamic properties
     return QUEUE_UNSUPPORTED;
   }
 
+  /**
+   * \brief Signals when the send queue of the transport becomes empty.
+   *
+   * Only emitted by transports that maintain their own send queue.
+   */
+  signal::Signal<Transport> afterSendQueueDrained;
+
+  /**
+   * \brief Returns whether afterSendQueueDrained will be emitted without any further send,
+   *        because the transport still has packets of its own send queue to write.
+   */
+  virtual bool
+  isSendQueueDrainPending() const
+  {
+    return false;
+  }
+
 protected: // upper interface to be invoked by subclass
   /**
    * \brief Pass a received link-layer packet to the upper layer for further processing.
@@ -329,6 +354,15 @@ protected: // upper interface to be invoked by subclass
   void
   receive(const Block& packet, const EndpointId& endpoint = {});
 
+  /**
+   * \brief Emit afterSendQueueDrained.
+   */
+  void
+  notifySendQueueDrained()
+  {
+    afterSendQueueDrained();
+  }
+
 protected: // properties to be set by subclass
   void
   setLocalUri(const FaceUri& uri) noexcept
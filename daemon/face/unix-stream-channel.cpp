@@ -37,12 +37,14 @@ namespace nfd::face {
 NFD_LOG_INIT(UnixStreamChannel);
 
 UnixStreamChannel::UnixStreamChannel(const unix_stream::Endpoint& endpoint,
-                                     bool wantCongestionMarking)
+                                     bool wantCongestionMarking,
+                                     const CoDelQueue::Options& sendQueueOptions)
   : m_endpoint(endpoint)
   , m_acceptor(getGlobalIoService())
   , m_socket(getGlobalIoService())
   , m_size(0)
   , m_wantCongestionMarking(wantCongestionMarking)
+  , m_sendQueueOptions(sendQueueOptions)
 {
   setUri(FaceUri(m_endpoint));
   NFD_LOG_CHAN_INFO("Creating channel");
@@ -134,7 +136,7 @@ UnixStreamChannel::handleAccept(const boost::system::error_code& error,
   GenericLinkService::Options options;
   options.allowCongestionMarking = m_wantCongestionMarking;
   auto linkService = make_unique<GenericLinkService>(options);
-  auto transport = make_unique<UnixStreamTransport>(std::move(m_socket));
+  auto transport = make_unique<UnixStreamTransport>(std::move(m_socket), m_sendQueueOptions);
   auto face = make_shared<Face>(std::move(linkService), std::move(transport));
   face->setChannel(weak_from_this());
 
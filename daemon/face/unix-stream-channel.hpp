@@ -27,6 +27,7 @@
 #define NFD_DAEMON_FACE_UNIX_STREAM_CHANNEL_HPP
 
 #include "channel.hpp"
+#include "codel-queue.hpp"
 
 #include <boost/asio/local/stream_protocol.hpp>
 
@@ -60,7 +61,8 @@ public:
    * To enable creation of faces upon incoming connections, one
    * needs to explicitly call UnixStreamChannel::listen method.
    */
-  UnixStreamChannel(const unix_stream::Endpoint& endpoint, bool wantCongestionMarking);
+  UnixStreamChannel(const unix_stream::Endpoint& endpoint, bool wantCongestionMarking,
+                    const CoDelQueue::Options& sendQueueOptions = {});
 
   ~UnixStreamChannel() final;
 
@@ -112,6 +114,7 @@ private:
   boost::asio::local::stream_protocol::socket m_socket;
   size_t m_size;
   bool m_wantCongestionMarking;
+  CoDelQueue::Options m_sendQueueOptions;
 };
 
 } // namespace nfd::face
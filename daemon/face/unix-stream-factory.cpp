@@ -50,6 +50,7 @@ UnixStreamFactory::doProcessConfig(OptionalConfigSection configSection,
   // }
 
   m_wantCongestionMarking = context.generalConfig.wantCongestionMarking;
+  m_sendQueueOptions = context.generalConfig.streamSendQueueOptions;
 
   if (!configSection) {
     if (!context.isDryRun && !m_channels.empty()) {
@@ -97,7 +98,7 @@ UnixStreamFactory::createChannel(const std::string& unixSocketPath)
   if (it != m_channels.end())
     return it->second;
 
-  auto channel = make_shared<UnixStreamChannel>(endpoint, m_wantCongestionMarking);
+  auto channel = make_shared<UnixStreamChannel>(endpoint, m_wantCongestionMarking, m_sendQueueOptions);
   m_channels[endpoint] = channel;
   return channel;
 }
@@ -64,6 +64,7 @@ private:
 
 private:
   bool m_wantCongestionMarking = false;
+  CoDelQueue::Options m_sendQueueOptions;
   std::map<unix_stream::Endpoint, shared_ptr<UnixStreamChannel>> m_channels;
 };
 
@@ -29,8 +29,9 @@ namespace nfd::face {
 
 NFD_LOG_MEMBER_INIT_SPECIALIZED(StreamTransport<boost::asio::local::stream_protocol>, UnixStreamTransport);
 
-UnixStreamTransport::UnixStreamTransport(protocol::socket&& socket)
-  : StreamTransport(std::move(socket))
+UnixStreamTransport::UnixStreamTransport(protocol::socket&& socket,
+                                         const CoDelQueue::Options& sendQueueOptions)
+  : StreamTransport(std::move(socket), sendQueueOptions)
 {
   static_assert(
     std::is_same_v<std::remove_cv_t<protocol::socket::native_handle_type>, int>,
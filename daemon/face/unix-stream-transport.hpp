@@ -45,7 +45,7 @@ class UnixStreamTransport final : public StreamTransport<boost::asio::local::str
 {
 public:
   explicit
-  UnixStreamTransport(protocol::socket&& socket);
+  UnixStreamTransport(protocol::socket&& socket, const CoDelQueue::Options& sendQueueOptions = {});
 };
 
 } // namespace nfd::face
@@ -189,7 +189,8 @@ AccessStrategy::multicast(const Interest& interest, const Face& inFace,
                           FaceId exceptFace)
 {
   size_t nSent = 0;
-  for (const auto& nexthop : fibEntry.getNextHops()) {
+  auto nexthops = fibEntry.getNextHops();
+  for (const auto& nexthop : *nexthops) {
     Face& outFace = nexthop.getFace();
     if (&outFace == &inFace || outFace.getId() == exceptFace ||
         wouldViolateScope(inFace, interest, outFace)) {
@@ -55,15 +55,14 @@ findDuplicateNonce(const pit::Entry& pitEntry, Interest::Nonce nonce, const Face
 {
   int dnw = DUPLICATE_NONCE_NONE;
 
-  for (const pit::InRecord& inRecord : pitEntry.getInRecords()) {
-    if (inRecord.getLastNonce() == nonce) {
-      if (&inRecord.getFace() == &face) {
-        dnw |= DUPLICATE_NONCE_IN_SAME;
-      }
-      else {
-        dnw |= DUPLICATE_NONCE_IN_OTHER;
-      }
-    }
+  // both lookups are constant time when the PIT entry has many in-records
+  auto inRecord = pitEntry.getInRecord(face);
+  bool isInSame = inRecord != pitEntry.in_end() && inRecord->getLastNonce() == nonce;
+  if (isInSame) {
+    dnw |= DUPLICATE_NONCE_IN_SAME;
+  }
+  if (pitEntry.countInRecordsWithNonce(nonce) > (isInSame ? 1 : 0)) {
+    dnw |= DUPLICATE_NONCE_IN_OTHER;
   }
 
   for (const pit::OutRecord& outRecord : pitEntry.getOutRecords()) {
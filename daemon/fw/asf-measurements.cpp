@@ -24,25 +24,17 @@
  */
 
 #include "asf-measurements.hpp"
-#include "common/global.hpp"
 
 namespace nfd::fw::asf {
 
 time::nanoseconds
-FaceInfo::scheduleTimeout(const Name& interestName, scheduler::EventCallback cb)
+FaceInfo::scheduleTimeout(const pit::Entry& pitEntry, time::steady_clock::time_point now)
 {
-  BOOST_ASSERT(!m_timeoutEvent);
-  m_lastInterestName = interestName;
-  m_timeoutEvent = getScheduler().schedule(m_rttEstimator.getEstimatedRto(), std::move(cb));
-  return m_rttEstimator.getEstimatedRto();
-}
-
-void
-FaceInfo::cancelTimeout(const Name& prefix)
-{
-  if (m_lastInterestName.isPrefixOf(prefix)) {
-    m_timeoutEvent.cancel();
-  }
+  BOOST_ASSERT(!isTimeoutScheduled());
+  auto rto = m_rttEstimator.getEstimatedRto();
+  m_timeoutDeadline = now + rto;
+  m_timeoutNameHash = name_tree::computeHash(pitEntry.getName());
+  return rto;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -51,26 +43,43 @@ FaceInfo::cancelTimeout(const Name& prefix)
 FaceInfo*
 NamespaceInfo::getFaceInfo(FaceId faceId)
 {
-  auto it = m_fiMap.find(faceId);
-  return it != m_fiMap.end() ? &it->second : nullptr;
+  auto it = std::find_if(m_faceInfos.begin(), m_faceInfos.end(),
+                         [faceId] (const auto& p) { return p.first == faceId; });
+  if (it == m_faceInfos.end() || it->second.m_expiry <= time::steady_clock::now()) {
+    return nullptr;
+  }
+  return &it->second;
 }
 
 FaceInfo&
 NamespaceInfo::getOrCreateFaceInfo(FaceId faceId)
 {
-  auto [it, isNew] = m_fiMap.try_emplace(faceId, m_rttEstimatorOpts);
-  auto& faceInfo = it->second;
-  if (isNew) {
-    extendFaceInfoLifetime(faceInfo, faceId);
+  auto now = time::steady_clock::now();
+  auto it = std::find_if(m_faceInfos.begin(), m_faceInfos.end(),
+                         [faceId] (const auto& p) { return p.first == faceId; });
+  if (it != m_faceInfos.end() && it->second.m_expiry > now) {
+    return it->second;
+  }
+
+  if (it != m_faceInfos.end()) {
+    // expired, start over
+    it->second = FaceInfo(m_rttEstimatorOpts);
+  }
+  else {
+    // purge expired entries before adding a new one
+    m_faceInfos.erase(std::remove_if(m_faceInfos.begin(), m_faceInfos.end(),
+                                     [now] (const auto& p) { return p.second.m_expiry <= now; }),
+                      m_faceInfos.end());
+    it = m_faceInfos.insert(m_faceInfos.end(), {faceId, FaceInfo(m_rttEstimatorOpts)});
   }
-  return faceInfo;
+  extendFaceInfoLifetime(it->second);
+  return it->second;
 }
 
 void
-NamespaceInfo::extendFaceInfoLifetime(FaceInfo& info, FaceId faceId)
+NamespaceInfo::extendFaceInfoLifetime(FaceInfo& info)
 {
-  info.m_measurementExpiration = getScheduler().schedule(AsfMeasurements::MEASUREMENTS_LIFETIME,
-                                                         [=] { m_fiMap.erase(faceId); });
+  info.m_expiry = time::steady_clock::now() + AsfMeasurements::MEASUREMENTS_LIFETIME;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
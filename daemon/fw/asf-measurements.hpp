@@ -28,15 +28,20 @@
 
 #include "fw/strategy-info.hpp"
 #include "table/measurements-accessor.hpp"
+#include "table/name-tree-hashtable.hpp"
+#include "table/pit-entry.hpp"
 
 #include <ndn-cxx/util/rtt-estimator.hpp>
 
-#include <unordered_map>
-
 namespace nfd::fw::asf {
 
 /** \brief Strategy information for each face in a namespace
-*/
+ *
+ *  At most one forwarded Interest per face and namespace is tracked for timeout at any time.
+ *  The tracked Interest is identified by the hash of its name, and its deadline is checked
+ *  lazily, so that tracking requires neither a copy of the Interest name nor a scheduler event,
+ *  and does not keep the PIT entry alive.
+ */
 class FaceInfo
 {
 public:
@@ -49,14 +54,45 @@ public:
   bool
   isTimeoutScheduled() const
   {
-    return !!m_timeoutEvent;
+    return m_timeoutDeadline != time::steady_clock::time_point::max();
   }
 
+  /** \brief Starts tracking the timeout of an Interest forwarded to this face.
+   *  \param pitEntry PIT entry of the forwarded Interest
+   *  \param now the time at which the Interest was forwarded
+   *  \return the retransmission timeout
+   */
   time::nanoseconds
-  scheduleTimeout(const Name& interestName, scheduler::EventCallback cb);
+  scheduleTimeout(const pit::Entry& pitEntry, time::steady_clock::time_point now);
+
+  /** \brief Returns whether the tracked Interest has not been satisfied before its deadline.
+   */
+  bool
+  isTimeoutExpired(time::steady_clock::time_point now) const
+  {
+    return m_timeoutDeadline <= now;
+  }
 
+  /** \brief Stops tracking the timeout.
+   */
   void
-  cancelTimeout(const Name& prefix);
+  cancelTimeout()
+  {
+    m_timeoutDeadline = time::steady_clock::time_point::max();
+  }
+
+  /** \brief Stops tracking the timeout if the tracked Interest has the name of \p pitEntry.
+   *  \note An expired deadline must be handled before this is invoked, so that it is not
+   *        mistaken for a satisfied Interest.
+   */
+  void
+  cancelTimeout(const pit::Entry& pitEntry)
+  {
+    if (isTimeoutScheduled() &&
+        m_timeoutNameHash == name_tree::computeHash(pitEntry.getName())) {
+      cancelTimeout();
+    }
+  }
 
   void
   recordRtt(time::nanoseconds rtt)
@@ -66,10 +102,10 @@ public:
   }
 
   void
-  recordTimeout(const Name& interestName)
+  recordTimeout()
   {
     m_lastRtt = RTT_TIMEOUT;
-    cancelTimeout(interestName);
+    cancelTimeout();
   }
 
   bool
@@ -109,15 +145,15 @@ public:
 private:
   ndn::util::RttEstimator m_rttEstimator;
   time::nanoseconds m_lastRtt = RTT_NO_MEASUREMENT;
-  Name m_lastInterestName;
   size_t m_nTimeouts = 0;
 
-  // Timeout associated with measurement
-  scheduler::ScopedEventId m_measurementExpiration;
+  // Expiration time of the measurement
+  time::steady_clock::time_point m_expiry;
   friend class NamespaceInfo;
 
-  // RTO associated with Interest
-  scheduler::ScopedEventId m_timeoutEvent;
+  // Deadline of the tracked Interest and the hash of its name
+  time::steady_clock::time_point m_timeoutDeadline = time::steady_clock::time_point::max();
+  name_tree::HashValue m_timeoutNameHash = 0;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -140,14 +176,19 @@ public:
   {
   }
 
+  /** \brief Returns the unexpired FaceInfo of \p faceId, or nullptr if there is none.
+   */
   FaceInfo*
   getFaceInfo(FaceId faceId);
 
+  /** \brief Returns the FaceInfo of \p faceId, creating it if necessary.
+   *  \warning This may invalidate pointers to FaceInfo of other faces in this namespace.
+   */
   FaceInfo&
   getOrCreateFaceInfo(FaceId faceId);
 
   void
-  extendFaceInfoLifetime(FaceInfo& info, FaceId faceId);
+  extendFaceInfoLifetime(FaceInfo& info);
 
   bool
   isProbingDue() const
@@ -174,7 +215,8 @@ public:
   }
 
 private:
-  std::unordered_map<FaceId, FaceInfo> m_fiMap;
+  /// a namespace usually has few nexthops, so a linear search is faster than a hash table
+  std::vector<std::pair<FaceId, FaceInfo>> m_faceInfos;
   shared_ptr<const ndn::util::RttEstimator::Options> m_rttEstimatorOpts;
   bool m_isProbingDue = false;
   bool m_isFirstProbeScheduled = false;
@@ -65,7 +65,8 @@ ProbingModule::getFaceToProbe(const Face& inFace, const Interest& interest,
 
   // Put eligible faces into rankedFaces. If a face does not have an RTT measurement,
   // immediately pick the face for probing
-  for (const auto& hop : fibEntry.getNextHops()) {
+  auto nexthops = fibEntry.getNextHops();
+  for (const auto& hop : *nexthops) {
     Face& hopFace = hop.getFace();
 
     // Don't send probe Interest back to the incoming face or use the same face
@@ -50,12 +50,19 @@ AsfStrategy::AsfStrategy(Forwarder& forwarder, const Name& name)
                                                                       m_probing.getProbingInterval().count());
   m_probing.setProbingInterval(time::milliseconds(probingInterval));
   m_nMaxTimeouts = params.getOrDefault<size_t>("max-timeouts", m_nMaxTimeouts);
+  m_pacer = InterestPacer::construct(params, getMeasurements(), getFaceTable(),
+    [this] (const Interest& interest, Face& egress, const shared_ptr<pit::Entry>& pitEntry) {
+      return this->sendInterest(interest, egress, pitEntry);
+    });
 
   this->setInstanceName(makeInstanceName(name, getStrategyName()));
 
   NDN_LOG_DEBUG(*m_retxSuppression);
   NFD_LOG_DEBUG("probing-interval=" << m_probing.getProbingInterval()
                 << " max-timeouts=" << m_nMaxTimeouts);
+  if (m_pacer != nullptr) {
+    NFD_LOG_DEBUG(*m_pacer);
+  }
 }
 
 const Name&
@@ -108,9 +115,9 @@ AsfStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoint&
 
   // If all eligible faces have been used (i.e., they all have a pending out-record),
   // choose the nexthop with the earliest out-record
-  const auto& nexthops = fibEntry.getNextHops();
-  auto it = findEligibleNextHopWithEarliestOutRecord(ingress.face, interest, nexthops, pitEntry);
-  if (it == nexthops.end()) {
+  auto nexthops = fibEntry.getNextHops();
+  auto it = findEligibleNextHopWithEarliestOutRecord(ingress.face, interest, *nexthops, pitEntry);
+  if (it == nexthops->end()) {
     NFD_LOG_DEBUG(interest << " retx-interest from=" << ingress << " no eligible nexthop");
     return;
   }
@@ -122,9 +129,10 @@ AsfStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoint&
   }
   else {
     NFD_LOG_DEBUG(interest << " retx-interest from=" << ingress << " retry-to=" << outFace.getId());
-    // sendInterest() is used here instead of forwardInterest() because the measurements info
-    // were already attached to this face in the previous forwarding
-    auto* outRecord = sendInterest(interest, outFace, pitEntry);
+    // sendOrPaceInterest() is used here instead of forwardInterest() because the measurements
+    // info were already attached to this face in the previous forwarding
+    pit::OutRecord* outRecord = nullptr;
+    sendOrPaceInterest(interest, outFace, fibEntry, pitEntry, outRecord);
     if (outRecord && suppressResult == RetxSuppressionResult::FORWARD) {
       m_retxSuppression->incrementIntervalForOutRecord(*outRecord);
     }
@@ -135,6 +143,10 @@ void
 AsfStrategy::beforeSatisfyInterest(const Data& data, const FaceEndpoint& ingress,
                                    const shared_ptr<pit::Entry>& pitEntry)
 {
+  if (m_pacer != nullptr) {
+    m_pacer->afterReceiveData(data, ingress.face, *pitEntry);
+  }
+
   NamespaceInfo* namespaceInfo = m_measurements.getNamespaceInfo(pitEntry->getName());
   if (namespaceInfo == nullptr) {
     NFD_LOG_DEBUG(pitEntry->getName() << " data from=" << ingress << " no-measurements");
@@ -148,21 +160,28 @@ AsfStrategy::beforeSatisfyInterest(const Data& data, const FaceEndpoint& ingress
     return;
   }
 
+  // Data arriving after the deadline does not cancel the timeout, which a timer would have
+  // counted at the deadline
+  auto now = time::steady_clock::now();
+  if (faceInfo->isTimeoutExpired(now)) {
+    onTimeoutOrNack(pitEntry->getName(), *namespaceInfo, *faceInfo, ingress.face.getId(), false);
+  }
+
   auto outRecord = pitEntry->getOutRecord(ingress.face);
   if (outRecord == pitEntry->out_end()) {
     NFD_LOG_DEBUG(pitEntry->getName() << " data from=" << ingress << " no-out-record");
   }
   else {
-    faceInfo->recordRtt(time::steady_clock::now() - outRecord->getLastRenewed());
+    faceInfo->recordRtt(now - outRecord->getLastRenewed());
     NFD_LOG_DEBUG(pitEntry->getName() << " data from=" << ingress
                   << " rtt=" << faceInfo->getLastRtt() << " srtt=" << faceInfo->getSrtt());
   }
 
   // Extend lifetime for measurements associated with Face
-  namespaceInfo->extendFaceInfoLifetime(*faceInfo, ingress.face.getId());
+  namespaceInfo->extendFaceInfoLifetime(*faceInfo);
   // Extend PIT entry timer to allow slower probes to arrive
   this->setExpiryTimer(pitEntry, 50_ms);
-  faceInfo->cancelTimeout(data.getName());
+  faceInfo->cancelTimeout(*pitEntry);
 }
 
 void
@@ -170,7 +189,28 @@ AsfStrategy::afterReceiveNack(const lp::Nack& nack, const FaceEndpoint& ingress,
                               const shared_ptr<pit::Entry>& pitEntry)
 {
   NFD_LOG_DEBUG(nack.getInterest() << " nack from=" << ingress << " reason=" << nack.getReason());
-  onTimeoutOrNack(pitEntry->getName(), ingress.face.getId(), true);
+
+  if (m_pacer != nullptr) {
+    m_pacer->afterReceiveNack(nack, ingress.face, *pitEntry);
+  }
+
+  NamespaceInfo* namespaceInfo = m_measurements.getNamespaceInfo(pitEntry->getName());
+  if (namespaceInfo == nullptr) {
+    NFD_LOG_TRACE(pitEntry->getName() << " no-measurements");
+    return;
+  }
+
+  FaceInfo* faceInfo = namespaceInfo->getFaceInfo(ingress.face.getId());
+  if (faceInfo == nullptr) {
+    NFD_LOG_TRACE(pitEntry->getName() << " FaceInfo id=" << ingress.face.getId() << " not found");
+    return;
+  }
+
+  // a timeout that expired before the Nack is counted separately, as a timer would have done
+  if (faceInfo->isTimeoutExpired(time::steady_clock::now())) {
+    onTimeoutOrNack(pitEntry->getName(), *namespaceInfo, *faceInfo, ingress.face.getId(), false);
+  }
+  onTimeoutOrNack(pitEntry->getName(), *namespaceInfo, *faceInfo, ingress.face.getId(), true);
 }
 
 pit::OutRecord*
@@ -180,19 +220,24 @@ AsfStrategy::forwardInterest(const Interest& interest, Face& outFace, const fib:
   const auto& interestName = interest.getName();
   auto faceId = outFace.getId();
 
-  auto* outRecord = sendInterest(interest, outFace, pitEntry);
+  pit::OutRecord* outRecord = nullptr;
+  if (!sendOrPaceInterest(interest, outFace, fibEntry, pitEntry, outRecord)) {
+    NFD_LOG_DEBUG(interestName << " to=" << faceId << " congested");
+    return nullptr;
+  }
 
-  FaceInfo& faceInfo = m_measurements.getOrCreateFaceInfo(fibEntry, interestName, faceId);
+  NamespaceInfo& namespaceInfo = m_measurements.getOrCreateNamespaceInfo(fibEntry, interestName);
+  FaceInfo& faceInfo = namespaceInfo.getOrCreateFaceInfo(faceId);
 
   // Refresh measurements since Face is being used for forwarding
-  NamespaceInfo& namespaceInfo = m_measurements.getOrCreateNamespaceInfo(fibEntry, interestName);
-  namespaceInfo.extendFaceInfoLifetime(faceInfo, faceId);
+  namespaceInfo.extendFaceInfoLifetime(faceInfo);
 
+  auto now = time::steady_clock::now();
+  if (faceInfo.isTimeoutExpired(now)) {
+    onTimeoutOrNack(interestName, namespaceInfo, faceInfo, faceId, false);
+  }
   if (!faceInfo.isTimeoutScheduled()) {
-    auto timeout = faceInfo.scheduleTimeout(interestName,
-                                            [this, name = interestName, faceId] {
-                                              onTimeoutOrNack(name, faceId, false);
-                                            });
+    auto timeout = faceInfo.scheduleTimeout(*pitEntry, now);
     NFD_LOG_TRACE("Scheduled timeout for " << fibEntry.getPrefix() << " to=" << faceId
                   << " in " << time::duration_cast<time::milliseconds>(timeout));
   }
@@ -200,6 +245,31 @@ AsfStrategy::forwardInterest(const Interest& interest, Face& outFace, const fib:
   return outRecord;
 }
 
+bool
+AsfStrategy::sendOrPaceInterest(const Interest& interest, Face& outFace, const fib::Entry& fibEntry,
+                                const shared_ptr<pit::Entry>& pitEntry, pit::OutRecord*& outRecord)
+{
+  if (m_pacer == nullptr) {
+    outRecord = sendInterest(interest, outFace, pitEntry);
+    return true;
+  }
+
+  switch (m_pacer->send(interest, outFace, fibEntry, pitEntry)) {
+    case InterestPacer::Result::SENT: {
+      auto it = pitEntry->getOutRecord(outFace);
+      outRecord = it == pitEntry->out_end() ? nullptr : &*it;
+      return true;
+    }
+    case InterestPacer::Result::DELAYED:
+      outRecord = nullptr;
+      return true;
+    case InterestPacer::Result::CONGESTED:
+      break;
+  }
+  outRecord = nullptr;
+  return false;
+}
+
 void
 AsfStrategy::sendProbe(const Interest& interest, const FaceEndpoint& ingress, const Face& faceToUse,
                        const fib::Entry& fibEntry, const shared_ptr<pit::Entry>& pitEntry)
@@ -264,13 +334,23 @@ AsfStrategy::getBestFaceForForwarding(const Interest& interest, const Face& inFa
 {
   std::set<FaceStats, FaceStatsCompare> rankedFaces;
 
+  NamespaceInfo& namespaceInfo = m_measurements.getOrCreateNamespaceInfo(fibEntry, interest.getName());
   auto now = time::steady_clock::now();
-  for (const auto& nh : fibEntry.getNextHops()) {
+  auto nexthops = fibEntry.getNextHops();
+  for (const auto& nh : *nexthops) {
+    FaceId faceId = nh.getFace().getId();
+    FaceInfo* info = namespaceInfo.getFaceInfo(faceId);
+
+    // Timeouts are detected here rather than by a timer, before they can affect the ranking
+    // of this face or the choice of a face to probe
+    if (info != nullptr && info->isTimeoutExpired(now)) {
+      onTimeoutOrNack(interest.getName(), namespaceInfo, *info, faceId, false);
+    }
+
     if (!isNextHopEligible(inFace, interest, nh, pitEntry, !isInterestNew, now)) {
       continue;
     }
 
-    const FaceInfo* info = m_measurements.getFaceInfo(fibEntry, interest.getName(), nh.getFace().getId());
     if (info == nullptr) {
       rankedFaces.insert({&nh.getFace(), FaceInfo::RTT_NO_MEASUREMENT,
                           FaceInfo::RTT_NO_MEASUREMENT, nh.getCost()});
@@ -285,33 +365,21 @@ AsfStrategy::getBestFaceForForwarding(const Interest& interest, const Face& inFa
 }
 
 void
-AsfStrategy::onTimeoutOrNack(const Name& interestName, FaceId faceId, bool isNack)
+AsfStrategy::onTimeoutOrNack(const Name& interestName, NamespaceInfo& namespaceInfo,
+                             FaceInfo& faceInfo, FaceId faceId, bool isNack)
 {
-  NamespaceInfo* namespaceInfo = m_measurements.getNamespaceInfo(interestName);
-  if (namespaceInfo == nullptr) {
-    NFD_LOG_TRACE(interestName << " FibEntry has been removed since timeout scheduling");
-    return;
-  }
-
-  FaceInfo* fiPtr = namespaceInfo->getFaceInfo(faceId);
-  if (fiPtr == nullptr) {
-    NFD_LOG_TRACE(interestName << " FaceInfo id=" << faceId << " has been removed since timeout scheduling");
-    return;
-  }
-
-  auto& faceInfo = *fiPtr;
   size_t nTimeouts = faceInfo.getNTimeouts() + 1;
   faceInfo.setNTimeouts(nTimeouts);
 
   if (nTimeouts < m_nMaxTimeouts && !isNack) {
     NFD_LOG_TRACE(interestName << " face=" << faceId << " timeout-count=" << nTimeouts << " ignoring");
     // Extend lifetime for measurements associated with Face
-    namespaceInfo->extendFaceInfoLifetime(faceInfo, faceId);
-    faceInfo.cancelTimeout(interestName);
+    namespaceInfo.extendFaceInfoLifetime(faceInfo);
+    faceInfo.cancelTimeout();
   }
   else {
     NFD_LOG_TRACE(interestName << " face=" << faceId << " timeout-count=" << nTimeouts);
-    faceInfo.recordTimeout(interestName);
+    faceInfo.recordTimeout();
   }
 }
 
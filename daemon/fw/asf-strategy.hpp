@@ -29,6 +29,7 @@
 #include "strategy.hpp"
 #include "asf-measurements.hpp"
 #include "asf-probing-module.hpp"
+#include "interest-pacer.hpp"
 #include "retx-suppression-exponential.hpp"
 
 namespace nfd::fw {
@@ -41,6 +42,11 @@ namespace asf {
  *      Lixia Zhang, and Lan Wang, "An Experimental Investigation of Hyperbolic Routing
  *      with a Smart Forwarding Plane in NDN", NDN Technical Report NDN-0042, 2016.
  *      https://named-data.net/publications/techreports/ndn-0042-1-asf/
+ *
+ * If the `pacing~1` parameter is given, Interests are paced per upstream according to the
+ * congestion marks returned by that upstream (see InterestPacer). An Interest that cannot be
+ * forwarded within the maximum pacing delay is dropped without affecting the face's
+ * measurements, so that the consumer's retransmission can be sent to another nexthop.
  */
 class AsfStrategy : public Strategy
 {
@@ -69,6 +75,13 @@ private:
   forwardInterest(const Interest& interest, Face& outFace, const fib::Entry& fibEntry,
                   const shared_ptr<pit::Entry>& pitEntry);
 
+  /** \brief Sends \p interest through the pacer, if pacing is enabled.
+   *  \return whether the Interest has been sent or scheduled for sending
+   */
+  bool
+  sendOrPaceInterest(const Interest& interest, Face& outFace, const fib::Entry& fibEntry,
+                     const shared_ptr<pit::Entry>& pitEntry, pit::OutRecord*& outRecord);
+
   void
   sendProbe(const Interest& interest, const FaceEndpoint& ingress, const Face& faceToUse,
             const fib::Entry& fibEntry, const shared_ptr<pit::Entry>& pitEntry);
@@ -79,7 +92,8 @@ private:
                            bool isNewInterest = true);
 
   void
-  onTimeoutOrNack(const Name& interestName, FaceId faceId, bool isNack);
+  onTimeoutOrNack(const Name& interestName, NamespaceInfo& namespaceInfo, FaceInfo& faceInfo,
+                  FaceId faceId, bool isNack);
 
   void
   sendNoRouteNack(Face& face, const shared_ptr<pit::Entry>& pitEntry);
@@ -90,6 +104,7 @@ private:
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   std::unique_ptr<RetxSuppressionExponential> m_retxSuppression;
   ProbingModule m_probing;
+  std::unique_ptr<InterestPacer> m_pacer;
   size_t m_nMaxTimeouts = 3;
 };
 
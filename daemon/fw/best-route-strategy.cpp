@@ -25,6 +25,7 @@
 
 #include "best-route-strategy.hpp"
 #include "algorithm.hpp"
+#include "scope-prefix.hpp"
 #include "common/logger.hpp"
 
 namespace nfd::fw {
@@ -44,10 +45,17 @@ BestRouteStrategy::BestRouteStrategy(Forwarder& forwarder, const Name& name)
 
   StrategyParameters params = parseParameters(parsed.parameters);
   m_retxSuppression = RetxSuppressionExponential::construct(params);
+  m_pacer = InterestPacer::construct(params, getMeasurements(), getFaceTable(),
+    [this] (const Interest& interest, Face& egress, const shared_ptr<pit::Entry>& pitEntry) {
+      return this->sendInterest(interest, egress, pitEntry);
+    });
 
   this->setInstanceName(makeInstanceName(name, getStrategyName()));
 
   NDN_LOG_DEBUG(*m_retxSuppression);
+  if (m_pacer != nullptr) {
+    NFD_LOG_DEBUG(*m_pacer);
+  }
 }
 
 const Name&
@@ -68,16 +76,11 @@ BestRouteStrategy::afterReceiveInterest(const Interest& interest, const FaceEndp
   }
 
   const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
-  const fib::NextHopList& nexthops = fibEntry.getNextHops();
-  auto it = nexthops.end();
 
   if (suppression == RetxSuppressionResult::NEW) {
     // forward to nexthop with lowest cost except downstream
-    it = std::find_if(nexthops.begin(), nexthops.end(), [&] (const auto& nexthop) {
-      return isNextHopEligible(ingress.face, interest, nexthop, pitEntry);
-    });
-
-    if (it == nexthops.end()) {
+    Face* outFace = this->findNextHopForNewInterest(ingress.face, interest, fibEntry, pitEntry);
+    if (outFace == nullptr) {
       NFD_LOG_DEBUG(interest << " from=" << ingress << " noNextHop");
 
       lp::NackHeader nackHeader;
@@ -87,12 +90,15 @@ BestRouteStrategy::afterReceiveInterest(const Interest& interest, const FaceEndp
       return;
     }
 
-    Face& outFace = it->getFace();
-    NFD_LOG_DEBUG(interest << " from=" << ingress << " newPitEntry-to=" << outFace.getId());
-    this->sendInterest(interest, outFace, pitEntry);
+    NFD_LOG_DEBUG(interest << " from=" << ingress << " newPitEntry-to=" << outFace->getId());
+    this->forwardInterest(interest, *outFace, fibEntry, pitEntry, true);
     return;
   }
 
+  auto nexthopsPtr = fibEntry.getNextHops();
+  const fib::NextHopList& nexthops = *nexthopsPtr;
+  auto it = nexthops.end();
+
   // find an unused upstream with lowest cost except downstream
   it = std::find_if(nexthops.begin(), nexthops.end(),
                     [&, now = time::steady_clock::now()] (const auto& nexthop) {
@@ -101,7 +107,7 @@ BestRouteStrategy::afterReceiveInterest(const Interest& interest, const FaceEndp
 
   if (it != nexthops.end()) {
     Face& outFace = it->getFace();
-    this->sendInterest(interest, outFace, pitEntry);
+    this->forwardInterest(interest, outFace, fibEntry, pitEntry, false);
     NFD_LOG_DEBUG(interest << " from=" << ingress << " retransmit-unused-to=" << outFace.getId());
     return;
   }
@@ -113,16 +119,87 @@ BestRouteStrategy::afterReceiveInterest(const Interest& interest, const FaceEndp
   }
   else {
     Face& outFace = it->getFace();
-    this->sendInterest(interest, outFace, pitEntry);
+    this->forwardInterest(interest, outFace, fibEntry, pitEntry, false);
     NFD_LOG_DEBUG(interest << " from=" << ingress << " retransmit-retry-to=" << outFace.getId());
   }
 }
 
+Face*
+BestRouteStrategy::findNextHopForNewInterest(const Face& inFace, const Interest& interest,
+                                             const fib::Entry& fibEntry,
+                                             const shared_ptr<pit::Entry>& pitEntry)
+{
+  auto evaluate = [&] () -> Face* {
+    auto nexthopsPtr = fibEntry.getNextHops();
+    const fib::NextHopList& nexthops = *nexthopsPtr;
+    auto it = std::find_if(nexthops.begin(), nexthops.end(), [&] (const auto& nexthop) {
+      return isNextHopEligible(inFace, interest, nexthop, pitEntry);
+    });
+    return it == nexthops.end() ? nullptr : &it->getFace();
+  };
+
+  if (scope_prefix::LOCALHOST.isPrefixOf(interest.getName()) ||
+      scope_prefix::LOCALHOP.isPrefixOf(interest.getName())) {
+    // eligibility also depends on the Interest name, which is not part of the cache key
+    return evaluate();
+  }
+
+  std::pair<const fib::Entry*, FaceId> key{&fibEntry, inFace.getId()};
+  auto it = m_decisions.find(key);
+  if (it != m_decisions.end() && it->second.nextHopsVersion == fibEntry.getNextHopsVersion()) {
+    return it->second.outFace;
+  }
+
+  Face* outFace = evaluate();
+  if (it != m_decisions.end()) {
+    it->second = {fibEntry.getNextHopsVersion(), outFace};
+  }
+  else {
+    if (m_decisions.size() >= MAX_DECISIONS) {
+      m_decisions.clear();
+    }
+    m_decisions.emplace(key, Decision{fibEntry.getNextHopsVersion(), outFace});
+  }
+  return outFace;
+}
+
+void
+BestRouteStrategy::beforeSatisfyInterest(const Data& data, const FaceEndpoint& ingress,
+                                         const shared_ptr<pit::Entry>& pitEntry)
+{
+  if (m_pacer != nullptr) {
+    m_pacer->afterReceiveData(data, ingress.face, *pitEntry);
+  }
+}
+
 void
 BestRouteStrategy::afterReceiveNack(const lp::Nack& nack, const FaceEndpoint& ingress,
                                     const shared_ptr<pit::Entry>& pitEntry)
 {
+  if (m_pacer != nullptr) {
+    m_pacer->afterReceiveNack(nack, ingress.face, *pitEntry);
+  }
   this->processNack(nack, ingress.face, pitEntry);
 }
 
+void
+BestRouteStrategy::forwardInterest(const Interest& interest, Face& outFace, const fib::Entry& fibEntry,
+                                   const shared_ptr<pit::Entry>& pitEntry, bool isNewInterest)
+{
+  if (m_pacer == nullptr) {
+    this->sendInterest(interest, outFace, pitEntry);
+    return;
+  }
+
+  auto result = m_pacer->send(interest, outFace, fibEntry, pitEntry);
+  if (result == InterestPacer::Result::CONGESTED && isNewInterest) {
+    NFD_LOG_DEBUG(interest << " to=" << outFace.getId() << " congested");
+
+    lp::NackHeader nackHeader;
+    nackHeader.setReason(lp::NackReason::CONGESTION);
+    this->sendNacks(nackHeader, pitEntry);
+    this->rejectPendingInterest(pitEntry);
+  }
+}
+
 } // namespace nfd::fw
@@ -27,9 +27,12 @@
 #define NFD_DAEMON_FW_BEST_ROUTE_STRATEGY_HPP
 
 #include "strategy.hpp"
+#include "interest-pacer.hpp"
 #include "process-nack-traits.hpp"
 #include "retx-suppression-exponential.hpp"
 
+#include <unordered_map>
+
 namespace nfd::fw {
 
 /**
@@ -49,6 +52,15 @@ namespace nfd::fw {
  *
  * This strategy returns Nack to all downstreams if all upstreams have returned Nacks.
  * The reason of the sent Nack equals the least severe reason among received Nacks.
+ *
+ * If the `pacing~1` parameter is given, Interests are paced per upstream according to the
+ * congestion marks returned by that upstream (see InterestPacer). A new Interest that cannot
+ * be forwarded within the maximum pacing delay is Nacked with reason Congestion.
+ *
+ * The nexthop chosen for a new Interest depends only on the FIB entry, the ingress face,
+ * and the scope of the Interest name. It is memoized per (FIB entry, ingress face) for
+ * names outside /localhost and /localhop, and recomputed when the nexthops of the FIB
+ * entry change. Retransmissions are always fully evaluated.
  */
 class BestRouteStrategy : public Strategy
                         , public ProcessNackTraits<BestRouteStrategy>
@@ -65,12 +77,51 @@ public: // triggers
   afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
                        const shared_ptr<pit::Entry>& pitEntry) override;
 
+  void
+  beforeSatisfyInterest(const Data& data, const FaceEndpoint& ingress,
+                        const shared_ptr<pit::Entry>& pitEntry) override;
+
   void
   afterReceiveNack(const lp::Nack& nack, const FaceEndpoint& ingress,
                    const shared_ptr<pit::Entry>& pitEntry) override;
 
+private:
+  /** \brief Finds the lowest-cost eligible nexthop for a new Interest.
+   *  \return the upstream face, or nullptr if no nexthop is eligible
+   */
+  Face*
+  findNextHopForNewInterest(const Face& inFace, const Interest& interest,
+                            const fib::Entry& fibEntry, const shared_ptr<pit::Entry>& pitEntry);
+
+  void
+  forwardInterest(const Interest& interest, Face& outFace, const fib::Entry& fibEntry,
+                  const shared_ptr<pit::Entry>& pitEntry, bool isNewInterest);
+
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   std::unique_ptr<RetxSuppressionExponential> m_retxSuppression;
+  std::unique_ptr<InterestPacer> m_pacer;
+
+  /** \brief Memoized nexthop choice for new Interests.
+   */
+  struct Decision
+  {
+    uint64_t nextHopsVersion; ///< fib::Entry::getNextHopsVersion() when the choice was made
+    Face* outFace; ///< nullptr if no nexthop is eligible
+  };
+
+  struct DecisionKeyHash
+  {
+    size_t
+    operator()(const std::pair<const fib::Entry*, FaceId>& key) const noexcept
+    {
+      return std::hash<const fib::Entry*>()(key.first) ^ (std::hash<FaceId>()(key.second) << 1);
+    }
+  };
+
+  std::unordered_map<std::pair<const fib::Entry*, FaceId>, Decision, DecisionKeyHash> m_decisions;
+
+  /// the decision cache is emptied when it reaches this size
+  static constexpr size_t MAX_DECISIONS = 4096;
 
   friend ProcessNackTraits<BestRouteStrategy>;
 };
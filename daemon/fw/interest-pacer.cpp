@@ -0,0 +1,321 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "interest-pacer.hpp"
+#include "common/global.hpp"
+#include "common/logger.hpp"
+#include "face/face.hpp"
+#include "table/measurements-accessor.hpp"
+
+namespace nfd::fw {
+
+NFD_LOG_INIT(InterestPacer);
+
+struct InterestPacer::Upstream
+{
+  time::nanoseconds interval = 0_ns; ///< zero if the upstream is not paced
+  time::steady_clock::time_point nextSend;
+  time::steady_clock::time_point lastOffered = time::steady_clock::time_point::min();
+  time::nanoseconds meanGap = 0_ns; ///< mean gap between Interests offered to the upstream
+  time::nanoseconds srtt = 0_ns;
+  time::steady_clock::time_point lastDecrease;
+  double markedRatio = 0.0;
+};
+
+namespace {
+
+constexpr time::nanoseconds RTT_IF_UNKNOWN = 100_ms;
+constexpr time::nanoseconds MAX_INTERVAL = 1_s;
+constexpr time::nanoseconds MEASUREMENTS_LIFETIME = 1_min;
+
+/** \brief StrategyInfo in measurements table.
+ */
+class MtInfo final : public StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 1060;
+  }
+
+  const shared_ptr<InterestPacer::Upstream>&
+  getOrCreate(FaceId faceId)
+  {
+    auto it = std::find_if(upstreams.begin(), upstreams.end(),
+                           [faceId] (const auto& entry) { return entry.first == faceId; });
+    if (it != upstreams.end()) {
+      return it->second;
+    }
+    return upstreams.emplace_back(faceId, make_shared<InterestPacer::Upstream>()).second;
+  }
+
+public:
+  std::vector<std::pair<FaceId, shared_ptr<InterestPacer::Upstream>>> upstreams;
+};
+
+/** \brief StrategyInfo on PIT entry, holding the Interests waiting to be sent.
+ *
+ *  Pending sends are cancelled when the PIT entry goes away.
+ */
+class PitInfo final : public StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 1061;
+  }
+
+public:
+  std::vector<std::pair<FaceId, scheduler::ScopedEventId>> pending;
+};
+
+/** \brief StrategyInfo on PIT out-record, linking it to the upstream's pacing state.
+ */
+class OutRecordInfo final : public StrategyInfo
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 1062;
+  }
+
+  explicit
+  OutRecordInfo(shared_ptr<InterestPacer::Upstream> up)
+    : upstream(std::move(up))
+  {
+  }
+
+public:
+  shared_ptr<InterestPacer::Upstream> upstream;
+};
+
+double
+toSeconds(time::nanoseconds d)
+{
+  return time::duration_cast<time::duration<double>>(d).count();
+}
+
+} // namespace
+
+InterestPacer::InterestPacer(MeasurementsAccessor& measurements, const FaceTable& faceTable,
+                             SendFunc send, time::milliseconds maxDelay, double additiveIncrease)
+  : m_measurements(measurements)
+  , m_faceTable(faceTable)
+  , m_send(std::move(send))
+  , m_maxDelay(maxDelay)
+  , m_additiveIncrease(additiveIncrease)
+{
+  if (m_maxDelay <= 0_ms) {
+    NDN_THROW(std::invalid_argument("Pacing max delay must be > 0"));
+  }
+  if (!(m_additiveIncrease > 0.0)) {
+    NDN_THROW(std::invalid_argument("Pacing additive increase must be > 0"));
+  }
+}
+
+std::unique_ptr<InterestPacer>
+InterestPacer::construct(const StrategyParameters& params, MeasurementsAccessor& measurements,
+                         const FaceTable& faceTable, SendFunc send)
+{
+  auto isEnabled = params.getOrDefault<uint32_t>("pacing", 0);
+  auto maxDelay = params.getOrDefault<time::milliseconds::rep>("pacing-max-delay",
+                                                               DEFAULT_MAX_DELAY.count());
+  auto ai = params.getOrDefault<double>("pacing-ai", DEFAULT_ADDITIVE_INCREASE);
+  if (isEnabled > 1) {
+    NDN_THROW(std::invalid_argument("pacing must be either 0 or 1"));
+  }
+  if (isEnabled == 0) {
+    return nullptr;
+  }
+  return make_unique<InterestPacer>(measurements, faceTable, std::move(send),
+                                    time::milliseconds(maxDelay), ai);
+}
+
+InterestPacer::Result
+InterestPacer::send(const Interest& interest, Face& egress, const fib::Entry& fibEntry,
+                    const shared_ptr<pit::Entry>& pitEntry)
+{
+  auto* me = m_measurements.get(fibEntry);
+  // If the FIB entry is not under the strategy's namespace, find a part of the name
+  // that falls under the strategy's namespace
+  for (size_t prefixLen = fibEntry.getPrefix().size() + 1;
+       me == nullptr && prefixLen <= pitEntry->getName().size();
+       ++prefixLen) {
+    me = m_measurements.get(pitEntry->getName().getPrefix(prefixLen));
+  }
+  if (me == nullptr) {
+    m_send(interest, egress, pitEntry);
+    return Result::SENT;
+  }
+  m_measurements.extendLifetime(*me, MEASUREMENTS_LIFETIME);
+
+  auto faceId = egress.getId();
+  auto* pi = pitEntry->getStrategyInfo<PitInfo>();
+  if (pi != nullptr && std::any_of(pi->pending.begin(), pi->pending.end(),
+                                   [faceId] (const auto& p) { return p.first == faceId; })) {
+    // already waiting to be sent to this upstream
+    return Result::DELAYED;
+  }
+
+  shared_ptr<Upstream> up = me->insertStrategyInfo<MtInfo>().first->getOrCreate(faceId);
+  auto now = time::steady_clock::now();
+
+  // estimate the rate at which Interests are offered to this upstream
+  if (up->lastOffered != time::steady_clock::time_point::min()) {
+    time::nanoseconds gap = now - up->lastOffered;
+    up->meanGap = up->meanGap == 0_ns ? gap : up->meanGap + (gap - up->meanGap) / 8;
+  }
+  up->lastOffered = now;
+
+  if (up->interval == 0_ns) {
+    sendNow(interest, egress, pitEntry, std::move(up));
+    return Result::SENT;
+  }
+
+  auto start = std::max(now, up->nextSend);
+  if (start - now > m_maxDelay) {
+    NFD_LOG_DEBUG(interest << " to=" << faceId << " congested interval=" << up->interval);
+    return Result::CONGESTED;
+  }
+  up->nextSend = start + up->interval;
+
+  if (start == now) {
+    sendNow(interest, egress, pitEntry, std::move(up));
+    return Result::SENT;
+  }
+
+  NFD_LOG_TRACE(interest << " to=" << faceId << " delay=" << (start - now));
+  pi = pitEntry->insertStrategyInfo<PitInfo>().first;
+  pi->pending.emplace_back(faceId, getScheduler().schedule(start - now,
+    [this, interest, faceId, weakPitEntry = weak_ptr<pit::Entry>(pitEntry), up = std::move(up)] {
+      auto pitEntry = weakPitEntry.lock();
+      if (pitEntry == nullptr) {
+        return;
+      }
+      auto* pi = pitEntry->getStrategyInfo<PitInfo>();
+      BOOST_ASSERT(pi != nullptr);
+      auto it = std::find_if(pi->pending.begin(), pi->pending.end(),
+                             [faceId] (const auto& p) { return p.first == faceId; });
+      BOOST_ASSERT(it != pi->pending.end());
+      pi->pending.erase(it);
+
+      Face* egress = m_faceTable.get(faceId);
+      if (egress == nullptr || pitEntry->isSatisfied || pitEntry->in_begin() == pitEntry->in_end()) {
+        return;
+      }
+      sendNow(interest, *egress, pitEntry, up);
+    }));
+  return Result::DELAYED;
+}
+
+void
+InterestPacer::sendNow(const Interest& interest, Face& egress, const shared_ptr<pit::Entry>& pitEntry,
+                       shared_ptr<Upstream> up)
+{
+  auto* outRecord = m_send(interest, egress, pitEntry);
+  if (outRecord != nullptr) {
+    outRecord->eraseStrategyInfo<OutRecordInfo>();
+    outRecord->insertStrategyInfo<OutRecordInfo>(std::move(up));
+  }
+}
+
+void
+InterestPacer::afterReceiveData(const Data& data, const Face& ingress, const pit::Entry& pitEntry)
+{
+  auto outRecord = pitEntry.getOutRecord(ingress);
+  if (outRecord == pitEntry.out_end()) {
+    return;
+  }
+  auto* info = outRecord->getStrategyInfo<OutRecordInfo>();
+  if (info == nullptr) {
+    return;
+  }
+
+  auto& up = *info->upstream;
+  auto rtt = time::steady_clock::now() - outRecord->getLastRenewed();
+  up.srtt = up.srtt == 0_ns ? rtt : up.srtt + (rtt - up.srtt) / 8;
+  onResponse(up, data.getCongestionMark() > 0, pitEntry, ingress);
+}
+
+void
+InterestPacer::afterReceiveNack(const lp::Nack& nack, const Face& ingress, const pit::Entry& pitEntry)
+{
+  auto outRecord = pitEntry.getOutRecord(ingress);
+  if (outRecord == pitEntry.out_end()) {
+    return;
+  }
+  auto* info = outRecord->getStrategyInfo<OutRecordInfo>();
+  if (info == nullptr) {
+    return;
+  }
+
+  onResponse(*info->upstream, nack.getReason() == lp::NackReason::CONGESTION, pitEntry, ingress);
+}
+
+void
+InterestPacer::onResponse(Upstream& up, bool isMarked, const pit::Entry& pitEntry, const Face& ingress)
+{
+  auto now = time::steady_clock::now();
+  up.markedRatio += ((isMarked ? 1.0 : 0.0) - up.markedRatio) / 16.0;
+
+  if (isMarked) {
+    // react at most once per round-trip time
+    if (now - up.lastDecrease < std::max<time::nanoseconds>(up.srtt, 1_ms)) {
+      return;
+    }
+    up.lastDecrease = now;
+
+    if (up.interval == 0_ns) {
+      // start pacing at the offered rate
+      up.interval = std::max<time::nanoseconds>(up.meanGap, 1_us);
+    }
+    // rate *= 1 - markedRatio / 2
+    auto interval = time::duration_cast<time::nanoseconds>(up.interval * (2.0 / (2.0 - up.markedRatio)));
+    up.interval = std::min(interval, MAX_INTERVAL);
+    NFD_LOG_DEBUG(pitEntry.getName() << " marked from=" << ingress.getId()
+                  << " ratio=" << up.markedRatio << " interval=" << up.interval);
+    return;
+  }
+
+  if (up.interval == 0_ns) {
+    return;
+  }
+
+  double rate = 1.0 / toSeconds(up.interval);
+  double rtt = toSeconds(up.srtt > 0_ns ? up.srtt : RTT_IF_UNKNOWN);
+  rate += m_additiveIncrease / (rate * rtt);
+  up.interval = time::duration_cast<time::nanoseconds>(time::duration<double>(1.0 / rate));
+
+  if (up.interval * 2 < up.meanGap) {
+    // the upstream can take twice the offered load
+    up.interval = 0_ns;
+    NFD_LOG_DEBUG(pitEntry.getName() << " from=" << ingress.getId() << " pacing-stopped");
+  }
+}
+
+} // namespace nfd::fw
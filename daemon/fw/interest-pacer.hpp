@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_INTEREST_PACER_HPP
+#define NFD_DAEMON_FW_INTEREST_PACER_HPP
+
+#include "strategy.hpp"
+
+namespace nfd::fw {
+
+/**
+ * \brief Paces the Interests that a strategy forwards to each upstream, according to the
+ *        congestion marks carried by the Data and Nacks returned by that upstream.
+ *
+ * State is kept per (namespace, upstream face) in the measurements table. An upstream is
+ * not paced until it returns a Data with a CongestionMark or a Nack with reason Congestion;
+ * at that point, pacing starts at the rate at which Interests are being offered to it.
+ * Every further congestion signal reduces the rate by half the fraction of marked responses,
+ * at most once per round-trip time. Every unmarked response increases the rate additively,
+ * and pacing stops once the paced rate is twice the offered rate.
+ *
+ * An Interest that would have to wait longer than the configured maximum delay is not
+ * forwarded, and the strategy is told that the upstream is congested.
+ *
+ * Supported strategy parameters:
+ *  - `pacing~<0|1>`: enables pacing (default 0)
+ *  - `pacing-max-delay~<ms>`: maximum delay of an Interest (default 100)
+ *  - `pacing-ai~<x>`: additive increase, in Interests/s per round-trip time (default 10)
+ */
+class InterestPacer : noncopyable
+{
+public:
+  /** \brief Callback that forwards an Interest to an upstream.
+   *  \return the out-record, or nullptr if the Interest was not sent
+   */
+  using SendFunc = std::function<pit::OutRecord*(const Interest&, Face&, const shared_ptr<pit::Entry>&)>;
+
+  enum class Result {
+    SENT,      ///< the Interest has been sent
+    DELAYED,   ///< the Interest will be sent later
+    CONGESTED, ///< the Interest has been dropped because the upstream is congested
+  };
+
+  InterestPacer(MeasurementsAccessor& measurements, const FaceTable& faceTable, SendFunc send,
+                time::milliseconds maxDelay = DEFAULT_MAX_DELAY,
+                double additiveIncrease = DEFAULT_ADDITIVE_INCREASE);
+
+  /** \brief Constructs an InterestPacer from strategy parameters.
+   *  \return the pacer, or nullptr if pacing is not enabled
+   *  \throw std::invalid_argument a parameter is malformed
+   */
+  static std::unique_ptr<InterestPacer>
+  construct(const StrategyParameters& params, MeasurementsAccessor& measurements,
+            const FaceTable& faceTable, SendFunc send);
+
+  /** \brief Forwards \p interest to \p egress, now or when the pacing interval elapses.
+   */
+  Result
+  send(const Interest& interest, Face& egress, const fib::Entry& fibEntry,
+       const shared_ptr<pit::Entry>& pitEntry);
+
+  /** \brief Accounts for a Data returned by \p ingress.
+   */
+  void
+  afterReceiveData(const Data& data, const Face& ingress, const pit::Entry& pitEntry);
+
+  /** \brief Accounts for a Nack returned by \p ingress.
+   */
+  void
+  afterReceiveNack(const lp::Nack& nack, const Face& ingress, const pit::Entry& pitEntry);
+
+private: // non-member operators (hidden friends)
+  friend std::ostream&
+  operator<<(std::ostream& os, const InterestPacer& pacer)
+  {
+    return os << "InterestPacer max-delay=" << pacer.m_maxDelay
+              << " ai=" << pacer.m_additiveIncrease;
+  }
+
+public:
+  static constexpr time::milliseconds DEFAULT_MAX_DELAY = 100_ms;
+  static constexpr double DEFAULT_ADDITIVE_INCREASE = 10.0;
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  struct Upstream;
+
+  void
+  onResponse(Upstream& up, bool isMarked, const pit::Entry& pitEntry, const Face& ingress);
+
+  void
+  sendNow(const Interest& interest, Face& egress, const shared_ptr<pit::Entry>& pitEntry,
+          shared_ptr<Upstream> up);
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  MeasurementsAccessor& m_measurements;
+  const FaceTable& m_faceTable;
+  SendFunc m_send;
+  const time::milliseconds m_maxDelay;
+  const double m_additiveIncrease;
+};
+
+} // namespace nfd::fw
+
+#endif // NFD_DAEMON_FW_INTEREST_PACER_HPP
@@ -62,7 +62,13 @@ MulticastStrategy::afterReceiveInterest(const Interest& interest, const FaceEndp
                                         const shared_ptr<pit::Entry>& pitEntry)
 {
   const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
-  const fib::NextHopList& nexthops = fibEntry.getNextHops();
+  auto nexthopsPtr = fibEntry.getNextHops();
+  const fib::NextHopList& nexthops = *nexthopsPtr;
+
+  std::vector<Face*> egresses;
+  std::vector<RetxSuppressionResult> suppressResults;
+  egresses.reserve(nexthops.size());
+  suppressResults.reserve(nexthops.size());
 
   for (const auto& nexthop : nexthops) {
     Face& outFace = nexthop.getFace();
@@ -79,9 +85,18 @@ MulticastStrategy::afterReceiveInterest(const Interest& interest, const FaceEndp
     }
 
     NFD_LOG_DEBUG(interest << " from=" << ingress << " pitEntry-to=" << outFace.getId());
-    auto* sentOutRecord = this->sendInterest(interest, outFace, pitEntry);
-    if (sentOutRecord && suppressResult == RetxSuppressionResult::FORWARD) {
-      m_retxSuppression->incrementIntervalForOutRecord(*sentOutRecord);
+    egresses.push_back(&outFace);
+    suppressResults.push_back(suppressResult);
+  }
+
+  if (egresses.empty()) {
+    return;
+  }
+
+  auto outRecords = this->sendInterestToAll(interest, egresses, pitEntry);
+  for (size_t i = 0; i < outRecords.size(); ++i) {
+    if (outRecords[i] && suppressResults[i] == RetxSuppressionResult::FORWARD) {
+      m_retxSuppression->incrementIntervalForOutRecord(*outRecords[i]);
     }
   }
 }
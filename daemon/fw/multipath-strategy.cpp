@@ -0,0 +1,341 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "multipath-strategy.hpp"
+#include "algorithm.hpp"
+#include "common/logger.hpp"
+
+#include <ndn-cxx/util/random.hpp>
+
+#include <cmath>
+
+namespace nfd::fw {
+
+NFD_REGISTER_STRATEGY(MultipathStrategy);
+NFD_LOG_INIT(MultipathStrategy);
+
+const shared_ptr<MultipathStrategy::Window>&
+MultipathStrategy::MtInfo::getOrCreateWindow(FaceId faceId, double initialWindow)
+{
+  auto it = std::find_if(windows.begin(), windows.end(),
+                         [faceId] (const auto& entry) { return entry.first == faceId; });
+  if (it != windows.end()) {
+    return it->second;
+  }
+
+  auto w = make_shared<Window>();
+  w->cwnd = initialWindow;
+  return windows.emplace_back(faceId, std::move(w)).second;
+}
+
+MultipathStrategy::OutRecordInfo::OutRecordInfo(shared_ptr<Window> window)
+  : m_window(std::move(window))
+{
+  ++m_window->nInFlight;
+}
+
+MultipathStrategy::OutRecordInfo::~OutRecordInfo()
+{
+  if (m_isPending) {
+    // the PIT entry is gone and this nexthop never answered
+    --m_window->nInFlight;
+    m_window->hasPendingLoss = true;
+  }
+}
+
+MultipathStrategy::Window*
+MultipathStrategy::OutRecordInfo::release()
+{
+  if (!m_isPending) {
+    return nullptr;
+  }
+  m_isPending = false;
+  --m_window->nInFlight;
+  return m_window.get();
+}
+
+MultipathStrategy::MultipathStrategy(Forwarder& forwarder, const Name& name)
+  : Strategy(forwarder)
+  , ProcessNackTraits(this)
+{
+  ParsedInstanceName parsed = parseInstanceName(name);
+  if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
+    NDN_THROW(std::invalid_argument(
+      "MultipathStrategy does not support version " + to_string(*parsed.version)));
+  }
+
+  StrategyParameters params = parseParameters(parsed.parameters);
+  m_retxSuppression = RetxSuppressionExponential::construct(params);
+
+  m_initialWindow = params.getOrDefault<double>("initial-window", DEFAULT_INITIAL_WINDOW);
+  if (!(m_initialWindow >= MIN_WINDOW && std::isfinite(m_initialWindow))) {
+    NDN_THROW(std::invalid_argument("initial-window must be a finite number not less than 1"));
+  }
+  m_ai = params.getOrDefault<double>("ai", DEFAULT_AI);
+  if (!(m_ai > 0.0 && std::isfinite(m_ai))) {
+    NDN_THROW(std::invalid_argument("ai must be a finite positive number"));
+  }
+  m_md = params.getOrDefault<double>("md", DEFAULT_MD);
+  if (!(m_md > 0.0 && m_md < 1.0)) {
+    NDN_THROW(std::invalid_argument("md must be between 0 and 1 (exclusive)"));
+  }
+
+  this->setInstanceName(makeInstanceName(name, getStrategyName()));
+
+  NDN_LOG_DEBUG(*m_retxSuppression);
+  NFD_LOG_DEBUG("initial-window=" << m_initialWindow << " ai=" << m_ai << " md=" << m_md);
+}
+
+const Name&
+MultipathStrategy::getStrategyName()
+{
+  static const auto strategyName = Name("/localhost/nfd/strategy/multipath").appendVersion(1);
+  return strategyName;
+}
+
+void
+MultipathStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
+                                        const shared_ptr<pit::Entry>& pitEntry)
+{
+  RetxSuppressionResult suppression = m_retxSuppression->decidePerPitEntry(*pitEntry);
+  if (suppression == RetxSuppressionResult::SUPPRESS) {
+    NFD_LOG_DEBUG(interest << " from=" << ingress << " suppressed");
+    return;
+  }
+
+  const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  auto nexthopsPtr = fibEntry.getNextHops();
+  const fib::NextHopList& nexthops = *nexthopsPtr;
+  MtInfo& mi = this->getOrCreateMtInfo(fibEntry, interest.getName());
+  auto now = time::steady_clock::now();
+
+  if (suppression == RetxSuppressionResult::NEW) {
+    const fib::NextHop* nh = this->selectNextHop(interest, ingress.face, nexthops, pitEntry,
+                                                 mi, false, now);
+    if (nh == nullptr) {
+      NFD_LOG_DEBUG(interest << " from=" << ingress << " noNextHop");
+
+      lp::NackHeader nackHeader;
+      nackHeader.setReason(lp::NackReason::NO_ROUTE);
+      this->sendNack(nackHeader, ingress.face, pitEntry);
+      this->rejectPendingInterest(pitEntry);
+      return;
+    }
+
+    NFD_LOG_DEBUG(interest << " from=" << ingress << " newPitEntry-to=" << nh->getFace().getId());
+    this->forwardInterest(interest, *nh, pitEntry, mi);
+    return;
+  }
+
+  // retransmission: prefer a nexthop that has not been tried yet,
+  // otherwise fall back to the one that was used earliest
+  const fib::NextHop* nh = this->selectNextHop(interest, ingress.face, nexthops, pitEntry,
+                                               mi, true, now);
+  if (nh == nullptr) {
+    auto it = findEligibleNextHopWithEarliestOutRecord(ingress.face, interest, nexthops, pitEntry);
+    if (it == nexthops.end()) {
+      NFD_LOG_DEBUG(interest << " from=" << ingress << " retransmitNoNextHop");
+      return;
+    }
+    nh = &*it;
+  }
+
+  NFD_LOG_DEBUG(interest << " from=" << ingress << " retransmit-to=" << nh->getFace().getId());
+  this->forwardInterest(interest, *nh, pitEntry, mi);
+}
+
+void
+MultipathStrategy::beforeSatisfyInterest(const Data& data, const FaceEndpoint& ingress,
+                                         const shared_ptr<pit::Entry>& pitEntry)
+{
+  auto now = time::steady_clock::now();
+
+  for (const auto& outRecord : pitEntry->getOutRecords()) {
+    auto info = outRecord.getStrategyInfo<OutRecordInfo>();
+    if (info == nullptr) {
+      continue;
+    }
+
+    // the Interest is satisfied, so the other upstreams are not charged with a loss
+    Window* w = info->release();
+    if (w == nullptr || &outRecord.getFace() != &ingress.face) {
+      continue;
+    }
+
+    updateRtt(*w, now - outRecord.getLastRenewed());
+    this->applyPendingLoss(*w, now);
+    if (data.getCongestionMark() > 0) {
+      this->decreaseWindow(*w, now);
+    }
+    else {
+      this->increaseWindow(*w);
+    }
+    NFD_LOG_DEBUG(pitEntry->getName() << " data-from=" << ingress << " cwnd=" << w->cwnd
+                  << " inflight=" << w->nInFlight);
+  }
+}
+
+void
+MultipathStrategy::afterReceiveNack(const lp::Nack& nack, const FaceEndpoint& ingress,
+                                    const shared_ptr<pit::Entry>& pitEntry)
+{
+  auto outRecord = pitEntry->getOutRecord(ingress.face);
+  if (outRecord != pitEntry->out_end()) {
+    auto info = outRecord->getStrategyInfo<OutRecordInfo>();
+    if (Window* w = info == nullptr ? nullptr : info->release(); w != nullptr) {
+      auto now = time::steady_clock::now();
+      this->applyPendingLoss(*w, now);
+      this->decreaseWindow(*w, now);
+      NFD_LOG_DEBUG(nack.getInterest() << " nack-from=" << ingress << " reason=" << nack.getReason()
+                    << " cwnd=" << w->cwnd << " inflight=" << w->nInFlight);
+    }
+  }
+
+  this->processNack(nack, ingress.face, pitEntry);
+}
+
+const fib::NextHop*
+MultipathStrategy::selectNextHop(const Interest& interest, const Face& inFace,
+                                 const fib::NextHopList& nexthops,
+                                 const shared_ptr<pit::Entry>& pitEntry, MtInfo& mi,
+                                 bool wantUnused, time::steady_clock::time_point now)
+{
+  std::uniform_real_distribution<double> dist;
+  auto& rng = ndn::random::getRandomNumberEngine();
+
+  const fib::NextHop* chosen = nullptr;
+  double totalFree = 0.0;
+  const fib::NextHop* leastLoaded = nullptr;
+  double minLoad = std::numeric_limits<double>::infinity();
+
+  for (const auto& nh : nexthops) {
+    if (!isNextHopEligible(inFace, interest, nh, pitEntry, wantUnused, now)) {
+      continue;
+    }
+
+    Window& w = *mi.getOrCreateWindow(nh.getFace().getId(), m_initialWindow);
+    this->applyPendingLoss(w, now);
+
+    // weighted reservoir sampling: each nexthop is chosen with probability
+    // proportional to the free space in its window
+    double free = w.cwnd - static_cast<double>(w.nInFlight);
+    if (free > 0.0) {
+      totalFree += free;
+      if (dist(rng) * totalFree < free) {
+        chosen = &nh;
+      }
+    }
+
+    double load = static_cast<double>(w.nInFlight + 1) / w.cwnd;
+    if (load < minLoad) {
+      minLoad = load;
+      leastLoaded = &nh;
+    }
+  }
+
+  return chosen != nullptr ? chosen : leastLoaded;
+}
+
+void
+MultipathStrategy::forwardInterest(const Interest& interest, const fib::NextHop& nexthop,
+                                   const shared_ptr<pit::Entry>& pitEntry, MtInfo& mi)
+{
+  Face& outFace = nexthop.getFace();
+  auto window = mi.getOrCreateWindow(outFace.getId(), m_initialWindow);
+
+  auto outRecord = this->sendInterest(interest, outFace, pitEntry);
+  if (outRecord == nullptr) {
+    return;
+  }
+
+  // a retransmission through the same upstream keeps its in-flight slot
+  auto info = outRecord->getStrategyInfo<OutRecordInfo>();
+  if (info == nullptr || !info->isPending()) {
+    outRecord->eraseStrategyInfo<OutRecordInfo>();
+    outRecord->insertStrategyInfo<OutRecordInfo>(std::move(window));
+  }
+}
+
+MultipathStrategy::MtInfo&
+MultipathStrategy::getOrCreateMtInfo(const fib::Entry& fibEntry, const Name& name)
+{
+  auto* me = this->getMeasurements().get(fibEntry);
+
+  // If the FIB entry is not under the strategy's namespace, find a part of the name
+  // that falls under the strategy's namespace
+  for (size_t prefixLen = fibEntry.getPrefix().size() + 1;
+       me == nullptr && prefixLen <= name.size();
+       ++prefixLen) {
+    me = this->getMeasurements().get(name.getPrefix(prefixLen));
+  }
+  BOOST_ASSERT(me != nullptr);
+
+  this->getMeasurements().extendLifetime(*me, MEASUREMENTS_LIFETIME);
+  return *me->insertStrategyInfo<MtInfo>().first;
+}
+
+void
+MultipathStrategy::updateRtt(Window& w, time::nanoseconds rtt)
+{
+  if (w.srtt == 0_ns) {
+    w.srtt = rtt;
+  }
+  else {
+    w.srtt += (rtt - w.srtt) / 8;
+  }
+}
+
+void
+MultipathStrategy::increaseWindow(Window& w) const
+{
+  // do not grow a window that the offered load does not fill
+  if (static_cast<double>(w.nInFlight + 1) * 2.0 >= w.cwnd) {
+    w.cwnd += m_ai / w.cwnd;
+  }
+}
+
+void
+MultipathStrategy::decreaseWindow(Window& w, time::steady_clock::time_point now) const
+{
+  // react at most once per round-trip time, since losses and marks
+  // within the same window are caused by the same congestion event
+  if (w.srtt > 0_ns && now - w.lastDecrease < w.srtt) {
+    return;
+  }
+
+  w.cwnd = std::max(w.cwnd * m_md, MIN_WINDOW);
+  w.lastDecrease = now;
+}
+
+void
+MultipathStrategy::applyPendingLoss(Window& w, time::steady_clock::time_point now) const
+{
+  if (w.hasPendingLoss) {
+    w.hasPendingLoss = false;
+    this->decreaseWindow(w, now);
+  }
+}
+
+} // namespace nfd::fw
@@ -0,0 +1,196 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_MULTIPATH_STRATEGY_HPP
+#define NFD_DAEMON_FW_MULTIPATH_STRATEGY_HPP
+
+#include "strategy.hpp"
+#include "process-nack-traits.hpp"
+#include "retx-suppression-exponential.hpp"
+
+namespace nfd::fw {
+
+/**
+ * \brief A forwarding strategy that splits traffic across nexthops in proportion to
+ *        their available capacity.
+ *
+ * For every (namespace, nexthop) pair, the strategy maintains an AIMD congestion window
+ * and the number of Interests in flight. A new Interest is forwarded to one eligible
+ * nexthop chosen at random, weighted by the free space in each window. When all windows
+ * are full, the nexthop with the lowest relative load is used.
+ *
+ * The window of a nexthop grows additively with every Data returned through it, and is
+ * multiplicatively reduced, at most once per round-trip time, when a Data carries a
+ * congestion mark, when a Nack is received, or when the Interest goes unanswered.
+ *
+ * Retransmitted Interests are subject to exponential retransmission suppression and are
+ * preferably sent to a nexthop that has not been tried yet.
+ *
+ * Supported parameters:
+ *  - `initial-window~<n>`: initial congestion window, in Interests (default 4)
+ *  - `ai~<x>`: additive increase per window's worth of Data (default 1.0)
+ *  - `md~<x>`: multiplicative decrease factor, in (0,1) (default 0.5)
+ *  - the parameters of RetxSuppressionExponential
+ */
+class MultipathStrategy : public Strategy
+                        , public ProcessNackTraits<MultipathStrategy>
+{
+public:
+  explicit
+  MultipathStrategy(Forwarder& forwarder, const Name& name = getStrategyName());
+
+  static const Name&
+  getStrategyName();
+
+public: // triggers
+  void
+  afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
+                       const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  beforeSatisfyInterest(const Data& data, const FaceEndpoint& ingress,
+                        const shared_ptr<pit::Entry>& pitEntry) override;
+
+  void
+  afterReceiveNack(const lp::Nack& nack, const FaceEndpoint& ingress,
+                   const shared_ptr<pit::Entry>& pitEntry) override;
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  /** \brief Congestion window of one nexthop within a namespace.
+   */
+  struct Window
+  {
+    double cwnd = 0.0;
+    size_t nInFlight = 0;
+    time::nanoseconds srtt = 0_ns; ///< zero if no RTT sample has been taken
+    time::steady_clock::time_point lastDecrease;
+    bool hasPendingLoss = false; ///< an Interest expired without an answer
+  };
+
+  /** \brief StrategyInfo in measurements table.
+   */
+  class MtInfo final : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1050;
+    }
+
+    /** \brief Returns the window of \p faceId, creating it if necessary.
+     */
+    const shared_ptr<Window>&
+    getOrCreateWindow(FaceId faceId, double initialWindow);
+
+  public:
+    std::vector<std::pair<FaceId, shared_ptr<Window>>> windows;
+  };
+
+  /** \brief StrategyInfo on PIT out-record.
+   *
+   *  Holds one in-flight slot of the nexthop's window. If the out-record is destroyed while
+   *  the slot is still held, i.e., the PIT entry went away without Data or Nack from this
+   *  nexthop, the slot is released and the loss is applied to the window on its next use.
+   */
+  class OutRecordInfo final : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1051;
+    }
+
+    explicit
+    OutRecordInfo(shared_ptr<Window> window);
+
+    ~OutRecordInfo() final;
+
+    bool
+    isPending() const noexcept
+    {
+      return m_isPending;
+    }
+
+    /** \brief Releases the in-flight slot, if still held.
+     *  \return the window, or nullptr if the slot had already been released
+     */
+    Window*
+    release();
+
+  private:
+    shared_ptr<Window> m_window;
+    bool m_isPending = true;
+  };
+
+  /** \brief Chooses an outgoing nexthop for \p interest among \p nexthops.
+   *  \param wantUnused if true, nexthops with a pending out-record are not eligible
+   *  \return the chosen nexthop, or nullptr if no nexthop is eligible
+   */
+  const fib::NextHop*
+  selectNextHop(const Interest& interest, const Face& inFace, const fib::NextHopList& nexthops,
+                const shared_ptr<pit::Entry>& pitEntry, MtInfo& mi, bool wantUnused,
+                time::steady_clock::time_point now);
+
+  /** \brief Sends \p interest to \p nexthop and charges the nexthop's window.
+   */
+  void
+  forwardInterest(const Interest& interest, const fib::NextHop& nexthop,
+                  const shared_ptr<pit::Entry>& pitEntry, MtInfo& mi);
+
+  MtInfo&
+  getOrCreateMtInfo(const fib::Entry& fibEntry, const Name& name);
+
+  static void
+  updateRtt(Window& w, time::nanoseconds rtt);
+
+  void
+  increaseWindow(Window& w) const;
+
+  void
+  decreaseWindow(Window& w, time::steady_clock::time_point now) const;
+
+  void
+  applyPendingLoss(Window& w, time::steady_clock::time_point now) const;
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  static constexpr double DEFAULT_INITIAL_WINDOW = 4.0;
+  static constexpr double DEFAULT_AI = 1.0;
+  static constexpr double DEFAULT_MD = 0.5;
+  static constexpr double MIN_WINDOW = 1.0;
+  static constexpr time::seconds MEASUREMENTS_LIFETIME = 5_min;
+
+  std::unique_ptr<RetxSuppressionExponential> m_retxSuppression;
+  double m_initialWindow = DEFAULT_INITIAL_WINDOW;
+  double m_ai = DEFAULT_AI;
+  double m_md = DEFAULT_MD;
+
+  friend ProcessNackTraits<MultipathStrategy>;
+};
+
+} // namespace nfd::fw
+
+#endif // NFD_DAEMON_FW_MULTIPATH_STRATEGY_HPP
@@ -60,9 +60,10 @@ RandomStrategy::afterReceiveInterest(const Interest& interest, const FaceEndpoin
                                      const shared_ptr<pit::Entry>& pitEntry)
 {
   const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
+  auto nexthops = fibEntry.getNextHops();
   fib::NextHopList nhs;
 
-  std::copy_if(fibEntry.getNextHops().begin(), fibEntry.getNextHops().end(), std::back_inserter(nhs),
+  std::copy_if(nexthops->begin(), nexthops->end(), std::back_inserter(nhs),
                [&] (const auto& nh) { return isNextHopEligible(ingress.face, interest, nh, pitEntry); });
 
   if (nhs.empty()) {
@@ -50,6 +50,9 @@ public:
   RetxSuppressionExponential::Duration suppressionInterval;
 };
 
+// stored within the PIT entry or out-record, without allocation
+static_assert(sizeof(PitInfo) <= StrategyInfoHost::INLINE_SIZE);
+
 } // namespace
 
 RetxSuppressionExponential::RetxSuppressionExponential(Duration initialInterval,
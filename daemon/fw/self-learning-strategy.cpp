@@ -47,14 +47,20 @@ SelfLearningStrategy::SelfLearningStrategy(Forwarder& forwarder, const Name& nam
   : Strategy(forwarder)
 {
   ParsedInstanceName parsed = parseInstanceName(name);
-  if (!parsed.parameters.empty()) {
-    NDN_THROW(std::invalid_argument("SelfLearningStrategy does not accept parameters"));
-  }
   if (parsed.version && *parsed.version != getStrategyName()[-1].toVersion()) {
     NDN_THROW(std::invalid_argument(
       "SelfLearningStrategy does not support version " + to_string(*parsed.version)));
   }
+
+  StrategyParameters params = parseParameters(parsed.parameters);
+  auto floodInterval = params.getOrDefault<time::milliseconds::rep>("flood-interval", 0);
+  if (floodInterval < 0) {
+    NDN_THROW(std::invalid_argument("flood-interval must be >= 0"));
+  }
+  m_floodInterval = time::milliseconds(floodInterval);
+
   this->setInstanceName(makeInstanceName(name, getStrategyName()));
+  NFD_LOG_DEBUG("flood-interval=" << m_floodInterval);
 }
 
 const Name&
@@ -69,7 +75,8 @@ SelfLearningStrategy::afterReceiveInterest(const Interest& interest, const FaceE
                                            const shared_ptr<pit::Entry>& pitEntry)
 {
   const fib::Entry& fibEntry = this->lookupFib(*pitEntry);
-  const fib::NextHopList& nexthops = fibEntry.getNextHops();
+  auto nexthopsPtr = fibEntry.getNextHops();
+  const fib::NextHopList& nexthops = *nexthopsPtr;
 
   bool isNonDiscovery = interest.getTag<lp::NonDiscoveryTag>() != nullptr;
   auto inRecordInfo = pitEntry->getInRecord(ingress.face)->insertStrategyInfo<InRecordInfo>().first;
@@ -89,6 +96,10 @@ SelfLearningStrategy::afterReceiveInterest(const Interest& interest, const FaceE
   else { // "discovery" Interest
     inRecordInfo->isNonDiscoveryInterest = false;
     if (nexthops.empty()) { // broadcast it if no matching FIB entry exists
+      if (isFloodRateLimited(interest.getName())) {
+        NFD_LOG_DEBUG("discovery Interest=" << interest << " from=" << ingress << " flood-suppressed");
+        return;
+      }
       broadcastInterest(interest, ingress.face, pitEntry);
     }
     else { // multicast it with "non-discovery" mark if matching FIB entry exists
@@ -233,27 +244,86 @@ SelfLearningStrategy::needPrefixAnn(const shared_ptr<pit::Entry>& pitEntry)
   return hasDiscoveryInterest && !directToConsumer;
 }
 
+bool
+SelfLearningStrategy::isFloodRateLimited(const Name& name)
+{
+  if (m_floodInterval <= 0_ms) {
+    return false;
+  }
+
+  auto* me = this->getMeasurements().get(name.size() > 1 ? name.getPrefix(-1) : name);
+  if (me == nullptr) {
+    return false;
+  }
+
+  auto now = time::steady_clock::now();
+  auto [mi, isNew] = me->insertStrategyInfo<MtInfo>();
+  if (!isNew && now - mi->lastFlood < m_floodInterval) {
+    return true;
+  }
+  mi->lastFlood = now;
+  this->getMeasurements().extendLifetime(*me, m_floodInterval);
+  return false;
+}
+
 void
-SelfLearningStrategy::addRoute(const shared_ptr<pit::Entry>& pitEntry, const Face& inFace,
-                               const Data& data, const ndn::PrefixAnnouncement& pa)
+SelfLearningStrategy::addRoute(const shared_ptr<pit::Entry>&, const Face& inFace,
+                               const Data&, const ndn::PrefixAnnouncement& pa)
 {
-  runOnRibIoService([pitEntryWeak = weak_ptr<pit::Entry>{pitEntry}, inFaceId = inFace.getId(), data, pa] {
-    rib::Service::get().getRibManager().slAnnounce(pa, inFaceId, ROUTE_RENEW_LIFETIME,
-      [] (RibManager::SlAnnounceResult res) {
-        NFD_LOG_DEBUG("Add route via PrefixAnnouncement with result=" << res);
-      });
-  });
+  enqueueRouteUpdate({pa.getAnnouncedName(), inFace.getId(), pa, ROUTE_RENEW_LIFETIME});
 }
 
 void
 SelfLearningStrategy::renewRoute(const Name& name, FaceId inFaceId, time::milliseconds maxLifetime)
 {
   // renew route with PA or ignore PA (if route has no PA)
-  runOnRibIoService([name, inFaceId, maxLifetime] {
-    rib::Service::get().getRibManager().slRenew(name, inFaceId, maxLifetime,
-      [] (RibManager::SlAnnounceResult res) {
-        NFD_LOG_DEBUG("Renew route with result=" << res);
-      });
+  enqueueRouteUpdate({name, inFaceId, std::nullopt, maxLifetime});
+}
+
+void
+SelfLearningStrategy::enqueueRouteUpdate(RouteUpdate update)
+{
+  if (m_pendingRouteUpdates.empty()) {
+    m_flushEvent = getScheduler().schedule(0_ns, [this] { flushRouteUpdates(); });
+  }
+
+  auto [it, isNew] = m_pendingRouteUpdates.try_emplace({update.name, update.faceId}, update);
+  if (isNew) {
+    return;
+  }
+
+  // a renewal must not discard the PrefixAnnouncement of a queued announcement
+  auto& pending = it->second;
+  if (update.announcement) {
+    pending.announcement = std::move(update.announcement);
+  }
+  pending.lifetime = std::max(pending.lifetime, update.lifetime);
+}
+
+void
+SelfLearningStrategy::flushRouteUpdates()
+{
+  if (m_pendingRouteUpdates.empty()) {
+    return;
+  }
+
+  NFD_LOG_DEBUG("dispatching " << m_pendingRouteUpdates.size() << " route updates");
+  runOnRibIoService([updates = std::exchange(m_pendingRouteUpdates, {})] {
+    auto& ribManager = rib::Service::get().getRibManager();
+    for (const auto& [key, update] : updates) {
+      if (update.announcement) {
+        ribManager.slAnnounce(*update.announcement, update.faceId, update.lifetime,
+          [] (RibManager::SlAnnounceResult res) {
+            NFD_LOG_DEBUG("Add route via PrefixAnnouncement with result=" << res);
+          });
+      }
+      else {
+        ribManager.slRenew(update.name, update.faceId, update.lifetime,
+          [] (RibManager::SlAnnounceResult res) {
+            NFD_LOG_DEBUG("Renew route with result=" << res);
+          });
+      }
+    }
   });
 }
 
@@ -38,6 +38,13 @@ namespace nfd::fw {
  * This strategy first broadcasts Interest to learn a single path towards data,
  * then unicasts subsequent Interests along the learned path.
  *
+ * Route announcements and renewals triggered within one event loop iteration are
+ * coalesced and dispatched to the RIB thread as a single batch.
+ *
+ * Supported strategy parameters:
+ *  - `flood-interval~<ms>`: minimum interval between discovery floods under the same
+ *    prefix, i.e., the Interest name without its last component (default 0, unlimited)
+ *
  * \see https://redmine.named-data.net/attachments/864/Self-learning-strategy-v1.pdf
  */
 class SelfLearningStrategy : public Strategy
@@ -77,6 +84,20 @@ public:
     bool isNonDiscoveryInterest = false;
   };
 
+  /// StrategyInfo on Measurements entry
+  class MtInfo final : public StrategyInfo
+  {
+  public:
+    static constexpr int
+    getTypeId()
+    {
+      return 1042;
+    }
+
+  public:
+    time::steady_clock::time_point lastFlood;
+  };
+
 public: // triggers
   void
   afterReceiveInterest(const Interest& interest, const FaceEndpoint& ingress,
@@ -136,6 +157,39 @@ private: // operations
    */
   void
   renewRoute(const Name& name, FaceId inFaceId, time::milliseconds maxLifetime);
+
+  /** \brief Check whether a discovery flood for \p name must be suppressed,
+   *         and record the flood otherwise.
+   */
+  bool
+  isFloodRateLimited(const Name& name);
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  struct RouteUpdate
+  {
+    Name name;
+    FaceId faceId;
+    std::optional<ndn::PrefixAnnouncement> announcement; ///< if empty, the route is renewed
+    time::milliseconds lifetime;
+  };
+
+  /** \brief Queue a route update, to be dispatched at the end of the current event loop iteration.
+   *
+   *  A queued update for the same name and face is merged with \p update: the newer
+   *  PrefixAnnouncement is kept, if any, and the lifetime is the larger of the two.
+   */
+  void
+  enqueueRouteUpdate(RouteUpdate update);
+
+  /** \brief Dispatch all queued route updates to the RIB thread at once.
+   */
+  void
+  flushRouteUpdates();
+
+NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
+  time::milliseconds m_floodInterval = 0_ms;
+  std::map<std::pair<Name, FaceId>, RouteUpdate> m_pendingRouteUpdates;
+  scheduler::ScopedEventId m_flushEvent;
 };
 
 } // namespace nfd::fw
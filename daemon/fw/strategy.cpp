@@ -233,6 +233,29 @@ Strategy::sendInterest(const Interest& interest, Face& egress, const shared_ptr<
   return m_forwarder.onOutgoingInterest(interest, egress, pitEntry);
 }
 
+std::vector<pit::OutRecord*>
+Strategy::sendInterestToAll(const Interest& interest, const std::vector<Face*>& egresses,
+                            const shared_ptr<pit::Entry>& pitEntry)
+{
+  // strip the PIT token once, instead of copying the Interest for every upstream
+  const Interest* toSend = &interest;
+  std::optional<Interest> interest2;
+  if (interest.getTag<lp::PitToken>() != nullptr) {
+    interest2.emplace(interest);
+    interest2->removeTag<lp::PitToken>();
+    toSend = &*interest2;
+  }
+  // the encoding is cached in the Interest and reused by every egress face
+  toSend->wireEncode();
+
+  std::vector<pit::OutRecord*> outRecords;
+  outRecords.reserve(egresses.size());
+  for (Face* egress : egresses) {
+    outRecords.push_back(m_forwarder.onOutgoingInterest(*toSend, *egress, pitEntry));
+  }
+  return outRecords;
+}
+
 bool
 Strategy::sendData(const Data& data, Face& egress, const shared_ptr<pit::Entry>& pitEntry)
 {
@@ -284,6 +284,22 @@ protected: // actions
   NFD_VIRTUAL_WITH_TESTS pit::OutRecord*
   sendInterest(const Interest& interest, Face& egress, const shared_ptr<pit::Entry>& pitEntry);
 
+  /**
+   * \brief Send an Interest packet to multiple upstreams.
+   *
+   * This is equivalent to invoking sendInterest() for each face in \p egresses, but the Interest
+   * is prepared for sending only once, so that all upstreams share the same wire encoding.
+   *
+   * \param interest the Interest packet
+   * \param egresses faces through which to send out the Interest
+   * \param pitEntry the PIT entry
+   * \return The out-records, in the same order as \p egresses; an element is nullptr
+   *         if the Interest was dropped on the corresponding face
+   */
+  NFD_VIRTUAL_WITH_TESTS std::vector<pit::OutRecord*>
+  sendInterestToAll(const Interest& interest, const std::vector<Face*>& egresses,
+                    const shared_ptr<pit::Entry>& pitEntry);
+
   /**
    * \brief Send a Data packet.
    * \param data the Data packet
@@ -118,7 +118,9 @@ public:
     std::mutex m;
     std::condition_variable cv;
 
-    std::thread ribThread([configFile = m_configFile, &retval, &ribIo, mainIo, &cv, &m] {
+    // the datasets refer to the managers of the main thread, so they are collected here
+    std::thread ribThread([this, configFile = m_configFile, datasets = m_nfd.getSnapshotDatasets(),
+                           &retval, &ribIo, mainIo, &cv, &m] {
       {
         std::lock_guard<std::mutex> lock(m);
         ribIo = &getGlobalIoService();
@@ -131,6 +133,12 @@ public:
         ndn::KeyChain ribKeyChain;
         // must be created inside a separate thread
         rib::Service ribService(configFile, ribKeyChain);
+        // RIB and forwarder share this process, so FIB updates bypass management commands
+        ribService.setDirectFibUpdateFunc([this] (const rib::FibUpdate& update) {
+          return m_nfd.applyFibUpdate(update);
+        });
+        // encode and sign forwarder status datasets here, off the forwarding thread
+        ribService.publishDatasets(datasets);
         getGlobalIoService().run(); // ribIo is not thread-safe to use here
       }
       catch (const std::exception& e) {
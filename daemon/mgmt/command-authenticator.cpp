@@ -32,6 +32,8 @@
 #include <ndn-cxx/security/validation-policy.hpp>
 #include <ndn-cxx/security/validation-policy-accept-all.hpp>
 #include <ndn-cxx/security/validation-policy-command-interest.hpp>
+#include <ndn-cxx/security/verification-helpers.hpp>
+#include <ndn-cxx/security/transform/public-key.hpp>
 #include <ndn-cxx/util/io.hpp>
 
 #include <boost/filesystem.hpp>
@@ -66,10 +68,31 @@ getSignerFromTag(const Interest& interest)
 
 /**
  * \brief A validation policy that only permits Interests signed by a trust anchor.
+ *
+ * Public keys of trust anchors are kept in a verified-key cache indexed by KeyLocator name,
+ * so that repeated commands from the same signer are verified against an already decoded key
+ * without going through certificate retrieval. The signature of every Interest is still checked.
  */
 class CommandAuthenticatorValidationPolicy final : public security::ValidationPolicy
 {
 public:
+  CommandAuthenticatorValidationPolicy(const time::nanoseconds& keyCacheLifetime,
+                                       CommandAuthenticator::KeyCacheCounters& counters)
+    : m_keyCacheLifetime(keyCacheLifetime)
+    , m_counters(counters)
+  {
+  }
+
+  /** \brief Makes the public key of \p cert available to the verified-key cache.
+   *
+   *  The certificate must also be loaded as a trust anchor into the Validator.
+   */
+  void
+  addAnchor(const security::Certificate& cert)
+  {
+    m_anchors.push_back(cert);
+  }
+
   void
   checkPolicy(const Interest& interest, const shared_ptr<security::ValidationState>& state,
               const ValidationContinuation& continueValidation) final
@@ -89,7 +112,20 @@ public:
     auto state1 = dynamic_pointer_cast<security::InterestValidationState>(state);
     state1->getOriginalInterest().setTag(make_shared<SignerTag>(klName));
 
-    continueValidation(make_shared<security::CertificateRequest>(klName), state);
+    const security::transform::PublicKey* key = findKey(klName);
+    if (key == nullptr) {
+      continueValidation(make_shared<security::CertificateRequest>(klName), state);
+      return;
+    }
+
+    if (!security::verifySignature(interest, *key)) {
+      state->fail({security::ValidationError::INVALID_SIGNATURE,
+                   "Invalid signature of interest `" + interest.getName().toUri() + "`"});
+      return;
+    }
+    // signature already verified, so no certificate is needed; this still reports success
+    // through the outer command Interest policy, which records the timestamp
+    continueValidation(nullptr, state);
   }
 
   void
@@ -100,8 +136,77 @@ public:
     // Non-anchor certificates cannot be retrieved by offline fetcher.
     BOOST_ASSERT_MSG(false, "Data should not be passed to this policy");
   }
+
+private:
+  /** \brief Returns the public key of the trust anchor named by \p klName,
+   *         or nullptr if the cache is disabled or no such trust anchor exists.
+   */
+  const security::transform::PublicKey*
+  findKey(const Name& klName)
+  {
+    if (m_keyCacheLifetime <= 0_ns) {
+      return nullptr;
+    }
+
+    auto now = time::steady_clock::now();
+    auto it = m_keyCache.find(klName);
+    if (it != m_keyCache.end()) {
+      if (it->second.expiry > now) {
+        ++m_counters.nHits;
+        return it->second.key.get();
+      }
+      m_keyCache.erase(it);
+    }
+    ++m_counters.nMisses;
+
+    auto anchor = std::find_if(m_anchors.begin(), m_anchors.end(),
+                               [&] (const auto& cert) { return klName.isPrefixOf(cert.getName()); });
+    if (anchor == m_anchors.end()) {
+      return nullptr;
+    }
+
+    auto key = make_unique<security::transform::PublicKey>();
+    try {
+      key->loadPkcs8(anchor->getPublicKey());
+    }
+    catch (const security::transform::PublicKey::Error& e) {
+      NFD_LOG_DEBUG("cannot load public key of " << anchor->getName() << ": " << e.what());
+      return nullptr;
+    }
+
+    auto& entry = m_keyCache[klName];
+    entry.key = std::move(key);
+    entry.expiry = now + m_keyCacheLifetime;
+    return entry.key.get();
+  }
+
+private:
+  struct KeyCacheEntry
+  {
+    unique_ptr<security::transform::PublicKey> key;
+    time::steady_clock::time_point expiry;
+  };
+
+  const time::nanoseconds& m_keyCacheLifetime;
+  CommandAuthenticator::KeyCacheCounters& m_counters;
+  std::vector<security::Certificate> m_anchors;
+  std::map<Name, KeyCacheEntry> m_keyCache; // KeyLocator name => public key
 };
 
+/**
+ * \brief Returns the CommandAuthenticatorValidationPolicy of \p validator,
+ *        or nullptr if \p validator does not use one (e.g., 'certfile any').
+ */
+static CommandAuthenticatorValidationPolicy*
+getAuthenticatorPolicy(security::Validator& validator)
+{
+  auto& policy = validator.getPolicy();
+  if (!policy.hasInnerPolicy()) {
+    return nullptr;
+  }
+  return dynamic_cast<CommandAuthenticatorValidationPolicy*>(&policy.getInnerPolicy());
+}
+
 shared_ptr<CommandAuthenticator>
 CommandAuthenticator::create()
 {
@@ -125,7 +230,8 @@ CommandAuthenticator::processConfig(const ConfigSection& section, bool isDryRun,
     NFD_LOG_DEBUG("resetting authorizations");
     for (auto& kv : m_validators) {
       kv.second = make_shared<security::Validator>(
-        make_unique<security::ValidationPolicyCommandInterest>(make_unique<CommandAuthenticatorValidationPolicy>()),
+        make_unique<security::ValidationPolicyCommandInterest>(
+          make_unique<CommandAuthenticatorValidationPolicy>(m_keyCacheLifetime, m_keyCacheCounters)),
         make_unique<security::CertificateFetcherOffline>());
     }
   }
@@ -134,8 +240,14 @@ CommandAuthenticator::processConfig(const ConfigSection& section, bool isDryRun,
     NDN_THROW(ConfigFile::Error("'authorize' is missing under 'authorizations'"));
   }
 
+  auto keyCacheLifetime = time::nanoseconds(DEFAULT_KEY_CACHE_LIFETIME);
   int authSectionIndex = 0;
   for (const auto& [sectionName, authSection] : section) {
+    if (sectionName == "key_cache_lifetime") {
+      keyCacheLifetime = time::seconds(ConfigFile::parseNumber<uint32_t>(authSection, sectionName,
+                                                                         "authorizations"));
+      continue;
+    }
     if (sectionName != "authorize") {
       NDN_THROW(ConfigFile::Error("'" + sectionName + "' section is not permitted under 'authorizations'"));
     }
@@ -199,12 +311,20 @@ CommandAuthenticator::processConfig(const ConfigSection& section, bool isDryRun,
         const Name& keyName = cert->getKeyName();
         security::Certificate certCopy = *cert;
         found->second->loadAnchor(certfile, std::move(certCopy));
+        if (auto policy = getAuthenticatorPolicy(*found->second); policy != nullptr) {
+          policy->addAnchor(*cert);
+        }
         NFD_LOG_INFO("authorize module=" << module << " signer=" << keyName << " certfile=" << certfile);
       }
     }
 
     ++authSectionIndex;
   }
+
+  if (!isDryRun) {
+    m_keyCacheLifetime = keyCacheLifetime;
+    NFD_LOG_INFO("key_cache_lifetime=" << time::duration_cast<time::seconds>(m_keyCacheLifetime));
+  }
 }
 
 ndn::mgmt::Authorization
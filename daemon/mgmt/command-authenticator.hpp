@@ -27,6 +27,7 @@
 #define NFD_DAEMON_MGMT_COMMAND_AUTHENTICATOR_HPP
 
 #include "common/config-file.hpp"
+#include "common/counter.hpp"
 
 #include <ndn-cxx/mgmt/dispatcher.hpp>
 #include <ndn-cxx/security/validator.hpp>
@@ -41,6 +42,17 @@ namespace nfd {
 class CommandAuthenticator : public std::enable_shared_from_this<CommandAuthenticator>, noncopyable
 {
 public:
+  /**
+   * \brief Counters of the verified-key cache.
+   */
+  struct KeyCacheCounters
+  {
+    /// number of command Interests verified with a cached public key
+    PacketCounter nHits;
+    /// number of command Interests that required a public key to be resolved from trust anchors
+    PacketCounter nMisses;
+  };
+
   static shared_ptr<CommandAuthenticator>
   create();
 
@@ -55,6 +67,25 @@ public:
   ndn::mgmt::Authorization
   makeAuthorization(const std::string& module, const std::string& verb);
 
+  const KeyCacheCounters&
+  getKeyCacheCounters() const noexcept
+  {
+    return m_keyCacheCounters;
+  }
+
+  /** \brief Returns how long a public key resolved from a trust anchor is reused.
+   *
+   *  Zero means the cache is disabled.
+   */
+  time::nanoseconds
+  getKeyCacheLifetime() const noexcept
+  {
+    return m_keyCacheLifetime;
+  }
+
+public:
+  static constexpr time::seconds DEFAULT_KEY_CACHE_LIFETIME = 60_s;
+
 private:
   CommandAuthenticator();
 
@@ -67,6 +98,8 @@ private:
 private:
   // module => validator
   std::unordered_map<std::string, shared_ptr<ndn::security::Validator>> m_validators;
+  time::nanoseconds m_keyCacheLifetime = DEFAULT_KEY_CACHE_LIFETIME;
+  KeyCacheCounters m_keyCacheCounters;
 };
 
 } // namespace nfd
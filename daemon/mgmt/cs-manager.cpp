@@ -42,7 +42,7 @@ CsManager::CsManager(Cs& cs, const ForwarderCounters& fwCounters,
   registerCommandHandler<ndn::nfd::CsEraseCommand>("erase",
     std::bind(&CsManager::erase, this, _4, _5));
 
-  registerStatusDatasetHandler("info", std::bind(&CsManager::serveInfo, this, _1, _2, _3));
+  registerSnapshotDatasetHandler("info", std::bind(&CsManager::serveInfo, this));
 }
 
 void
@@ -98,8 +98,8 @@ CsManager::erase(const ControlParameters& parameters,
     });
 }
 
-void
-CsManager::serveInfo(const Name&, const Interest&, ndn::mgmt::StatusDatasetContext& context) const
+DatasetEncoder
+CsManager::serveInfo() const
 {
   ndn::nfd::CsInfo info;
   info.setCapacity(m_cs.getLimit());
@@ -109,8 +109,7 @@ CsManager::serveInfo(const Name&, const Interest&, ndn::mgmt::StatusDatasetConte
   info.setNHits(m_fwCounters.nCsHits);
   info.setNMisses(m_fwCounters.nCsMisses);
 
-  context.append(info.wireEncode());
-  context.end();
+  return makeListEncoder(std::vector<ndn::nfd::CsInfo>{info});
 }
 
 } // namespace nfd
@@ -61,9 +61,8 @@ private:
 
   /** \brief Serve CS information dataset.
    */
-  void
-  serveInfo(const Name& topPrefix, const Interest& interest,
-            ndn::mgmt::StatusDatasetContext& context) const;
+  DatasetEncoder
+  serveInfo() const;
 
 public:
   static constexpr size_t ERASE_LIMIT = 256;
@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dataset-change-log.hpp"
+
+#include <ndn-cxx/mgmt/control-response.hpp>
+#include <ndn-cxx/util/random.hpp>
+
+namespace nfd {
+
+DatasetChangeLog::DatasetChangeLog(size_t capacity)
+  : m_capacity(capacity)
+  // leave plenty of room for increments, and never start at 0, which requests all entries
+  , m_version((ndn::random::generateWord64() >> 2) + 1)
+  , m_oldestVersion(m_version)
+{
+  BOOST_ASSERT(m_capacity > 0);
+}
+
+void
+DatasetChangeLog::record(const Name& name)
+{
+  auto [it, isNew] = m_versions.try_emplace(name, ++m_version);
+  if (!isNew) {
+    m_log.erase(it->second);
+    it->second = m_version;
+  }
+  m_log.emplace_hint(m_log.end(), m_version, name);
+
+  if (m_log.size() > m_capacity) {
+    auto oldest = m_log.begin();
+    m_oldestVersion = oldest->first;
+    m_versions.erase(oldest->second);
+    m_log.erase(oldest);
+  }
+}
+
+std::optional<std::vector<Name>>
+DatasetChangeLog::getChangesSince(uint64_t version) const
+{
+  if (version < m_oldestVersion || version > m_version) {
+    return std::nullopt;
+  }
+
+  std::vector<Name> names;
+  for (auto it = m_log.upper_bound(version); it != m_log.end(); ++it) {
+    names.push_back(it->second);
+  }
+  return names;
+}
+
+std::function<bool(DatasetContext&)>
+DatasetChangeLog::resolve(const Interest& interest, const std::function<void()>& collectAll,
+                          const std::function<void(const Name&)>& collectChanged) const
+{
+  auto reject = [] (ndn::mgmt::ControlResponse response) {
+    return [response = std::move(response)] (DatasetContext& context) {
+      context.reject(response);
+      return false;
+    };
+  };
+
+  const auto& versionComponent = interest.getName().at(-1);
+  if (!versionComponent.isNumber()) {
+    return reject(ndn::mgmt::ControlResponse(400, "Malformed version"));
+  }
+
+  uint64_t version = versionComponent.toNumber();
+  if (version == 0) {
+    collectAll();
+  }
+  else {
+    auto changes = getChangesSince(version);
+    if (!changes) {
+      return reject(ndn::mgmt::ControlResponse(410, "Changes since version " + to_string(version) +
+                                               " are unavailable"));
+    }
+    for (const auto& name : *changes) {
+      collectChanged(name);
+    }
+  }
+
+  return [prefix = Name(interest.getName()).appendNumber(m_version)] (auto& context) {
+    context.setPrefix(prefix);
+    return true;
+  };
+}
+
+} // namespace nfd
@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_MGMT_DATASET_CHANGE_LOG_HPP
+#define NFD_DAEMON_MGMT_DATASET_CHANGE_LOG_HPP
+
+#include "dataset-publisher.hpp"
+
+#include <map>
+#include <unordered_map>
+
+namespace nfd {
+
+/**
+ * \brief Records which entries of a table have changed, to serve versioned status datasets.
+ *
+ * Every recorded change increments the version of the log. Only the latest change of each name
+ * is kept, and the oldest changes are dropped once \p capacity names are recorded. The first
+ * version is chosen randomly, so that a version obtained from another NFD instance is very
+ * unlikely to be accepted.
+ */
+class DatasetChangeLog : noncopyable
+{
+public:
+  explicit
+  DatasetChangeLog(size_t capacity = DEFAULT_CAPACITY);
+
+  /** \brief Returns the current version.
+   */
+  uint64_t
+  getVersion() const noexcept
+  {
+    return m_version;
+  }
+
+  /** \brief Returns the number of names currently recorded.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_log.size();
+  }
+
+  /** \brief Records that the entry of \p name has been inserted, modified, or erased.
+   */
+  void
+  record(const Name& name);
+
+  /** \brief Returns the names of entries changed after \p version, oldest change first.
+   *  \return the changed names, or std::nullopt if these changes are no longer recorded
+   *          or \p version is newer than the current version
+   */
+  std::optional<std::vector<Name>>
+  getChangesSince(uint64_t version) const;
+
+  /** \brief Resolves a `<module>/<verb>/<version>` status dataset request.
+   *
+   *  The last component of \p interest must be a NonNegativeInteger. Version 0 requests all
+   *  entries, which are collected by \p collectAll. Any other version requests the entries that
+   *  changed after it, each of which is collected by \p collectChanged; this is also invoked for
+   *  entries that have since been erased. The collect functions are invoked before this
+   *  function returns.
+   *
+   *  The request is rejected with status code 400 if the version is malformed, or with status
+   *  code 410 if the changes are no longer available, in which case the requester should start
+   *  over with version 0.
+   *
+   *  \return a function that begins the response: it either rejects the request and returns
+   *          false, or appends the current version to the Data prefix, so that the requester
+   *          can use it in its next request, and returns true to indicate that the collected
+   *          entries should be appended. It does not access the log, so it can be invoked
+   *          on any thread.
+   */
+  std::function<bool(DatasetContext&)>
+  resolve(const Interest& interest, const std::function<void()>& collectAll,
+          const std::function<void(const Name&)>& collectChanged) const;
+
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 65536;
+
+private:
+  std::map<uint64_t, Name> m_log; // version => name
+  std::unordered_map<Name, uint64_t> m_versions; // name => version in m_log
+  const size_t m_capacity;
+  uint64_t m_version;
+  uint64_t m_oldestVersion; // changes after this version are all recorded
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_MGMT_DATASET_CHANGE_LOG_HPP
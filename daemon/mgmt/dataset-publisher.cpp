@@ -0,0 +1,197 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "dataset-publisher.hpp"
+#include "common/global.hpp"
+#include "common/logger.hpp"
+
+#include <ndn-cxx/mgmt/nfd/control-command.hpp>
+#include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
+
+namespace nfd {
+
+NFD_LOG_INIT(DatasetPublisher);
+
+ndn::mgmt::StatusDatasetHandler
+makeSnapshotDatasetHandler(DatasetSnapshotter snapshot)
+{
+  return [snapshot = std::move(snapshot)] (const Name& topPrefix, const Interest& interest,
+                                           ndn::mgmt::StatusDatasetContext& context) {
+    DispatcherDatasetContext datasetContext(context);
+    snapshot(topPrefix, interest)(datasetContext);
+  };
+}
+
+namespace {
+
+/**
+ * \brief A DatasetContext that collects the response, so that it can be segmented at once.
+ */
+class BufferingDatasetContext final : public DatasetContext
+{
+public:
+  explicit
+  BufferingDatasetContext(const Name& interestName)
+    : prefix(interestName)
+  {
+  }
+
+  void
+  setPrefix(const Name& newPrefix) final
+  {
+    BOOST_ASSERT(buffer.empty() && !isFinalized);
+    BOOST_ASSERT(prefix.isPrefixOf(newPrefix));
+    prefix = newPrefix;
+  }
+
+  void
+  append(const Block& block) final
+  {
+    BOOST_ASSERT(!isFinalized);
+    buffer.insert(buffer.end(), block.begin(), block.end());
+  }
+
+  void
+  end() final
+  {
+    BOOST_ASSERT(!isFinalized);
+    isFinalized = true;
+  }
+
+  void
+  reject(const ndn::mgmt::ControlResponse& resp) final
+  {
+    BOOST_ASSERT(buffer.empty() && !isFinalized);
+    isFinalized = true;
+    nack = resp;
+  }
+
+public:
+  Name prefix;
+  std::vector<uint8_t> buffer;
+  std::optional<ndn::mgmt::ControlResponse> nack;
+  bool isFinalized = false;
+};
+
+} // namespace
+
+DatasetPublisher::DatasetPublisher(ndn::Face& face, ndn::KeyChain& keyChain,
+                                   ndn::nfd::Controller& controller,
+                                   const std::vector<SnapshotDataset>& datasets)
+  : m_face(face)
+  , m_keyChain(keyChain)
+  , m_segmenter(keyChain, ndn::security::SigningInfo())
+  , m_storage(face.getIoService())
+  , m_aliveToken(make_shared<AliveToken>(face.getIoService()))
+{
+  for (const auto& dataset : datasets) {
+    Name prefix = Name(TOP_PREFIX).append(dataset.relPrefix);
+    m_interestFilters.emplace_back(m_face.setInterestFilter(prefix,
+      [this, snapshot = dataset.snapshot] (const auto&, const Interest& interest) {
+        processInterest(snapshot, interest);
+      }));
+
+    controller.start<ndn::nfd::FibAddNextHopCommand>(
+      ndn::nfd::ControlParameters().setName(prefix).setFaceId(0),
+      [prefix] (const auto&) {
+        NFD_LOG_DEBUG("serving " << prefix);
+      },
+      [prefix] (const ndn::nfd::ControlResponse& res) {
+        NFD_LOG_WARN("cannot add FIB entry " << prefix << " (" << res.getCode() << " " <<
+                     res.getText() << "), dataset stays on the main thread");
+      });
+  }
+}
+
+DatasetPublisher::~DatasetPublisher()
+{
+  m_aliveToken->close();
+}
+
+void
+DatasetPublisher::processInterest(const DatasetSnapshotter& snapshot, const Interest& interest)
+{
+  auto data = m_storage.find(interest);
+  if (data != nullptr) {
+    m_face.put(*data);
+    return;
+  }
+
+  // a segment of a response that is no longer stored
+  const auto& lastComponent = interest.getName().at(-1);
+  if (lastComponent.isVersion() || lastComponent.isSegment()) {
+    return;
+  }
+
+  if (&m_face.getIoService() == &getMainIoService()) {
+    publish(interest, snapshot(TOP_PREFIX, interest));
+    return;
+  }
+
+  // the snapshot is taken on the main thread, and the encoder is posted back to this thread,
+  // unless the publisher has been destroyed in the meantime
+  runOnMainIoService([this, token = m_aliveToken, snapshot, interest] {
+    auto encoder = snapshot(TOP_PREFIX, interest);
+    token->post([this, interest, encoder = std::move(encoder)] {
+      publish(interest, encoder);
+    });
+  });
+}
+
+void
+DatasetPublisher::publish(const Interest& interest, const DatasetEncoder& encoder)
+{
+  NFD_LOG_TRACE("publishing " << interest.getName());
+
+  BufferingDatasetContext context(interest.getName());
+  encoder(context);
+  BOOST_ASSERT(context.isFinalized);
+
+  if (context.nack) {
+    auto data = make_shared<Data>(interest.getName());
+    data->setContentType(tlv::ContentType_Nack)
+         .setContent(context.nack->wireEncode())
+         .setFreshnessPeriod(DATA_FRESHNESS);
+    m_keyChain.sign(*data);
+    m_face.put(*data);
+    return;
+  }
+
+  Name versionedName = context.prefix;
+  if (!versionedName[-1].isVersion()) {
+    versionedName.appendVersion();
+  }
+  auto segments = m_segmenter.segment(context.buffer, versionedName, MAX_SEGMENT_SIZE,
+                                      DATA_FRESHNESS);
+
+  // the following segments are sent when they are requested
+  for (const auto& segment : segments) {
+    m_storage.insert(*segment, DATA_FRESHNESS);
+  }
+  m_face.put(*segments.front());
+}
+
+} // namespace nfd
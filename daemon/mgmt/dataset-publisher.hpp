@@ -0,0 +1,211 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_MGMT_DATASET_PUBLISHER_HPP
+#define NFD_DAEMON_MGMT_DATASET_PUBLISHER_HPP
+
+#include "core/common.hpp"
+#include "common/global.hpp"
+
+#include <ndn-cxx/face.hpp>
+#include <ndn-cxx/ims/in-memory-storage-fifo.hpp>
+#include <ndn-cxx/mgmt/dispatcher.hpp>
+#include <ndn-cxx/mgmt/nfd/controller.hpp>
+#include <ndn-cxx/util/segmenter.hpp>
+
+namespace nfd {
+
+/**
+ * \brief The response to a status dataset request, as used by a DatasetEncoder.
+ *
+ * It provides the same operations as ndn::mgmt::StatusDatasetContext, which can only be used
+ * before the handler of a Dispatcher returns, so that a response can also be encoded later.
+ */
+class DatasetContext : noncopyable
+{
+public:
+  virtual
+  ~DatasetContext() = default;
+
+  /** \brief Changes the prefix of the response Data packets.
+   *  \pre No block has been appended yet, and the Interest name is a prefix of \p prefix.
+   */
+  virtual void
+  setPrefix(const Name& prefix) = 0;
+
+  /** \brief Appends \p block to the response.
+   */
+  virtual void
+  append(const Block& block) = 0;
+
+  /** \brief Ends the response, after all blocks have been appended.
+   */
+  virtual void
+  end() = 0;
+
+  /** \brief Rejects the request with \p resp, before anything has been appended.
+   */
+  virtual void
+  reject(const ndn::mgmt::ControlResponse& resp) = 0;
+};
+
+/**
+ * \brief A DatasetContext that forwards to the StatusDatasetContext of a Dispatcher.
+ */
+class DispatcherDatasetContext final : public DatasetContext
+{
+public:
+  explicit
+  DispatcherDatasetContext(ndn::mgmt::StatusDatasetContext& context)
+    : m_context(context)
+  {
+  }
+
+  void
+  setPrefix(const Name& prefix) final
+  {
+    m_context.setPrefix(prefix);
+  }
+
+  void
+  append(const Block& block) final
+  {
+    m_context.append(block);
+  }
+
+  void
+  end() final
+  {
+    m_context.end();
+  }
+
+  void
+  reject(const ndn::mgmt::ControlResponse& resp) final
+  {
+    m_context.reject(resp);
+  }
+
+private:
+  ndn::mgmt::StatusDatasetContext& m_context;
+};
+
+/**
+ * \brief A function that appends a previously taken snapshot to a status dataset response.
+ *
+ * It must only access the snapshot it owns, so that it can be invoked on any thread.
+ */
+using DatasetEncoder = std::function<void(DatasetContext& context)>;
+
+/**
+ * \brief A function that takes a snapshot of a status dataset on the thread of its table.
+ */
+using DatasetSnapshotter = std::function<DatasetEncoder(const Name& topPrefix,
+                                                        const Interest& interest)>;
+
+/**
+ * \brief A status dataset whose responses are encoded from a snapshot.
+ */
+struct SnapshotDataset
+{
+  PartialName relPrefix;
+  DatasetSnapshotter snapshot;
+};
+
+/**
+ * \brief Returns a StatusDatasetHandler that takes a snapshot and encodes it immediately.
+ */
+ndn::mgmt::StatusDatasetHandler
+makeSnapshotDatasetHandler(DatasetSnapshotter snapshot);
+
+/**
+ * \brief Returns a DatasetEncoder that appends each of \p items, and then ends the response.
+ */
+template<typename T>
+DatasetEncoder
+makeListEncoder(std::vector<T> items)
+{
+  return [items = std::move(items)] (DatasetContext& context) {
+    for (const auto& item : items) {
+      context.append(item.wireEncode());
+    }
+    context.end();
+  };
+}
+
+/**
+ * \brief Serves status datasets of the forwarder on a thread other than the main thread.
+ *
+ * For each request, a snapshot is taken on the main thread, and the resulting encoder is posted
+ * back to the thread of \p face, where the response is encoded, then segmented and signed by
+ * an ndn::Segmenter. Neither thread waits for the other. The segments are kept for a short while
+ * to answer the requests for the following segments, like a Dispatcher does.
+ *
+ * Routes toward \p face are added to the forwarder for every dataset, so that their requests
+ * reach this publisher instead of the main thread dispatcher, whose handlers for the same
+ * datasets are still used until the routes exist.
+ */
+class DatasetPublisher : noncopyable
+{
+public:
+  /**
+   * \param face a face connected to the forwarder, owned by the current thread
+   * \param keyChain the KeyChain to sign responses
+   * \param controller a Controller on \p face, used to add routes
+   * \param datasets the datasets to serve, relative to `/localhost/nfd`
+   */
+  DatasetPublisher(ndn::Face& face, ndn::KeyChain& keyChain, ndn::nfd::Controller& controller,
+                   const std::vector<SnapshotDataset>& datasets);
+
+  ~DatasetPublisher();
+
+private:
+  void
+  processInterest(const DatasetSnapshotter& snapshot, const Interest& interest);
+
+  /** \brief Encodes the response to \p interest, on the thread of the face, and sends its
+   *         first segment.
+   */
+  void
+  publish(const Interest& interest, const DatasetEncoder& encoder);
+
+public:
+  static inline const Name TOP_PREFIX{"/localhost/nfd"};
+  static constexpr time::milliseconds DATA_FRESHNESS = 1_s;
+  /// same as a Dispatcher, leaving room for the name and the signature
+  static constexpr size_t MAX_SEGMENT_SIZE = ndn::MAX_NDN_PACKET_SIZE - 800;
+
+private:
+  ndn::Face& m_face;
+  ndn::KeyChain& m_keyChain;
+  ndn::Segmenter m_segmenter;
+  ndn::InMemoryStorageFifo m_storage;
+  std::vector<ndn::ScopedInterestFilterHandle> m_interestFilters;
+  // lets the main thread post encoders back, until the publisher is destroyed
+  shared_ptr<AliveToken> m_aliveToken;
+};
+
+} // namespace nfd
+
+#endif // NFD_DAEMON_MGMT_DATASET_PUBLISHER_HPP
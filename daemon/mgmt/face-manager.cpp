@@ -55,9 +55,9 @@ FaceManager::FaceManager(FaceSystem& faceSystem,
     std::bind(&FaceManager::destroyFace, this, _4, _5));
 
   // register handlers for StatusDataset
-  registerStatusDatasetHandler("list", std::bind(&FaceManager::listFaces, this, _3));
-  registerStatusDatasetHandler("channels", std::bind(&FaceManager::listChannels, this, _3));
-  registerStatusDatasetHandler("query", std::bind(&FaceManager::queryFaces, this, _2, _3));
+  registerSnapshotDatasetHandler("list", std::bind(&FaceManager::listFaces, this));
+  registerSnapshotDatasetHandler("channels", std::bind(&FaceManager::listChannels, this));
+  registerSnapshotDatasetHandler("query", std::bind(&FaceManager::queryFaces, this, _2));
 
   // register notification stream
   m_postNotification = registerNotificationStream("events");
@@ -395,29 +395,31 @@ makeFaceStatus(const Face& face, const time::steady_clock::time_point& now)
   return status;
 }
 
-void
-FaceManager::listFaces(ndn::mgmt::StatusDatasetContext& context)
+DatasetEncoder
+FaceManager::listFaces()
 {
   auto now = time::steady_clock::now();
+  std::vector<ndn::nfd::FaceStatus> statuses;
+  statuses.reserve(m_faceTable.size());
   for (const auto& face : m_faceTable) {
-    ndn::nfd::FaceStatus status = makeFaceStatus(face, now);
-    context.append(status.wireEncode());
+    statuses.push_back(makeFaceStatus(face, now));
   }
-  context.end();
+  return makeListEncoder(std::move(statuses));
 }
 
-void
-FaceManager::listChannels(ndn::mgmt::StatusDatasetContext& context)
+DatasetEncoder
+FaceManager::listChannels()
 {
+  std::vector<ndn::nfd::ChannelStatus> entries;
   auto factories = m_faceSystem.listProtocolFactories();
   for (const auto* factory : factories) {
     for (const auto& channel : factory->getChannels()) {
       ndn::nfd::ChannelStatus entry;
       entry.setLocalUri(channel->getUri().toString());
-      context.append(entry.wireEncode());
+      entries.push_back(std::move(entry));
     }
   }
-  context.end();
+  return makeListEncoder(std::move(entries));
 }
 
 static bool
@@ -462,9 +464,8 @@ matchFilter(const ndn::nfd::FaceQueryFilter& filter, const Face& face)
   return true;
 }
 
-void
-FaceManager::queryFaces(const Interest& interest,
-                        ndn::mgmt::StatusDatasetContext& context)
+DatasetEncoder
+FaceManager::queryFaces(const Interest& interest)
 {
   ndn::nfd::FaceQueryFilter faceFilter;
   try {
@@ -472,17 +473,19 @@ FaceManager::queryFaces(const Interest& interest,
   }
   catch (const tlv::Error& e) {
     NFD_LOG_DEBUG("Malformed query filter: " << e.what());
-    return context.reject(ControlResponse(400, "Malformed filter"));
+    return [] (DatasetContext& context) {
+      context.reject(ControlResponse(400, "Malformed filter"));
+    };
   }
 
   auto now = time::steady_clock::now();
+  std::vector<ndn::nfd::FaceStatus> statuses;
   for (const auto& face : m_faceTable) {
     if (matchFilter(faceFilter, face)) {
-      ndn::nfd::FaceStatus status = makeFaceStatus(face, now);
-      context.append(status.wireEncode());
+      statuses.push_back(makeFaceStatus(face, now));
     }
   }
-  context.end();
+  return makeListEncoder(std::move(statuses));
 }
 
 void
@@ -63,14 +63,14 @@ private: // helpers for ControlCommand
                          const ndn::mgmt::CommandContinuation& done);
 
 private: // StatusDataset
-  void
-  listFaces(ndn::mgmt::StatusDatasetContext& context);
+  DatasetEncoder
+  listFaces();
 
-  void
-  listChannels(ndn::mgmt::StatusDatasetContext& context);
+  DatasetEncoder
+  listChannels();
 
-  void
-  queryFaces(const Interest& interest, ndn::mgmt::StatusDatasetContext& context);
+  DatasetEncoder
+  queryFaces(const Interest& interest);
 
 private: // NotificationStream
   void
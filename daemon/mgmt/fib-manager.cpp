@@ -49,7 +49,11 @@ FibManager::FibManager(Fib& fib, const FaceTable& faceTable,
   registerCommandHandler<ndn::nfd::FibRemoveNextHopCommand>("remove-nexthop",
     std::bind(&FibManager::removeNextHop, this, _2, _3, _4, _5));
 
-  registerStatusDatasetHandler("list", std::bind(&FibManager::listEntries, this, _1, _2, _3));
+  registerSnapshotDatasetHandler("list", std::bind(&FibManager::listEntries, this, _1, _2));
+
+  m_changeConn = m_fib.afterNextHopsChange.connect([this] (const Name& prefix) {
+    m_changeLog.record(prefix);
+  });
 }
 
 void
@@ -58,52 +62,62 @@ FibManager::addNextHop(const Name&, const Interest& interest,
                        const ndn::mgmt::CommandContinuation& done)
 {
   setFaceForSelfRegistration(interest, parameters);
-  const Name& prefix = parameters.getName();
-  FaceId faceId = parameters.getFaceId();
-  uint64_t cost = parameters.getCost();
+  auto response = applyAddNextHop(parameters.getName(), parameters.getFaceId(), parameters.getCost());
+  if (response.getCode() == 200) {
+    response.setBody(parameters.wireEncode());
+  }
+  done(response);
+}
 
+void
+FibManager::removeNextHop(const Name&, const Interest& interest,
+                          ControlParameters parameters,
+                          const ndn::mgmt::CommandContinuation& done)
+{
+  setFaceForSelfRegistration(interest, parameters);
+  auto response = applyRemoveNextHop(parameters.getName(), parameters.getFaceId());
+  done(response.setBody(parameters.wireEncode()));
+}
+
+ControlResponse
+FibManager::applyAddNextHop(const Name& prefix, FaceId faceId, uint64_t cost)
+{
   if (prefix.size() > Fib::getMaxDepth()) {
     NFD_LOG_DEBUG("fib/add-nexthop(" << prefix << ',' << faceId << ',' << cost <<
                   "): FAIL prefix-too-long");
-    return done(ControlResponse(414, "FIB entry prefix cannot exceed " +
-                                to_string(Fib::getMaxDepth()) + " components"));
+    return ControlResponse(414, "FIB entry prefix cannot exceed " +
+                           to_string(Fib::getMaxDepth()) + " components");
   }
 
   Face* face = m_faceTable.get(faceId);
   if (face == nullptr) {
     NFD_LOG_DEBUG("fib/add-nexthop(" << prefix << ',' << faceId << ',' << cost <<
                   "): FAIL unknown-faceid");
-    return done(ControlResponse(410, "Face not found"));
+    return ControlResponse(410, "Face not found");
   }
 
   fib::Entry* entry = m_fib.insert(prefix).first;
   m_fib.addOrUpdateNextHop(*entry, *face, cost);
 
   NFD_LOG_TRACE("fib/add-nexthop(" << prefix << ',' << faceId << ',' << cost << "): OK");
-  return done(ControlResponse(200, "Success").setBody(parameters.wireEncode()));
+  return ControlResponse(200, "Success");
 }
 
-void
-FibManager::removeNextHop(const Name&, const Interest& interest,
-                          ControlParameters parameters,
-                          const ndn::mgmt::CommandContinuation& done)
+ControlResponse
+FibManager::applyRemoveNextHop(const Name& prefix, FaceId faceId)
 {
-  setFaceForSelfRegistration(interest, parameters);
-  const Name& prefix = parameters.getName();
-  FaceId faceId = parameters.getFaceId();
-
-  done(ControlResponse(200, "Success").setBody(parameters.wireEncode()));
+  const ControlResponse success(200, "Success");
 
   Face* face = m_faceTable.get(faceId);
   if (face == nullptr) {
     NFD_LOG_TRACE("fib/remove-nexthop(" << prefix << ',' << faceId << "): OK no-face");
-    return;
+    return success;
   }
 
-  fib::Entry* entry = m_fib.findExactMatch(parameters.getName());
+  fib::Entry* entry = m_fib.findExactMatch(prefix);
   if (entry == nullptr) {
     NFD_LOG_TRACE("fib/remove-nexthop(" << prefix << ',' << faceId << "): OK no-entry");
-    return;
+    return success;
   }
 
   auto status = m_fib.removeNextHop(*entry, *face);
@@ -118,25 +132,63 @@ FibManager::removeNextHop(const Name&, const Interest& interest,
       NFD_LOG_TRACE("fib/remove-nexthop(" << prefix << ',' << faceId << "): OK nexthop-removed");
       break;
   }
+  return success;
 }
 
-void
-FibManager::listEntries(const Name&, const Interest&,
-                        ndn::mgmt::StatusDatasetContext& context)
+static ndn::nfd::FibEntry
+makeFibEntry(const fib::EntrySnapshot& entry)
 {
-  for (const auto& entry : m_fib) {
-    const auto& nexthops = entry.getNextHops() |
-                           boost::adaptors::transformed([] (const fib::NextHop& nh) {
-                             return ndn::nfd::NextHopRecord()
-                                 .setFaceId(nh.getFace().getId())
-                                 .setCost(nh.getCost());
-                           });
-    context.append(ndn::nfd::FibEntry()
-                   .setPrefix(entry.getPrefix())
-                   .setNextHopRecords(std::begin(nexthops), std::end(nexthops))
-                   .wireEncode());
+  auto fibEntry = ndn::nfd::FibEntry().setPrefix(entry.prefix);
+  if (entry.nextHops == nullptr) {
+    return fibEntry;
   }
-  context.end();
+
+  // the faces may be gone when this runs on another thread, so they must not be accessed
+  const auto& nexthops = *entry.nextHops |
+                         boost::adaptors::transformed([] (const fib::NextHop& nh) {
+                           return ndn::nfd::NextHopRecord()
+                               .setFaceId(nh.getFaceId())
+                               .setCost(nh.getCost());
+                         });
+  return fibEntry.setNextHopRecords(std::begin(nexthops), std::end(nexthops));
+}
+
+DatasetEncoder
+FibManager::listEntries(const Name& topPrefix, const Interest& interest)
+{
+  // nexthop lists are shared with the FIB, and converted when the response is encoded
+  std::vector<fib::EntrySnapshot> entries;
+  auto collectAll = [&] {
+    entries = m_fib.takeSnapshot();
+  };
+
+  std::function<bool(DatasetContext&)> begin;
+  // topPrefix + "fib" + "list" + version
+  if (interest.getName().size() > topPrefix.size() + 2) {
+    begin = m_changeLog.resolve(interest, collectAll, [&] (const Name& prefix) {
+      const fib::Entry* entry = m_fib.findExactMatch(prefix);
+      if (entry != nullptr) {
+        entries.push_back(entry->getSnapshot());
+      }
+      else {
+        // an entry without nexthops indicates that the entry has been erased
+        entries.push_back({prefix, nullptr});
+      }
+    });
+  }
+  else {
+    collectAll();
+  }
+
+  return [begin = std::move(begin), entries = std::move(entries)] (auto& context) {
+    if (begin && !begin(context)) {
+      return;
+    }
+    for (const auto& entry : entries) {
+      context.append(makeFibEntry(entry).wireEncode());
+    }
+    context.end();
+  };
 }
 
 void
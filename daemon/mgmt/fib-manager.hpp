@@ -26,7 +26,9 @@
 #ifndef NFD_DAEMON_MGMT_FIB_MANAGER_HPP
 #define NFD_DAEMON_MGMT_FIB_MANAGER_HPP
 
+#include "dataset-change-log.hpp"
 #include "manager-base.hpp"
+#include "face/face-common.hpp"
 
 namespace nfd {
 
@@ -46,6 +48,21 @@ public:
   FibManager(fib::Fib& fib, const FaceTable& faceTable,
              Dispatcher& dispatcher, CommandAuthenticator& authenticator);
 
+  /**
+   * @brief Adds or updates a nexthop, in the same way as the fib/add-nexthop command.
+   * @return status code 200 on success, 410 if the face does not exist,
+   *         or 414 if the prefix is too long
+   */
+  ControlResponse
+  applyAddNextHop(const Name& prefix, FaceId faceId, uint64_t cost);
+
+  /**
+   * @brief Removes a nexthop, in the same way as the fib/remove-nexthop command.
+   * @return always status code 200
+   */
+  ControlResponse
+  applyRemoveNextHop(const Name& prefix, FaceId faceId);
+
 private:
   void
   addNextHop(const Name& topPrefix, const Interest& interest,
@@ -57,9 +74,13 @@ private:
                 ControlParameters parameters,
                 const ndn::mgmt::CommandContinuation& done);
 
-  void
-  listEntries(const Name& topPrefix, const Interest& interest,
-              ndn::mgmt::StatusDatasetContext& context);
+  /**
+   * @brief Serves fib/list dataset.
+   *
+   * `fib/list/<version>` lists only the entries changed since @p version, see DatasetChangeLog.
+   */
+  DatasetEncoder
+  listEntries(const Name& topPrefix, const Interest& interest);
 
 private:
   void
@@ -68,6 +89,8 @@ private:
 private:
   fib::Fib& m_fib;
   const FaceTable& m_faceTable;
+  DatasetChangeLog m_changeLog;
+  signal::ScopedConnection m_changeConn;
 };
 
 } // namespace nfd
@@ -34,8 +34,10 @@ ForwarderStatusManager::ForwarderStatusManager(Forwarder& forwarder, Dispatcher&
   , m_dispatcher(dispatcher)
   , m_startTimestamp(time::system_clock::now())
 {
-  m_dispatcher.addStatusDataset("status/general", ndn::mgmt::makeAcceptAllAuthorization(),
-                                std::bind(&ForwarderStatusManager::listGeneralStatus, this, _1, _2, _3));
+  SnapshotDataset generalStatus{"status/general", [this] (auto&&...) { return listGeneralStatus(); }};
+  m_dispatcher.addStatusDataset(generalStatus.relPrefix, ndn::mgmt::makeAcceptAllAuthorization(),
+                                makeSnapshotDatasetHandler(generalStatus.snapshot));
+  m_snapshotDatasets.push_back(std::move(generalStatus));
 }
 
 ndn::nfd::ForwarderStatus
@@ -66,17 +68,17 @@ ForwarderStatusManager::collectGeneralStatus()
   return status;
 }
 
-void
-ForwarderStatusManager::listGeneralStatus(const Name&, const Interest&,
-                                          ndn::mgmt::StatusDatasetContext& context)
+DatasetEncoder
+ForwarderStatusManager::listGeneralStatus()
 {
-  auto status = this->collectGeneralStatus();
-  const auto& wire = status.wireEncode();
-  wire.parse();
-  for (const auto& subblock : wire.elements()) {
-    context.append(subblock);
-  }
-  context.end();
+  return [status = this->collectGeneralStatus()] (DatasetContext& context) {
+    const auto& wire = status.wireEncode();
+    wire.parse();
+    for (const auto& subblock : wire.elements()) {
+      context.append(subblock);
+    }
+    context.end();
+  };
 }
 
 } // namespace nfd
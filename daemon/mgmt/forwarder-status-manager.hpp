@@ -43,6 +43,15 @@ class ForwarderStatusManager : noncopyable
 public:
   ForwarderStatusManager(Forwarder& forwarder, Dispatcher& dispatcher);
 
+  /**
+   * \brief Returns the status datasets that can be served by a DatasetPublisher.
+   */
+  const std::vector<SnapshotDataset>&
+  getSnapshotDatasets() const
+  {
+    return m_snapshotDatasets;
+  }
+
 private:
   ndn::nfd::ForwarderStatus
   collectGeneralStatus();
@@ -50,14 +59,14 @@ private:
   /**
    * \brief Provides the general status dataset.
    */
-  void
-  listGeneralStatus(const Name& topPrefix, const Interest& interest,
-                    ndn::mgmt::StatusDatasetContext& context);
+  DatasetEncoder
+  listGeneralStatus();
 
 private:
   Forwarder& m_forwarder;
   Dispatcher& m_dispatcher;
   time::system_clock::time_point m_startTimestamp;
+  std::vector<SnapshotDataset> m_snapshotDatasets;
 };
 
 } // namespace nfd
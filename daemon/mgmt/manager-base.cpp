@@ -25,6 +25,8 @@
 
 #include "manager-base.hpp"
 
+#include <algorithm>
+
 namespace nfd {
 
 ManagerBase::ManagerBase(const std::string& module, Dispatcher& dispatcher)
@@ -52,6 +54,14 @@ ManagerBase::registerStatusDatasetHandler(const std::string& verb,
                                 handler);
 }
 
+void
+ManagerBase::registerSnapshotDatasetHandler(const std::string& verb,
+                                            const DatasetSnapshotter& snapshot)
+{
+  registerStatusDatasetHandler(verb, makeSnapshotDatasetHandler(snapshot));
+  m_snapshotDatasets.push_back({makeRelPrefix(verb), snapshot});
+}
+
 ndn::mgmt::PostNotification
 ManagerBase::registerNotificationStream(const std::string& verb)
 {
@@ -97,6 +107,18 @@ ManagerBase::validateParameters(const ControlCommand& command,
   return true;
 }
 
+bool
+ManagerBase::validateBatchParameters(const ControlCommand& command,
+                                     const ndn::mgmt::ControlParameters& parameters)
+{
+  BOOST_ASSERT(dynamic_cast<const ControlParametersList*>(&parameters) != nullptr);
+
+  const auto& items = static_cast<const ControlParametersList&>(parameters).getItems();
+  return !items.empty() &&
+         std::all_of(items.begin(), items.end(),
+                     [&] (const auto& item) { return validateParameters(command, item); });
+}
+
 void
 ManagerBase::handleCommand(shared_ptr<ControlCommand> command,
                            const ControlCommandHandler& handler,
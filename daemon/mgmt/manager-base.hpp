@@ -27,6 +27,8 @@
 #define NFD_DAEMON_MGMT_MANAGER_BASE_HPP
 
 #include "command-authenticator.hpp"
+#include "dataset-publisher.hpp"
+#include "core/control-parameters-list.hpp"
 
 #include <ndn-cxx/mgmt/dispatcher.hpp>
 #include <ndn-cxx/mgmt/nfd/control-command.hpp>
@@ -62,6 +64,15 @@ public:
     return m_module;
   }
 
+  /**
+   * @brief Returns the status datasets registered with registerSnapshotDatasetHandler().
+   */
+  const std::vector<SnapshotDataset>&
+  getSnapshotDatasets() const
+  {
+    return m_snapshotDatasets;
+  }
+
 protected:
   /**
    * @warning if you use this constructor, you MUST override makeAuthorization()
@@ -83,10 +94,35 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PROTECTED: // registrations to the dispatcher
   registerCommandHandler(const std::string& verb,
                          const ControlCommandHandler& handler);
 
+  using BatchCommandHandler = std::function<void(const ControlCommand& command,
+                                                 const Name& prefix, const Interest& interest,
+                                                 std::vector<ControlParameters> items,
+                                                 const ndn::mgmt::CommandContinuation& done)>;
+
+  /**
+   * @brief Registers a command whose parameters are a ControlParametersList.
+   *
+   * Each item of the list is validated and completed with defaults as the parameters of
+   * @p Command. The command is rejected if the list is empty or any item is invalid.
+   */
+  template<typename Command>
+  void
+  registerBatchCommandHandler(const std::string& verb,
+                              const BatchCommandHandler& handler);
+
   void
   registerStatusDatasetHandler(const std::string& verb,
                                const ndn::mgmt::StatusDatasetHandler& handler);
 
+  /**
+   * @brief Registers a status dataset whose responses are encoded from a snapshot.
+   *
+   * The dataset is served by this manager's dispatcher, and is also listed in
+   * getSnapshotDatasets(), so that a DatasetPublisher can serve it on another thread.
+   */
+  void
+  registerSnapshotDatasetHandler(const std::string& verb, const DatasetSnapshotter& snapshot);
+
   ndn::mgmt::PostNotification
   registerNotificationStream(const std::string& verb);
 
@@ -117,6 +153,13 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   validateParameters(const ControlCommand& command,
                      const ndn::mgmt::ControlParameters& parameters);
 
+  /**
+   * @brief Validates each item of a ControlParametersList for a given @p command.
+   */
+  [[nodiscard]] static bool
+  validateBatchParameters(const ControlCommand& command,
+                          const ndn::mgmt::ControlParameters& parameters);
+
   /**
    * @brief Handles a control command.
    */
@@ -143,6 +186,7 @@ private:
   std::string m_module;
   Dispatcher& m_dispatcher;
   CommandAuthenticator* m_authenticator = nullptr;
+  std::vector<SnapshotDataset> m_snapshotDatasets;
 };
 
 template<typename Command>
@@ -159,6 +203,27 @@ ManagerBase::registerCommandHandler(const std::string& verb,
     [=] (auto&&... args) { handleCommand(command, handler, std::forward<decltype(args)>(args)...); });
 }
 
+template<typename Command>
+void
+ManagerBase::registerBatchCommandHandler(const std::string& verb,
+                                         const BatchCommandHandler& handler)
+{
+  auto command = make_shared<Command>();
+
+  m_dispatcher.addControlCommand<ControlParametersList>(
+    makeRelPrefix(verb),
+    makeAuthorization(verb),
+    [=] (const auto& params) { return validateBatchParameters(*command, params); },
+    [=] (const Name& prefix, const Interest& interest, const auto& params, const auto& done) {
+      BOOST_ASSERT(dynamic_cast<const ControlParametersList*>(&params) != nullptr);
+      auto items = static_cast<const ControlParametersList&>(params).getItems();
+      for (auto& item : items) {
+        command->applyDefaultsToRequest(item);
+      }
+      handler(*command, prefix, interest, std::move(items), done);
+    });
+}
+
 } // namespace nfd
 
 #endif // NFD_DAEMON_MGMT_MANAGER_BASE_HPP
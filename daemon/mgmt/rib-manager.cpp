@@ -64,7 +64,17 @@ RibManager::RibManager(rib::Rib& rib, ndn::Face& face, ndn::KeyChain& keyChain,
   registerCommandHandler<ndn::nfd::RibUnregisterCommand>("unregister",
     std::bind(&RibManager::unregisterEntry, this, _2, _3, _4, _5));
 
+  registerBatchCommandHandler<ndn::nfd::RibRegisterCommand>("register-batch",
+    std::bind(&RibManager::registerBatch, this, _2, _3, _4, _5));
+  registerBatchCommandHandler<ndn::nfd::RibUnregisterCommand>("unregister-batch",
+    std::bind(&RibManager::unregisterBatch, this, _2, _3, _4, _5));
+
   registerStatusDatasetHandler("list", std::bind(&RibManager::listEntries, this, _1, _2, _3));
+
+  auto recordChange = [this] (const rib::RibRouteRef& r) { m_changeLog.record(r.entry->getName()); };
+  m_addRouteConn = m_rib.afterAddRoute.connect(recordChange);
+  m_updateRouteConn = m_rib.afterUpdateRoute.connect(recordChange);
+  m_removeRouteConn = m_rib.beforeRemoveRoute.connect(recordChange);
 }
 
 void
@@ -125,6 +135,17 @@ RibManager::enableLocalFields()
 void
 RibManager::beginAddRoute(const Name& name, Route route, std::optional<time::nanoseconds> expires,
                           const std::function<void(RibUpdateResult)>& done)
+{
+  auto update = makeAddRouteUpdate(name, std::move(route), expires);
+  if (!update) {
+    return done(RibUpdateResult::EXPIRED);
+  }
+  beginRibUpdate(*update, done);
+}
+
+std::optional<RibUpdate>
+RibManager::makeAddRouteUpdate(const Name& name, Route route,
+                               std::optional<time::nanoseconds> expires)
 {
   if (expires) {
     route.expires = time::steady_clock::now() + *expires;
@@ -135,7 +156,7 @@ RibManager::beginAddRoute(const Name& name, Route route, std::optional<time::nan
 
   if (expires && *expires <= 0_s) {
     m_rib.onRouteExpiration(name, route);
-    return done(RibUpdateResult::EXPIRED);
+    return std::nullopt;
   }
 
   NFD_LOG_INFO("Adding route " << name << " nexthop=" << route.faceId <<
@@ -151,7 +172,7 @@ RibManager::beginAddRoute(const Name& name, Route route, std::optional<time::nan
   update.setAction(RibUpdate::REGISTER)
         .setName(name)
         .setRoute(route);
-  beginRibUpdate(update, done);
+  return update;
 }
 
 void
@@ -187,6 +208,28 @@ RibManager::beginRibUpdate(const RibUpdate& update,
     });
 }
 
+void
+RibManager::beginRibUpdates(const std::vector<RibUpdate>& updates)
+{
+  if (updates.empty()) {
+    return;
+  }
+
+  NFD_LOG_DEBUG("Applying " << updates.size() << " RIB updates");
+  // the failure callback is invoked for each failed update, but one cleanup suffices
+  auto hasScheduledCleanup = make_shared<bool>(false);
+  m_rib.beginApplyUpdates(updates,
+    [] {},
+    [this, hasScheduledCleanup] (uint32_t code, const std::string& error) {
+      NFD_LOG_DEBUG("RIB update failed (" << code << " " << error << ")");
+
+      // Since the FIB rejected the update, clean up invalid routes
+      if (!std::exchange(*hasScheduledCleanup, true)) {
+        scheduleActiveFaceFetch(1_s);
+      }
+    });
+}
+
 void
 RibManager::registerTopPrefix(const Name& topPrefix)
 {
@@ -263,25 +306,128 @@ RibManager::unregisterEntry(const Name&, const Interest& interest,
 }
 
 void
-RibManager::listEntries(const Name&, const Interest&, ndn::mgmt::StatusDatasetContext& context)
+RibManager::registerBatch(const Name& topPrefix, const Interest& interest,
+                          std::vector<ControlParameters> items,
+                          const ndn::mgmt::CommandContinuation& done)
+{
+  for (auto& parameters : items) {
+    if (parameters.getName().size() > Fib::getMaxDepth()) {
+      done(ControlResponse(414, "Route prefix cannot exceed " + to_string(Fib::getMaxDepth()) +
+                                " components"));
+      return;
+    }
+    setFaceForSelfRegistration(interest, parameters);
+  }
+
+  // Respond since command is valid and authorized
+  done(ControlResponse(200, "Success").setBody(ControlParametersList(items).wireEncode()));
+
+  std::vector<RibUpdate> updates;
+  updates.reserve(items.size());
+  for (const auto& parameters : items) {
+    Route route;
+    route.faceId = parameters.getFaceId();
+    route.origin = parameters.getOrigin();
+    route.cost = parameters.getCost();
+    route.flags = parameters.getFlags();
+
+    std::optional<time::nanoseconds> expires;
+    if (parameters.hasExpirationPeriod() &&
+        parameters.getExpirationPeriod() != time::milliseconds::max()) {
+      expires = time::duration_cast<time::nanoseconds>(parameters.getExpirationPeriod());
+    }
+
+    if (auto update = makeAddRouteUpdate(parameters.getName(), std::move(route), expires)) {
+      updates.push_back(std::move(*update));
+    }
+  }
+  beginRibUpdates(updates);
+}
+
+void
+RibManager::unregisterBatch(const Name&, const Interest& interest,
+                            std::vector<ControlParameters> items,
+                            const ndn::mgmt::CommandContinuation& done)
+{
+  for (auto& parameters : items) {
+    setFaceForSelfRegistration(interest, parameters);
+  }
+
+  // Respond since command is valid and authorized
+  done(ControlResponse(200, "Success").setBody(ControlParametersList(items).wireEncode()));
+
+  std::vector<RibUpdate> updates;
+  updates.reserve(items.size());
+  for (const auto& parameters : items) {
+    Route route;
+    route.faceId = parameters.getFaceId();
+    route.origin = parameters.getOrigin();
+
+    NFD_LOG_INFO("Removing route " << parameters.getName() << " nexthop=" << route.faceId <<
+                 " origin=" << route.origin);
+
+    RibUpdate update;
+    update.setAction(RibUpdate::UNREGISTER)
+          .setName(parameters.getName())
+          .setRoute(route);
+    updates.push_back(std::move(update));
+  }
+  beginRibUpdates(updates);
+}
+
+static ndn::nfd::RibEntry
+makeRibEntry(const rib::RibEntry& entry, time::steady_clock::time_point now)
+{
+  ndn::nfd::RibEntry item;
+  item.setName(entry.getName());
+  for (const Route& route : entry.getRoutes()) {
+    ndn::nfd::Route r;
+    r.setFaceId(route.faceId);
+    r.setOrigin(route.origin);
+    r.setCost(route.cost);
+    r.setFlags(route.flags);
+    if (route.expires) {
+      r.setExpirationPeriod(time::duration_cast<time::milliseconds>(*route.expires - now));
+    }
+    item.addRoute(r);
+  }
+  return item;
+}
+
+void
+RibManager::listEntries(const Name& topPrefix, const Interest& interest,
+                        ndn::mgmt::StatusDatasetContext& context)
 {
   auto now = time::steady_clock::now();
-  for (const auto& kv : m_rib) {
-    const rib::RibEntry& entry = *kv.second;
-    ndn::nfd::RibEntry item;
-    item.setName(entry.getName());
-    for (const Route& route : entry.getRoutes()) {
-      ndn::nfd::Route r;
-      r.setFaceId(route.faceId);
-      r.setOrigin(route.origin);
-      r.setCost(route.cost);
-      r.setFlags(route.flags);
-      if (route.expires) {
-        r.setExpirationPeriod(time::duration_cast<time::milliseconds>(*route.expires - now));
-      }
-      item.addRoute(r);
+
+  // topPrefix + "rib" + "list" + version
+  if (interest.getName().size() > topPrefix.size() + 2) {
+    std::vector<ndn::nfd::RibEntry> entries;
+    auto begin = m_changeLog.resolve(interest,
+      [&] {
+        for (const auto& kv : m_rib) {
+          entries.push_back(makeRibEntry(*kv.second, now));
+        }
+      },
+      [&] (const Name& name) {
+        auto it = m_rib.find(name);
+        if (it != m_rib.end()) {
+          entries.push_back(makeRibEntry(*it->second, now));
+        }
+        else {
+          // an entry without routes indicates that the entry has been erased
+          entries.push_back(ndn::nfd::RibEntry().setName(name));
+        }
+      });
+    DispatcherDatasetContext datasetContext(context);
+    if (begin(datasetContext)) {
+      makeListEncoder(std::move(entries))(datasetContext);
     }
-    context.append(item.wireEncode());
+    return;
+  }
+
+  for (const auto& kv : m_rib) {
+    context.append(makeRibEntry(*kv.second, now).wireEncode());
   }
   context.end();
 }
@@ -308,7 +454,8 @@ RibManager::makeAuthorization(const std::string&)
                  const ndn::mgmt::AcceptContinuation& accept,
                  const ndn::mgmt::RejectContinuation& reject) {
     BOOST_ASSERT(params != nullptr);
-    BOOST_ASSERT(typeid(*params) == typeid(ndn::nfd::ControlParameters));
+    BOOST_ASSERT(typeid(*params) == typeid(ndn::nfd::ControlParameters) ||
+                 typeid(*params) == typeid(ControlParametersList));
     BOOST_ASSERT(prefix == LOCALHOST_TOP_PREFIX || prefix == LOCALHOP_TOP_PREFIX);
 
     auto& validator = prefix == LOCALHOST_TOP_PREFIX ? m_localhostValidator : m_localhopValidator;
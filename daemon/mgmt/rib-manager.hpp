@@ -26,8 +26,9 @@
 #ifndef NFD_DAEMON_MGMT_RIB_MANAGER_HPP
 #define NFD_DAEMON_MGMT_RIB_MANAGER_HPP
 
+#include "dataset-change-log.hpp"
 #include "manager-base.hpp"
-#include "rib/route.hpp"
+#include "rib/rib-update.hpp"
 
 #include <ndn-cxx/mgmt/nfd/controller.hpp>
 #include <ndn-cxx/mgmt/nfd/face-event-notification.hpp>
@@ -188,10 +189,22 @@ private: // RIB and FibUpdater actions
   beginRemoveRoute(const Name& name, const rib::Route& route,
                    const std::function<void(RibUpdateResult)>& done);
 
+  /** \brief Prepare the RIB update that adds a route.
+   *  \return the update, or nullopt if the route has already expired
+   *  \sa beginAddRoute
+   */
+  std::optional<rib::RibUpdate>
+  makeAddRouteUpdate(const Name& name, rib::Route route, std::optional<time::nanoseconds> expires);
+
   void
   beginRibUpdate(const rib::RibUpdate& update,
                  const std::function<void(RibUpdateResult)>& done);
 
+  /** \brief Start applying several RIB updates to RIB and FIB as one batch.
+   */
+  void
+  beginRibUpdates(const std::vector<rib::RibUpdate>& updates);
+
 private: // management Dispatcher related
   void
   registerTopPrefix(const Name& topPrefix);
@@ -210,7 +223,23 @@ private: // management Dispatcher related
                   ControlParameters parameters,
                   const ndn::mgmt::CommandContinuation& done);
 
+  /** \brief Serve rib/register-batch command.
+   */
+  void
+  registerBatch(const Name& topPrefix, const Interest& interest,
+                std::vector<ControlParameters> items,
+                const ndn::mgmt::CommandContinuation& done);
+
+  /** \brief Serve rib/unregister-batch command.
+   */
+  void
+  unregisterBatch(const Name& topPrefix, const Interest& interest,
+                  std::vector<ControlParameters> items,
+                  const ndn::mgmt::CommandContinuation& done);
+
   /** \brief Serve rib/list dataset.
+   *
+   *  `rib/list/<version>` lists only the entries changed since \p version, see DatasetChangeLog.
    */
   void
   listEntries(const Name& topPrefix, const Interest& interest,
@@ -255,6 +284,11 @@ private:
   bool m_isLocalhopEnabled;
 
   scheduler::ScopedEventId m_activeFaceFetchEvent;
+
+  DatasetChangeLog m_changeLog;
+  signal::ScopedConnection m_addRouteConn;
+  signal::ScopedConnection m_updateRouteConn;
+  signal::ScopedConnection m_removeRouteConn;
 };
 
 std::ostream&
@@ -47,8 +47,8 @@ StrategyChoiceManager::StrategyChoiceManager(StrategyChoice& strategyChoice,
   registerCommandHandler<ndn::nfd::StrategyChoiceUnsetCommand>("unset",
     std::bind(&StrategyChoiceManager::unsetStrategy, this, _4, _5));
 
-  registerStatusDatasetHandler("list",
-    std::bind(&StrategyChoiceManager::listChoices, this, _3));
+  registerSnapshotDatasetHandler("list",
+    std::bind(&StrategyChoiceManager::listChoices, this));
 }
 
 void
@@ -84,16 +84,17 @@ StrategyChoiceManager::unsetStrategy(ControlParameters parameters,
   done(ControlResponse(200, "OK").setBody(parameters.wireEncode()));
 }
 
-void
-StrategyChoiceManager::listChoices(ndn::mgmt::StatusDatasetContext& context)
+DatasetEncoder
+StrategyChoiceManager::listChoices()
 {
+  std::vector<ndn::nfd::StrategyChoice> entries;
   for (const auto& i : m_table) {
     ndn::nfd::StrategyChoice entry;
     entry.setName(i.getPrefix())
          .setStrategy(i.getStrategyInstanceName());
-    context.append(entry.wireEncode());
+    entries.push_back(std::move(entry));
   }
-  context.end();
+  return makeListEncoder(std::move(entries));
 }
 
 } // namespace nfd
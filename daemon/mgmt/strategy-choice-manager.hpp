@@ -53,8 +53,8 @@ private:
   unsetStrategy(ControlParameters parameters,
                 const ndn::mgmt::CommandContinuation& done);
 
-  void
-  listChoices(ndn::mgmt::StatusDatasetContext& context);
+  DatasetEncoder
+  listChoices();
 
 private:
   strategy_choice::StrategyChoice& m_table;
@@ -52,7 +52,7 @@ TablesConfigSection::ensureConfigured()
   }
 
   m_forwarder.getCs().setLimit(DEFAULT_CS_MAX_PACKETS);
-  // Don't set default cs_policy because it's already created by CS itself.
+  // Don't set default cs_policy and cs_admission_policy because they're already created by CS itself.
   m_forwarder.setUnsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>());
 
   m_isConfigured = true;
@@ -77,6 +77,26 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun,
     }
   }
 
+  unique_ptr<cs::AdmissionPolicy> admissionPolicy;
+  OptionalConfigSection admissionPolicyNode = section.get_child_optional("cs_admission_policy");
+  std::string admissionPolicyName = admissionPolicyNode ? admissionPolicyNode->get_value<std::string>()
+                                                        : cs::AdmitAllAdmissionPolicy::POLICY_NAME;
+  admissionPolicy = cs::AdmissionPolicy::create(admissionPolicyName);
+  if (admissionPolicy == nullptr) {
+    NDN_THROW(ConfigFile::Error("Unknown cs_admission_policy '" + admissionPolicyName + "' in section 'tables'"));
+  }
+  OptionalConfigSection admissionParamsSection = section.get_child_optional("cs_admission_parameters");
+  if (admissionParamsSection) {
+    for (const auto& [key, value] : *admissionParamsSection) {
+      try {
+        admissionPolicy->setParameter(key, value.get_value<std::string>());
+      }
+      catch (const std::invalid_argument& e) {
+        NDN_THROW(ConfigFile::Error("Invalid cs_admission_parameters in section 'tables': "s + e.what()));
+      }
+    }
+  }
+
   unique_ptr<fw::UnsolicitedDataPolicy> unsolicitedDataPolicy;
   OptionalConfigSection unsolicitedDataPolicyNode = section.get_child_optional("cs_unsolicited_policy");
   if (unsolicitedDataPolicyNode) {
@@ -109,6 +129,7 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun,
   if (cs.size() == 0 && csPolicy != nullptr) {
     cs.setPolicy(std::move(csPolicy));
   }
+  cs.setAdmissionPolicy(std::move(admissionPolicy));
 
   m_forwarder.setUnsolicitedDataPolicy(std::move(unsolicitedDataPolicy));
 
@@ -40,6 +40,7 @@
 #include "mgmt/log-config-section.hpp"
 #include "mgmt/strategy-choice-manager.hpp"
 #include "mgmt/tables-config-section.hpp"
+#include "rib/fib-update.hpp"
 
 namespace nfd {
 
@@ -177,6 +178,30 @@ Nfd::initializeManagement()
   m_dispatcher->addTopPrefix(topPrefix, false);
 }
 
+ndn::nfd::ControlResponse
+Nfd::applyFibUpdate(const rib::FibUpdate& update)
+{
+  if (update.action == rib::FibUpdate::ADD_NEXTHOP) {
+    return m_fibManager->applyAddNextHop(update.name, update.faceId, update.cost);
+  }
+  return m_fibManager->applyRemoveNextHop(update.name, update.faceId);
+}
+
+std::vector<SnapshotDataset>
+Nfd::getSnapshotDatasets() const
+{
+  std::vector<SnapshotDataset> datasets = m_forwarderStatusManager->getSnapshotDatasets();
+  auto addDatasets = [&datasets] (const ManagerBase& manager) {
+    const auto& managerDatasets = manager.getSnapshotDatasets();
+    datasets.insert(datasets.end(), managerDatasets.begin(), managerDatasets.end());
+  };
+  addDatasets(*m_faceManager);
+  addDatasets(*m_fibManager);
+  addDatasets(*m_csManager);
+  addDatasets(*m_strategyChoiceManager);
+  return datasets;
+}
+
 void
 Nfd::reloadConfigFile()
 {
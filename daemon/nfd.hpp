@@ -27,9 +27,11 @@
 #define NFD_DAEMON_NFD_HPP
 
 #include "common/config-file.hpp"
+#include "mgmt/dataset-publisher.hpp"
 
 #include <ndn-cxx/face.hpp>
 #include <ndn-cxx/mgmt/dispatcher.hpp>
+#include <ndn-cxx/mgmt/nfd/control-response.hpp>
 #include <ndn-cxx/net/network-monitor.hpp>
 #include <ndn-cxx/security/key-chain.hpp>
 
@@ -50,6 +52,10 @@ class Face;
 class FaceSystem;
 } // namespace face
 
+namespace rib {
+class FibUpdate;
+} // namespace rib
+
 /**
  * \brief Class representing the NFD instance.
  *
@@ -93,6 +99,23 @@ public:
   void
   reloadConfigFile();
 
+  /**
+   * \brief Apply a FIB update computed by the RIB, without going through FIB management commands.
+   *
+   * This must be invoked on the main thread.
+   */
+  ndn::nfd::ControlResponse
+  applyFibUpdate(const rib::FibUpdate& update);
+
+  /**
+   * \brief Returns the status datasets of the forwarder managers that can be served by a
+   *        DatasetPublisher on another thread.
+   *
+   * Their snapshot functions must be invoked on the main thread.
+   */
+  std::vector<SnapshotDataset>
+  getSnapshotDatasets() const;
+
 private:
   explicit
   Nfd(ndn::KeyChain& keyChain);
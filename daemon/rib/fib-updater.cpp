@@ -24,6 +24,7 @@
  */
 
 #include "fib-updater.hpp"
+#include "common/global.hpp"
 #include "common/logger.hpp"
 
 #include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
@@ -40,15 +41,22 @@ constexpr uint32_t ERROR_FACE_NOT_FOUND = 410;
 FibUpdater::FibUpdater(Rib& rib, ndn::nfd::Controller& controller)
   : m_rib(rib)
   , m_controller(controller)
+  , m_aliveToken(make_shared<AliveToken>())
 {
   rib.setFibUpdater(this);
 }
 
+FibUpdater::~FibUpdater()
+{
+  m_aliveToken->close();
+}
+
 void
 FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
                                      const FibUpdateSuccessCallback& onSuccess,
                                      const FibUpdateFailureCallback& onFailure)
 {
+  m_isTransaction = false;
   m_batchFaceId = batch.getFaceId();
 
   // Erase previously calculated inherited routes
@@ -63,6 +71,102 @@ FibUpdater::computeAndSendFibUpdates(const RibUpdateBatch& batch,
   sendUpdatesForBatchFaceId(onSuccess, onFailure);
 }
 
+void
+FibUpdater::computeAndSendFibUpdates(const std::vector<RibUpdateBatch>& batches,
+                                     const BatchComputedCallback& applyBatch,
+                                     const TransactionCallback& onComplete,
+                                     const FibUpdateFailureCallback& onFailure)
+{
+  struct NextHopChange
+  {
+    FibUpdate update;
+    bool wasInFib;
+  };
+  // net change of each (name, faceId) nexthop over the whole transaction
+  std::map<std::pair<Name, uint64_t>, NextHopChange> diff;
+
+  for (const RibUpdateBatch& batch : batches) {
+    m_batchFaceId = batch.getFaceId();
+    m_inheritedRoutes.clear();
+    m_updatesForBatchFaceId.clear();
+    m_updatesForNonBatchFaceId.clear();
+
+    computeUpdates(batch);
+
+    bool isFaceRemoved = std::any_of(batch.begin(), batch.end(), [] (const RibUpdate& update) {
+      return update.getAction() == RibUpdate::REMOVE_FACE;
+    });
+    if (isFaceRemoved) {
+      // The FIB has already dropped the nexthops of a destroyed face
+      for (auto it = diff.begin(); it != diff.end();) {
+        it = it->first.second == batch.getFaceId() ? diff.erase(it) : std::next(it);
+      }
+    }
+
+    for (const FibUpdateList* updates : {&m_updatesForBatchFaceId, &m_updatesForNonBatchFaceId}) {
+      for (const FibUpdate& update : *updates) {
+        auto key = std::make_pair(update.name, update.faceId);
+        auto it = diff.find(key);
+        if (it == diff.end()) {
+          // the RIB does not reflect this batch yet, so this is the state before the transaction
+          diff.emplace(key, NextHopChange{update, isNextHopInFib(update.name, update.faceId)});
+        }
+        else {
+          it->second.update = update;
+        }
+      }
+    }
+
+    applyBatch(batch, m_inheritedRoutes);
+  }
+
+  m_isTransaction = true;
+  m_batchFaceId = ndn::nfd::INVALID_FACE_ID;
+  m_inheritedRoutes.clear();
+  m_updatesForBatchFaceId.clear();
+  m_updatesForNonBatchFaceId.clear();
+  m_missingFaceIds.clear();
+
+  for (const auto& [key, change] : diff) {
+    // Skip nexthops that were added and then removed again within this transaction
+    if (change.update.action == FibUpdate::REMOVE_NEXTHOP && !change.wasInFib) {
+      continue;
+    }
+    m_updatesForNonBatchFaceId.push_back(change.update);
+  }
+
+  NFD_LOG_DEBUG("Coalesced " << batches.size() << " batches into " <<
+                m_updatesForNonBatchFaceId.size() << " FIB updates");
+
+  // No update is on the batch face, so a missing face never fails the transaction.
+  // Once the transaction has completed or failed, responses that arrive late are ignored.
+  auto isFinished = make_shared<bool>(false);
+  sendUpdatesForNonBatchFaceId(
+    [this, onComplete, isFinished] (const RibUpdateList&) {
+      if (!std::exchange(*isFinished, true)) {
+        onComplete(m_missingFaceIds);
+      }
+    },
+    [onFailure, isFinished] (uint32_t code, const std::string& error) {
+      if (!std::exchange(*isFinished, true)) {
+        onFailure(code, error);
+      }
+    });
+}
+
+bool
+FibUpdater::isNextHopInFib(const Name& name, uint64_t faceId) const
+{
+  auto it = m_rib.find(name);
+  if (it == m_rib.end()) {
+    return false;
+  }
+
+  Route route;
+  route.faceId = faceId;
+  return it->second->hasFaceId(faceId) || it->second->hasInheritedRoute(route);
+}
+
 void
 FibUpdater::computeUpdates(const RibUpdateBatch& batch)
 {
@@ -126,18 +230,7 @@ FibUpdater::computeUpdatesForRegistration(const RibUpdate& update)
     // Find prefix's parent
     shared_ptr<RibEntry> parent = m_rib.findParent(prefix);
 
-    Rib::RibEntryList descendants = m_rib.findDescendantsForNonInsertedName(prefix);
-    Rib::RibEntryList children;
-
-    for (const auto& descendant : descendants) {
-      // If the child has the same parent as the new entry,
-      // the new entry must be the child's new parent
-      if (descendant->getParent() == parent) {
-        children.push_back(descendant);
-      }
-    }
-
-    createFibUpdatesForNewRibEntry(prefix, route, children);
+    createFibUpdatesForNewRibEntry(prefix, route, m_rib.findChildren(prefix));
   }
 }
 
@@ -189,6 +282,11 @@ FibUpdater::sendUpdates(const FibUpdateList& updates,
   std::string updateString = (updates.size() == 1) ? " update" : " updates";
   NFD_LOG_DEBUG("Applying " << updates.size() << updateString << " to FIB");
 
+  if (m_directUpdate) {
+    applyUpdatesDirectly(updates, onSuccess, onFailure);
+    return;
+  }
+
   for (const FibUpdate& update : updates) {
     NFD_LOG_DEBUG("Sending FIB update: " << update);
 
@@ -201,6 +299,36 @@ FibUpdater::sendUpdates(const FibUpdateList& updates,
   }
 }
 
+void
+FibUpdater::applyUpdatesDirectly(const FibUpdateList& updates,
+                                 const FibUpdateSuccessCallback& onSuccess,
+                                 const FibUpdateFailureCallback& onFailure)
+{
+  runOnMainIoService([this, token = m_aliveToken, updates, apply = m_directUpdate,
+                      onSuccess, onFailure] {
+    std::vector<ndn::nfd::ControlResponse> responses;
+    responses.reserve(updates.size());
+    for (const FibUpdate& update : updates) {
+      responses.push_back(apply(update));
+    }
+
+    // the RIB thread may have destroyed this FibUpdater, or exited, in the meantime;
+    // the token does not post in that case, so neither 'this' nor its io_service is used
+    token->post([this, updates, responses = std::move(responses), onSuccess, onFailure] {
+      auto response = responses.begin();
+      for (const FibUpdate& update : updates) {
+        if (response->getCode() == 200) {
+          onUpdateSuccess(update, onSuccess, onFailure);
+        }
+        else {
+          onUpdateError(update, onSuccess, onFailure, *response, 0);
+        }
+        ++response;
+      }
+    });
+  });
+}
+
 void
 FibUpdater::sendUpdatesForBatchFaceId(const FibUpdateSuccessCallback& onSuccess,
                                       const FibUpdateFailureCallback& onFailure)
@@ -293,6 +421,7 @@ FibUpdater::onUpdateError(const FibUpdate& update,
       onFailure(code, response.getText());
     }
     else {
+      m_missingFaceIds.insert(update.faceId);
       m_updatesForNonBatchFaceId.remove(update);
 
       if (m_updatesForNonBatchFaceId.size() == 0) {
@@ -300,6 +429,11 @@ FibUpdater::onUpdateError(const FibUpdate& update,
       }
     }
   }
+  else if (m_isTransaction) {
+    // the whole transaction fails, and the updates still in flight are not waited for
+    m_updatesForNonBatchFaceId.clear();
+    onFailure(code, response.getText());
+  }
   else {
     NDN_THROW(Error("Non-recoverable error: " + response.getText() + " code: " + to_string(code)));
   }
@@ -639,50 +773,59 @@ FibUpdater::modifyChildrensInheritedRoutes(const Rib::RibEntryList& children,
 }
 
 void
-FibUpdater::traverseSubTree(const RibEntry& entry, Rib::Rib::RouteSet routesToAdd,
-                            Rib::Rib::RouteSet routesToRemove)
+FibUpdater::traverseSubTree(const RibEntry& entry, const Rib::RouteSet& routesToAdd,
+                            const Rib::RouteSet& routesToRemove)
 {
   // If a route on the namespace has the capture flag set, ignore self and children
   if (entry.hasCapture()) {
     return;
   }
 
+  // Routes that are overridden on this namespace are not passed further down. The route sets
+  // are copied only when this happens, rather than for every entry of a large subtree.
+  std::optional<Rib::RouteSet> filteredToRemove;
+  std::optional<Rib::RouteSet> filteredToAdd;
+
   // Remove inherited routes from current namespace
-  for (auto removeIt = routesToRemove.begin(); removeIt != routesToRemove.end(); ) {
+  for (const Route& route : routesToRemove) {
     // If a route on the namespace has the same face ID and child inheritance set,
     // ignore this route
-    if (entry.hasChildInheritOnFaceId(removeIt->faceId)) {
-      removeIt = routesToRemove.erase(removeIt);
+    if (entry.hasChildInheritOnFaceId(route.faceId)) {
+      if (!filteredToRemove) {
+        filteredToRemove = routesToRemove;
+      }
+      filteredToRemove->erase(route);
       continue;
     }
 
     // Only remove route if it removes an existing inherited route
-    if (entry.hasInheritedRoute(*removeIt)) {
-      removeInheritedRoute(entry.getName(), *removeIt);
-      addFibUpdate(FibUpdate::createRemoveUpdate(entry.getName(), removeIt->faceId));
+    if (entry.hasInheritedRoute(route)) {
+      removeInheritedRoute(entry.getName(), route);
+      addFibUpdate(FibUpdate::createRemoveUpdate(entry.getName(), route.faceId));
     }
-
-    ++removeIt;
   }
 
   // Add inherited routes to current namespace
-  for (auto addIt = routesToAdd.begin(); addIt != routesToAdd.end(); ) {
+  for (const Route& route : routesToAdd) {
     // If a route on the namespace has the same face ID and child inherit set, ignore this face
-    if (entry.hasChildInheritOnFaceId(addIt->faceId)) {
-      addIt = routesToAdd.erase(addIt);
+    if (entry.hasChildInheritOnFaceId(route.faceId)) {
+      if (!filteredToAdd) {
+        filteredToAdd = routesToAdd;
+      }
+      filteredToAdd->erase(route);
       continue;
     }
 
     // Only add route if it does not override an existing route
-    if (!entry.hasFaceId(addIt->faceId)) {
-      addInheritedRoute(entry.getName(), *addIt);
-      addFibUpdate(FibUpdate::createAddUpdate(entry.getName(), addIt->faceId, addIt->cost));
+    if (!entry.hasFaceId(route.faceId)) {
+      addInheritedRoute(entry.getName(), route);
+      addFibUpdate(FibUpdate::createAddUpdate(entry.getName(), route.faceId, route.cost));
     }
-
-    ++addIt;
   }
 
-  modifyChildrensInheritedRoutes(entry.getChildren(), routesToAdd, routesToRemove);
+  modifyChildrensInheritedRoutes(entry.getChildren(),
+                                 filteredToAdd ? *filteredToAdd : routesToAdd,
+                                 filteredToRemove ? *filteredToRemove : routesToRemove);
 }
 
 void
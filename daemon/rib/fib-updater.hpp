@@ -27,6 +27,7 @@
 #define NFD_DAEMON_RIB_FIB_UPDATER_HPP
 
 #include "core/common.hpp"
+#include "common/global.hpp"
 #include "fib-update.hpp"
 #include "rib.hpp"
 #include "rib-update-batch.hpp"
@@ -50,13 +51,22 @@ public:
   using FibUpdateList = std::list<FibUpdate>;
   using FibUpdateSuccessCallback = std::function<void(RibUpdateList inheritedRoutes)>;
   using FibUpdateFailureCallback = std::function<void(uint32_t code, const std::string& error)>;
+  using BatchComputedCallback = std::function<void(const RibUpdateBatch& batch,
+                                                   const RibUpdateList& inheritedRoutes)>;
+  using TransactionCallback = std::function<void(std::set<uint64_t> missingFaceIds)>;
+
+  /**
+   * \brief Applies a FibUpdate to the forwarder's FIB.
+   *
+   * It is invoked on the main thread, and returns the same response as the corresponding
+   * FIB management command.
+   */
+  using DirectUpdateFunc = std::function<ndn::nfd::ControlResponse(const FibUpdate&)>;
 
   FibUpdater(Rib& rib, ndn::nfd::Controller& controller);
 
-#ifdef NFD_WITH_TESTS
-  virtual
-  ~FibUpdater() = default;
-#endif
+  NFD_VIRTUAL_WITH_TESTS
+  ~FibUpdater();
 
   /** \brief Computes FibUpdates using the provided RibUpdateBatch and then sends the
    *         updates to NFD's FIB.
@@ -69,6 +79,39 @@ public:
                            const FibUpdateSuccessCallback& onSuccess,
                            const FibUpdateFailureCallback& onFailure);
 
+  /** \brief Computes FibUpdates for several RibUpdateBatches and sends them to NFD's FIB
+   *         as a single coalesced diff.
+   *
+   *  The batches are processed in order. Once the FibUpdates of a batch have been computed,
+   *  \p applyBatch is invoked with the batch and its inherited routes, so that the RIB reflects
+   *  the batch when the next one is computed. Updates to the same nexthop are merged, so that
+   *  only its net change is sent; a nexthop that is added and then removed again is not sent
+   *  at all. \p onComplete is invoked once the diff has been applied, with the IDs of the faces
+   *  that NFD reported as non-existent. If NFD rejects an update for any other reason, or an
+   *  update times out too often, \p onFailure is invoked instead, and the responses to the
+   *  other updates of the diff are ignored.
+   *
+   *  \note  Caller must guarantee that the previous batch has either succeeded or failed
+   *         before calling this method
+   */
+  void
+  computeAndSendFibUpdates(const std::vector<RibUpdateBatch>& batches,
+                           const BatchComputedCallback& applyBatch,
+                           const TransactionCallback& onComplete,
+                           const FibUpdateFailureCallback& onFailure);
+
+  /** \brief Applies FIB updates through \p func instead of sending FIB management commands.
+   *
+   *  This is possible only if the RIB and the forwarder run in the same process. All updates
+   *  of a batch are then handed to the main thread at once, and they need not be signed
+   *  nor validated. An empty \p func restores the use of FIB management commands.
+   */
+  void
+  setDirectUpdateFunc(DirectUpdateFunc func)
+  {
+    m_directUpdate = std::move(func);
+  }
+
 private:
   /**
    * \brief Determines the type of action that will be performed on the RIB and calls the
@@ -91,6 +134,17 @@ private:
               const FibUpdateSuccessCallback& onSuccess,
               const FibUpdateFailureCallback& onFailure);
 
+  /**
+   * \brief Applies the passed updates on the main thread through m_directUpdate,
+   *        then processes the responses on the RIB thread.
+   *
+   * The responses are dropped if the FibUpdater has been destroyed by then.
+   */
+  void
+  applyUpdatesDirectly(const FibUpdateList& updates,
+                       const FibUpdateSuccessCallback& onSuccess,
+                       const FibUpdateFailureCallback& onFailure);
+
   /**
    * \brief Sends the updates in m_updatesForBatchFaceId to NFD if any exist,
    *        otherwise calls FibUpdater::sendUpdatesForNonBatchFaceId.
@@ -131,6 +185,13 @@ NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE:
                           uint32_t nTimeouts = 0);
 
 private:
+  /**
+   * \brief Determines whether the FIB currently has a nexthop to \p faceId on \p name,
+   *        according to the RIB.
+   */
+  bool
+  isNextHopInFib(const Name& name, uint64_t faceId) const;
+
   /**
    * \brief Calculates the FibUpdates generated by a RIB registration.
    */
@@ -175,7 +236,8 @@ NFD_PROTECTED_WITH_TESTS_ELSE_PRIVATE:
    * face than the update batch, the update is not retried and the error is
    * ignored.
    *
-   * Otherwise, a non-recoverable error has occurred and an exception is thrown.
+   * Otherwise, a non-recoverable error has occurred. A transaction fails, and an exception
+   * is thrown in all other cases.
    */
   void
   onUpdateError(const FibUpdate& update,
@@ -260,7 +322,8 @@ private:
    * \brief Traverses the entry's children adding and removing the passed routes.
    */
   void
-  traverseSubTree(const RibEntry& entry, Rib::RouteSet routesToAdd, Rib::RouteSet routesToRemove);
+  traverseSubTree(const RibEntry& entry, const Rib::RouteSet& routesToAdd,
+                  const Rib::RouteSet& routesToRemove);
 
   /**
    * \brief Creates a record of a calculated inherited route that should be added to the entry.
@@ -277,6 +340,10 @@ private:
 private:
   const Rib& m_rib;
   ndn::nfd::Controller& m_controller;
+  DirectUpdateFunc m_directUpdate;
+  bool m_isTransaction = false;
+  // lets the main thread post the responses of direct updates back to this FibUpdater
+  shared_ptr<AliveToken> m_aliveToken;
   uint64_t m_batchFaceId;
 
 NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
@@ -288,6 +355,12 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
    *        passed to the RIB when updates are completed successfully.
    */
   RibUpdateList m_inheritedRoutes;
+
+private:
+  /**
+   * \brief Faces that NFD reported as non-existent while applying a transaction.
+   */
+  std::set<uint64_t> m_missingFaceIds;
 };
 
 } // namespace nfd::rib
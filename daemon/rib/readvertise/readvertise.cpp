@@ -46,9 +46,13 @@ randomizeTimer(time::milliseconds baseTimer)
 
 Readvertise::Readvertise(Rib& rib,
                          unique_ptr<ReadvertisePolicy> policy,
-                         unique_ptr<ReadvertiseDestination> destination)
+                         unique_ptr<ReadvertiseDestination> destination,
+                         const ReadvertiseOptions& options)
   : m_policy(std::move(policy))
   , m_destination(std::move(destination))
+  , m_options(options)
+  , m_tokens(options.commandBurst)
+  , m_lastRefill(time::steady_clock::now())
 {
   m_addRouteConn = rib.afterAddRoute.connect([this] (const auto& r) { this->afterAddRoute(r); });
   m_removeRouteConn = rib.beforeRemoveRoute.connect([this] (const auto& r) { this->beforeRemoveRoute(r); });
@@ -63,6 +67,15 @@ Readvertise::Readvertise(Rib& rib,
   });
 }
 
+void
+Readvertise::setOptions(const ReadvertiseOptions& options)
+{
+  m_options = options;
+  m_tokens = std::min<double>(m_tokens, m_options.commandBurst);
+  m_processQueueEvt.cancel();
+  this->processQueue();
+}
+
 void
 Readvertise::afterAddRoute(const RibRouteRef& ribRoute)
 {
@@ -90,11 +103,22 @@ Readvertise::afterAddRoute(const RibRouteRef& ribRoute)
     return;
   }
 
+  if (rrIt->isWithdrawHeld) {
+    NFD_LOG_DEBUG("add-route " << ribRoute.entry->getName() << '(' << ribRoute.route->faceId <<
+                  ',' << ribRoute.route->origin << ") withdraw-suppressed " << action->prefix);
+    rrIt->isWithdrawHeld = false;
+    // resume refreshing, or retrying if the last advertisement has failed
+    auto delay = rrIt->retryDelay > RETRY_DELAY_MIN ? rrIt->retryDelay
+                                                    : m_policy->getRefreshInterval();
+    rrIt->retryEvt = getScheduler().schedule(randomizeTimer(delay), [=] { enqueue(rrIt); });
+    return;
+  }
+
   NFD_LOG_DEBUG("add-route " << ribRoute.entry->getName() << '(' << ribRoute.route->faceId <<
                 ',' << ribRoute.route->origin << ") readvertising-as " << action->prefix <<
                 " signer " << action->signer);
   rrIt->retryDelay = RETRY_DELAY_MIN;
-  this->advertise(rrIt);
+  this->enqueue(rrIt);
 }
 
 void
@@ -116,8 +140,30 @@ Readvertise::beforeRemoveRoute(const RibRouteRef& ribRoute)
     return;
   }
 
+  if (!rrIt->isAdvertised) {
+    NFD_LOG_DEBUG("remove-route " << ribRoute.entry->getName() << '(' << ribRoute.route->faceId <<
+                  ',' << ribRoute.route->origin << ") never-advertised " << rrIt->prefix);
+    // nothing to withdraw; a queued advertisement is dropped by processQueue
+    if (!rrIt->isQueued) {
+      m_rrs.erase(rrIt);
+    }
+    return;
+  }
+
+  if (m_options.holdDown > 0_ms) {
+    NFD_LOG_DEBUG("remove-route " << ribRoute.entry->getName() << '(' << ribRoute.route->faceId <<
+                  ',' << ribRoute.route->origin << ") withdraw-held " << rrIt->prefix);
+    rrIt->isWithdrawHeld = true;
+    rrIt->retryEvt = getScheduler().schedule(m_options.holdDown, [=] {
+      rrIt->isWithdrawHeld = false;
+      rrIt->retryDelay = RETRY_DELAY_MIN;
+      enqueue(rrIt);
+    });
+    return;
+  }
+
   rrIt->retryDelay = RETRY_DELAY_MIN;
-  this->withdraw(rrIt);
+  this->enqueue(rrIt);
 }
 
 void
@@ -125,13 +171,19 @@ Readvertise::afterDestinationAvailable()
 {
   for (auto rrIt = m_rrs.begin(); rrIt != m_rrs.end(); ++rrIt) {
     rrIt->retryDelay = RETRY_DELAY_MIN;
-    this->advertise(rrIt);
+    this->enqueue(rrIt);
   }
 }
 
 void
 Readvertise::afterDestinationUnavailable()
 {
+  for (auto rrIt : m_queue) {
+    rrIt->isQueued = false;
+  }
+  m_queue.clear();
+  m_processQueueEvt.cancel();
+
   for (auto rrIt = m_rrs.begin(); rrIt != m_rrs.end();) {
     if (rrIt->nRibRoutes > 0) {
       rrIt->retryEvt.cancel(); // stop retrying or refreshing
@@ -143,6 +195,80 @@ Readvertise::afterDestinationUnavailable()
   }
 }
 
+void
+Readvertise::enqueue(ReadvertisedRouteContainer::iterator rrIt)
+{
+  if (!rrIt->isQueued) {
+    rrIt->isQueued = true;
+    m_queue.push_back(rrIt);
+  }
+  this->processQueue();
+}
+
+void
+Readvertise::processQueue()
+{
+  while (!m_queue.empty()) {
+    auto rrIt = m_queue.front();
+    if (rrIt->isWithdrawHeld) {
+      // hold-down expiry will queue it again
+      m_queue.pop_front();
+      rrIt->isQueued = false;
+      continue;
+    }
+    if (rrIt->nRibRoutes == 0 && !rrIt->isAdvertised) {
+      // removed before its advertisement was sent
+      m_queue.pop_front();
+      m_rrs.erase(rrIt);
+      continue;
+    }
+
+    if (m_options.maxInFlight > 0 && m_nInFlight >= m_options.maxInFlight) {
+      NFD_LOG_TRACE("queue-size " << m_queue.size() << " waiting-for-responses");
+      return; // resumed when a response arrives
+    }
+    if (!this->consumeToken()) {
+      NFD_LOG_TRACE("queue-size " << m_queue.size() << " rate-limited");
+      return; // resumed by m_processQueueEvt
+    }
+
+    m_queue.pop_front();
+    rrIt->isQueued = false;
+    rrIt->retryEvt.cancel();
+    // the kind of command reflects the latest state of the readvertised route
+    if (rrIt->nRibRoutes > 0) {
+      this->advertise(rrIt);
+    }
+    else {
+      this->withdraw(rrIt);
+    }
+  }
+}
+
+bool
+Readvertise::consumeToken()
+{
+  if (m_options.commandRate == 0) {
+    return true;
+  }
+
+  auto now = time::steady_clock::now();
+  std::chrono::duration<double> elapsed = now - m_lastRefill;
+  m_tokens = std::min<double>(m_options.commandBurst,
+                              m_tokens + elapsed.count() * m_options.commandRate);
+  m_lastRefill = now;
+
+  if (m_tokens >= 1.0) {
+    m_tokens -= 1.0;
+    return true;
+  }
+
+  std::chrono::duration<double> wait((1.0 - m_tokens) / m_options.commandRate);
+  m_processQueueEvt = getScheduler().schedule(std::chrono::ceil<time::nanoseconds>(wait),
+                                              [this] { processQueue(); });
+  return false;
+}
+
 void
 Readvertise::advertise(ReadvertisedRouteContainer::iterator rrIt)
 {
@@ -153,18 +279,24 @@ Readvertise::advertise(ReadvertisedRouteContainer::iterator rrIt)
     return;
   }
 
+  ++m_nInFlight;
+  rrIt->isAdvertised = true;
   m_destination->advertise(*rrIt,
     [=] {
       NFD_LOG_DEBUG("advertise " << rrIt->prefix << " success");
+      --m_nInFlight;
       rrIt->retryDelay = RETRY_DELAY_MIN;
       rrIt->retryEvt = getScheduler().schedule(randomizeTimer(m_policy->getRefreshInterval()),
-                                               [=] { advertise(rrIt); });
+                                               [=] { enqueue(rrIt); });
+      processQueue();
     },
     [=] (const std::string& msg) {
       NFD_LOG_DEBUG("advertise " << rrIt->prefix << " failure " << msg);
+      --m_nInFlight;
       rrIt->retryDelay = std::min(RETRY_DELAY_MAX, rrIt->retryDelay * 2);
       rrIt->retryEvt = getScheduler().schedule(randomizeTimer(rrIt->retryDelay),
-                                               [=] { advertise(rrIt); });
+                                               [=] { enqueue(rrIt); });
+      processQueue();
     });
 }
 
@@ -179,16 +311,24 @@ Readvertise::withdraw(ReadvertisedRouteContainer::iterator rrIt)
     return;
   }
 
+  ++m_nInFlight;
   m_destination->withdraw(*rrIt,
     [=] {
       NFD_LOG_DEBUG("withdraw " << rrIt->prefix << " success");
-      m_rrs.erase(rrIt);
+      --m_nInFlight;
+      // keep the route if it has been needed again since the withdrawal was sent
+      if (rrIt->nRibRoutes == 0 && !rrIt->isQueued && !rrIt->isWithdrawHeld) {
+        m_rrs.erase(rrIt);
+      }
+      processQueue();
     },
     [=] (const std::string& msg) {
       NFD_LOG_DEBUG("withdraw " << rrIt->prefix << " failure " << msg);
+      --m_nInFlight;
       rrIt->retryDelay = std::min(RETRY_DELAY_MAX, rrIt->retryDelay * 2);
       rrIt->retryEvt = getScheduler().schedule(randomizeTimer(rrIt->retryDelay),
-                                               [=] { withdraw(rrIt); });
+                                               [=] { enqueue(rrIt); });
+      processQueue();
     });
 }
 
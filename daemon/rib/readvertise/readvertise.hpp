@@ -31,21 +31,55 @@
 #include "readvertised-route.hpp"
 #include "rib/rib.hpp"
 
+#include <deque>
+
 namespace nfd::rib {
 
+/** \brief Options that control how commands are sent to a readvertise destination.
+ */
+struct ReadvertiseOptions
+{
+  /** \brief How long a withdrawal is held back.
+   *
+   *  If the readvertised prefix is needed again within this period, neither the withdrawal
+   *  nor a new advertisement is sent.
+   */
+  time::milliseconds holdDown = 0_ms;
+
+  /** \brief Maximum number of commands sent per second; zero means unlimited.
+   */
+  size_t commandRate = 0;
+
+  /** \brief Number of commands that can be sent at once under the rate limit.
+   */
+  size_t commandBurst = 1;
+
+  /** \brief Maximum number of commands awaiting a response; zero means unlimited.
+   */
+  size_t maxInFlight = 0;
+};
+
 /** \brief Readvertise a subset of routes to a destination according to a policy.
  *
  *  The Readvertise class allows RIB routes to be readvertised to a destination such as a routing
  *  protocol daemon or another NFD-RIB. It monitors the RIB for route additions and removals,
  *  asks the ReadvertisePolicy to make decision on whether to readvertise each new route and what
  *  prefix to readvertise as, and invokes a ReadvertiseDestination to send the commands.
+ *
+ *  Commands are sent through a queue that holds at most one pending command per readvertised
+ *  prefix, whose kind is decided when it is sent, so that a burst of route changes results in
+ *  one command per prefix. The queue is drained subject to the limits in ReadvertiseOptions.
  */
 class Readvertise : noncopyable
 {
 public:
   Readvertise(Rib& rib,
               unique_ptr<ReadvertisePolicy> policy,
-              unique_ptr<ReadvertiseDestination> destination);
+              unique_ptr<ReadvertiseDestination> destination,
+              const ReadvertiseOptions& options = {});
+
+  void
+  setOptions(const ReadvertiseOptions& options);
 
 private:
   void
@@ -60,6 +94,22 @@ private:
   void
   afterDestinationUnavailable();
 
+  /** \brief Queue a command for \p rrIt, unless one is already queued.
+   */
+  void
+  enqueue(ReadvertisedRouteContainer::iterator rrIt);
+
+  /** \brief Send queued commands until the queue is empty or a limit is reached.
+   */
+  void
+  processQueue();
+
+  /** \brief Take a token from the rate limiter.
+   *  \return whether a command can be sent now; if not, processQueue() is scheduled
+   */
+  bool
+  consumeToken();
+
   void
   advertise(ReadvertisedRouteContainer::iterator rrIt);
 
@@ -76,6 +126,13 @@ private:
    */
   std::map<RibRouteRef, ReadvertisedRouteContainer::iterator> m_routeToRr;
 
+  ReadvertiseOptions m_options;
+  std::deque<ReadvertisedRouteContainer::iterator> m_queue;
+  size_t m_nInFlight = 0;
+  double m_tokens = 0.0;
+  time::steady_clock::time_point m_lastRefill;
+  scheduler::ScopedEventId m_processQueueEvt;
+
   signal::ScopedConnection m_addRouteConn;
   signal::ScopedConnection m_removeRouteConn;
 };
@@ -43,6 +43,9 @@ public:
     : prefix(prefix)
     , nRibRoutes(0)
     , retryDelay(0)
+    , isQueued(false)
+    , isWithdrawHeld(false)
+    , isAdvertised(false)
   {
   }
 
@@ -51,7 +54,10 @@ public:
   mutable ndn::security::SigningInfo signer; ///< signer for commands
   mutable size_t nRibRoutes; ///< number of RIB routes that cause the readvertisement
   mutable time::milliseconds retryDelay; ///< retry interval (not used for refresh)
-  mutable scheduler::ScopedEventId retryEvt; ///< retry or refresh event
+  mutable scheduler::ScopedEventId retryEvt; ///< retry, refresh, or hold-down event
+  mutable bool isQueued; ///< whether a command is waiting to be sent
+  mutable bool isWithdrawHeld; ///< whether withdrawal is held back by hold-down
+  mutable bool isAdvertised; ///< whether an advertise command has been sent
 };
 
 inline bool
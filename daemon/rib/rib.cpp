@@ -31,6 +31,8 @@ namespace nfd::rib {
 
 NFD_LOG_INIT(Rib);
 
+constexpr uint32_t ERROR_FACE_NOT_FOUND = 410;
+
 bool
 operator<(const RibRouteRef& lhs, const RibRouteRef& rhs)
 {
@@ -100,21 +102,31 @@ Rib::insert(const Name& prefix, const Route& route)
     if (didInsert) {
       // The route was new and we successfully inserted it.
       m_nItems++;
+      if (m_isTransactionInProgress) {
+        m_transactionChanges.push_back({TransactionChange::ROUTE_INSERTED, prefix, route, {}});
+      }
 
-      afterAddRoute(RibRouteRef{entry, entryIt});
+      notifyAfterAddRoute(entry, entryIt);
 
       // Register with face lookup table
       m_faceEntries.emplace(route.faceId, entry);
     }
     else {
       // Route exists, update fields
-      // First cancel old scheduled event, if any, then set the EventId to new one
-      if (entryIt->getExpirationEvent()) {
+      // First cancel old scheduled event, if any, then set the EventId to new one.
+      // A FIB transaction keeps the old event until it is committed, in case it is rolled back.
+      if (m_isTransactionInProgress) {
+        m_transactionChanges.push_back({TransactionChange::ROUTE_UPDATED, prefix, *entryIt, {}});
+      }
+      else if (entryIt->getExpirationEvent()) {
         NFD_LOG_TRACE("Cancelling expiration event for " << entry->getName() << " " << *entryIt);
         entryIt->cancelExpirationEvent();
       }
 
       *entryIt = route;
+      if (!isUnannounced(*entry, *entryIt)) {
+        afterUpdateRoute(RibRouteRef{entry, entryIt});
+      }
     }
   }
   else {
@@ -123,6 +135,9 @@ Rib::insert(const Name& prefix, const Route& route)
 
     m_rib[prefix] = entry;
     m_nItems++;
+    if (m_isTransactionInProgress) {
+      m_transactionChanges.push_back({TransactionChange::ROUTE_INSERTED, prefix, route, {}});
+    }
 
     entry->setName(prefix);
     auto routeIt = entry->insertRoute(route).first;
@@ -135,23 +150,25 @@ Rib::insert(const Name& prefix, const Route& route)
       parent->addChild(entry);
     }
 
-    auto children = findDescendants(prefix);
-    for (const auto& child : children) {
-      if (child->getParent() == parent) {
-        // Remove child from parent and inherit parent's child
-        if (parent != nullptr) {
-          parent->removeChild(child);
-        }
-        entry->addChild(child);
+    for (const auto& child : findChildren(prefix)) {
+      // Remove child from parent and inherit parent's child
+      if (parent != nullptr) {
+        parent->removeChild(child);
       }
+      entry->addChild(child);
     }
 
     // Register with face lookup table
     m_faceEntries.emplace(route.faceId, entry);
 
     // do something after inserting an entry
-    afterInsertEntry(prefix);
-    afterAddRoute(RibRouteRef{entry, routeIt});
+    if (m_isTransactionInProgress) {
+      m_unannouncedEntries.insert(prefix);
+    }
+    else {
+      afterInsertEntry(prefix);
+    }
+    notifyAfterAddRoute(entry, routeIt);
   }
 }
 
@@ -168,7 +185,17 @@ Rib::erase(const Name& prefix, const Route& route)
   auto routeIt = entry->findRoute(route);
 
   if (routeIt != entry->end()) {
-    beforeRemoveRoute(RibRouteRef{entry, routeIt});
+    // A route that was never announced is removed silently
+    if (m_unannouncedRoutes.erase({prefix, routeIt->faceId, routeIt->origin}) == 0) {
+      beforeRemoveRoute(RibRouteRef{entry, routeIt});
+    }
+
+    std::optional<TransactionChange> change;
+    if (m_isTransactionInProgress) {
+      // keep the expiration event, which eraseRoute() would cancel, until the transaction commits
+      change = TransactionChange{TransactionChange::ROUTE_ERASED, prefix, *routeIt, {}};
+      routeIt->setExpirationEvent(scheduler::EventId());
+    }
 
     auto faceId = route.faceId;
     entry->eraseRoute(routeIt);
@@ -187,9 +214,127 @@ Rib::erase(const Name& prefix, const Route& route)
 
     // If a RibEntry's route list is empty, remove it from the tree
     if (entry->getRoutes().empty()) {
+      if (change) {
+        change->inheritedRoutes = entry->getInheritedRoutes();
+      }
       eraseEntry(ribIt);
     }
+
+    if (change) {
+      m_transactionChanges.push_back(std::move(*change));
+    }
+  }
+}
+
+void
+Rib::notifyAfterAddRoute(const shared_ptr<RibEntry>& entry, RibEntry::const_iterator routeIt)
+{
+  if (m_isTransactionInProgress) {
+    m_unannouncedRoutes.emplace(entry->getName(), routeIt->faceId, routeIt->origin);
+  }
+  else {
+    announceRoute(entry, routeIt);
+  }
+}
+
+void
+Rib::announceRoute(const shared_ptr<RibEntry>& entry, RibEntry::const_iterator routeIt)
+{
+  if (m_unannouncedEntries.erase(entry->getName()) > 0) {
+    afterInsertEntry(entry->getName());
+  }
+  afterAddRoute(RibRouteRef{entry, routeIt});
+}
+
+bool
+Rib::isUnannounced(const RibEntry& entry, const Route& route) const
+{
+  return m_unannouncedRoutes.count({entry.getName(), route.faceId, route.origin}) > 0;
+}
+
+void
+Rib::announceTransactionRoutes(const std::set<uint64_t>& excludedFaceIds)
+{
+  for (auto it = m_unannouncedRoutes.begin(); it != m_unannouncedRoutes.end();) {
+    const auto& [name, faceId, origin] = *it;
+    if (excludedFaceIds.count(faceId) > 0) {
+      ++it;
+      continue;
+    }
+
+    Route route;
+    route.faceId = faceId;
+    route.origin = origin;
+    auto entry = m_rib.at(name);
+    auto routeIt = entry->findRoute(route);
+    BOOST_ASSERT(routeIt != entry->end());
+
+    it = m_unannouncedRoutes.erase(it);
+    announceRoute(entry, routeIt);
+  }
+}
+
+void
+Rib::commitTransaction()
+{
+  for (auto& change : m_transactionChanges) {
+    if (change.type == TransactionChange::ROUTE_UPDATED ||
+        change.type == TransactionChange::ROUTE_ERASED) {
+      change.route.cancelExpirationEvent();
+    }
+  }
+  m_transactionChanges.clear();
+}
+
+void
+Rib::rollBackTransaction()
+{
+  BOOST_ASSERT(m_isTransactionInProgress);
+
+  auto changes = std::move(m_transactionChanges);
+  m_transactionChanges.clear();
+
+  for (auto change = changes.rbegin(); change != changes.rend(); ++change) {
+    switch (change->type) {
+    case TransactionChange::ROUTE_INSERTED: {
+      Route* route = find(change->name, change->route);
+      BOOST_ASSERT(route != nullptr);
+      // the route never expires now, so its expiration event is cancelled along with it
+      route->cancelExpirationEvent();
+      erase(change->name, change->route);
+      break;
+    }
+    case TransactionChange::ROUTE_UPDATED: {
+      auto entry = m_rib.at(change->name);
+      auto routeIt = entry->findRoute(change->route);
+      BOOST_ASSERT(routeIt != entry->end());
+      routeIt->cancelExpirationEvent();
+      *routeIt = change->route;
+      if (!isUnannounced(*entry, *routeIt)) {
+        afterUpdateRoute(RibRouteRef{entry, routeIt});
+      }
+      break;
+    }
+    case TransactionChange::ROUTE_ERASED:
+      insert(change->name, change->route);
+      if (change->inheritedRoutes) {
+        auto entry = m_rib.at(change->name);
+        for (const Route& route : *change->inheritedRoutes) {
+          entry->addInheritedRoute(route);
+        }
+      }
+      break;
+    case TransactionChange::INHERITED_ROUTE_ADDED:
+      m_rib.at(change->name)->removeInheritedRoute(change->route);
+      break;
+    case TransactionChange::INHERITED_ROUTE_REMOVED:
+      m_rib.at(change->name)->addInheritedRoute(change->route);
+      break;
+    }
   }
+
+  // the undo operations above were recorded as well
+  m_transactionChanges.clear();
 }
 
 void
@@ -218,36 +363,17 @@ Rib::findParent(const Name& prefix) const
   return nullptr;
 }
 
-std::list<shared_ptr<RibEntry>>
-Rib::findDescendants(const Name& prefix) const
-{
-  std::list<shared_ptr<RibEntry>> children;
-
-  auto it = m_rib.find(prefix);
-  if (it != m_rib.end()) {
-    ++it;
-    for (; it != m_rib.end(); ++it) {
-      if (prefix.isPrefixOf(it->first)) {
-        children.push_back(it->second);
-      }
-      else {
-        break;
-      }
-    }
-  }
-
-  return children;
-}
-
-std::list<shared_ptr<RibEntry>>
-Rib::findDescendantsForNonInsertedName(const Name& prefix) const
+Rib::RibEntryList
+Rib::findChildren(const Name& prefix) const
 {
-  std::list<shared_ptr<RibEntry>> children;
-
-  for (const auto& [name, ribEntry] : m_rib) {
-    if (prefix.isPrefixOf(name)) {
-      children.push_back(ribEntry);
-    }
+  RibEntryList children;
+
+  // Names under the same prefix are contiguous in the table
+  auto it = m_rib.upper_bound(prefix);
+  while (it != m_rib.end() && prefix.isPrefixOf(it->first)) {
+    children.push_back(it->second);
+    // Skip the descendants of this child
+    it = m_rib.lower_bound(it->first.getSuccessor());
   }
 
   return children;
@@ -287,7 +413,9 @@ Rib::eraseEntry(RibTable::iterator it)
   auto nextIt = m_rib.erase(it);
 
   // do something after erasing an entry
-  afterEraseEntry(entry->getName());
+  if (m_unannouncedEntries.erase(entry->getName()) == 0) {
+    afterEraseEntry(entry->getName());
+  }
 
   return nextIt;
 }
@@ -348,6 +476,18 @@ Rib::beginApplyUpdate(const RibUpdate& update,
   sendBatchFromQueue();
 }
 
+void
+Rib::beginApplyUpdates(const std::vector<RibUpdate>& updates,
+                       const Rib::UpdateSuccessCallback& onSuccess,
+                       const Rib::UpdateFailureCallback& onFailure)
+{
+  BOOST_ASSERT(m_fibUpdater != nullptr);
+  for (const auto& update : updates) {
+    addUpdateToQueue(update, onSuccess, onFailure);
+  }
+  sendBatchFromQueue();
+}
+
 void
 Rib::beginRemoveFace(uint64_t faceId)
 {
@@ -407,6 +547,11 @@ Rib::sendBatchFromQueue()
 
   m_isUpdateInProgress = true;
 
+  if (m_updateBatches.size() > 1) {
+    sendTransactionFromQueue();
+    return;
+  }
+
   UpdateQueueItem item = std::move(m_updateBatches.front());
   m_updateBatches.pop_front();
 
@@ -421,9 +566,40 @@ Rib::sendBatchFromQueue()
 }
 
 void
-Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
-                        const RibUpdateList& inheritedRoutes,
-                        const Rib::UpdateSuccessCallback& onSuccess)
+Rib::sendTransactionFromQueue()
+{
+  auto last = m_updateBatches.begin();
+  std::advance(last, std::min(m_updateBatches.size(), MAX_BATCHES_PER_TRANSACTION));
+  UpdateQueue items;
+  items.splice(items.end(), m_updateBatches, m_updateBatches.begin(), last);
+
+  std::vector<RibUpdateBatch> batches;
+  batches.reserve(items.size());
+  for (const auto& item : items) {
+    batches.push_back(item.batch);
+  }
+
+  NFD_LOG_DEBUG("Sending " << batches.size() << " batches as one FIB transaction");
+
+  // Routes added while the diff is computed are announced only when the FIB has accepted them,
+  // and all changes are recorded so that they can be rolled back if the FIB rejects the diff
+  m_isTransactionInProgress = true;
+  m_transactionItems = std::move(items);
+  m_fibUpdater->computeAndSendFibUpdates(batches,
+    [this] (const RibUpdateBatch& batch, const RibUpdateList& inheritedRoutes) {
+      updateRib(batch);
+      modifyInheritedRoutes(inheritedRoutes);
+    },
+    [this] (std::set<uint64_t> missingFaceIds) {
+      onFibTransactionComplete(missingFaceIds);
+    },
+    [this] (uint32_t code, const std::string& error) {
+      onFibTransactionFailure(code, error);
+    });
+}
+
+void
+Rib::updateRib(const RibUpdateBatch& batch)
 {
   for (const RibUpdate& update : batch) {
     switch (update.getAction()) {
@@ -436,6 +612,14 @@ Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
       break;
     }
   }
+}
+
+void
+Rib::onFibUpdateSuccess(const RibUpdateBatch& batch,
+                        const RibUpdateList& inheritedRoutes,
+                        const Rib::UpdateSuccessCallback& onSuccess)
+{
+  updateRib(batch);
 
   // Add and remove precalculated inherited routes to RibEntries
   modifyInheritedRoutes(inheritedRoutes);
@@ -464,6 +648,69 @@ Rib::onFibUpdateFailure(const Rib::UpdateFailureCallback& onFailure,
   sendBatchFromQueue();
 }
 
+void
+Rib::onFibTransactionComplete(const std::set<uint64_t>& missingFaceIds)
+{
+  commitTransaction();
+  m_isUpdateInProgress = false;
+  m_isTransactionInProgress = false;
+
+  // Announce the routes added by the transaction, except those on non-existent faces
+  announceTransactionRoutes(missingFaceIds);
+
+  UpdateQueue items;
+  items.swap(m_transactionItems);
+  for (const auto& item : items) {
+    if (missingFaceIds.count(item.batch.getFaceId()) == 0) {
+      if (item.managerSuccessCallback != nullptr) {
+        item.managerSuccessCallback();
+      }
+    }
+    else if (item.managerFailureCallback != nullptr) {
+      item.managerFailureCallback(ERROR_FACE_NOT_FOUND, "Face does not exist");
+    }
+  }
+
+  // The RIB was updated along with the FIB diff; remove the routes left on non-existent faces
+  // before any other queued update, so that they never become visible through the signals
+  UpdateQueue queued;
+  queued.swap(m_updateBatches);
+  for (uint64_t faceId : missingFaceIds) {
+    auto range = m_faceEntries.equal_range(faceId);
+    for (auto it = range.first; it != range.second; ++it) {
+      enqueueRemoveFace(*it->second, faceId);
+    }
+  }
+  m_updateBatches.splice(m_updateBatches.end(), queued);
+
+  // Try to advance the batch queue
+  sendBatchFromQueue();
+}
+
+void
+Rib::onFibTransactionFailure(uint32_t code, const std::string& error)
+{
+  NFD_LOG_DEBUG("FIB transaction failed (" << code << " " << error << "), rolling back");
+
+  rollBackTransaction();
+  m_isUpdateInProgress = false;
+  m_isTransactionInProgress = false;
+
+  // The routes that the rollback restored are announced again
+  announceTransactionRoutes({});
+
+  UpdateQueue items;
+  items.swap(m_transactionItems);
+  for (const auto& item : items) {
+    if (item.managerFailureCallback != nullptr) {
+      item.managerFailureCallback(code, error);
+    }
+  }
+
+  // Try to advance the batch queue
+  sendBatchFromQueue();
+}
+
 void
 Rib::modifyInheritedRoutes(const RibUpdateList& inheritedRoutes)
 {
@@ -475,8 +722,20 @@ Rib::modifyInheritedRoutes(const RibUpdateList& inheritedRoutes)
     switch (update.getAction()) {
     case RibUpdate::REGISTER:
       entry->addInheritedRoute(update.getRoute());
+      if (m_isTransactionInProgress) {
+        m_transactionChanges.push_back({TransactionChange::INHERITED_ROUTE_ADDED, update.getName(),
+                                        update.getRoute(), {}});
+      }
       break;
     case RibUpdate::UNREGISTER:
+      if (m_isTransactionInProgress) {
+        for (const Route& route : entry->getInheritedRoutes()) {
+          if (route.faceId == update.getRoute().faceId) {
+            m_transactionChanges.push_back({TransactionChange::INHERITED_ROUTE_REMOVED,
+                                            update.getName(), route, {}});
+          }
+        }
+      }
       entry->removeInheritedRoute(update.getRoute());
       break;
     case RibUpdate::REMOVE_FACE:
@@ -121,6 +121,16 @@ public:
                    const UpdateSuccessCallback& onSuccess,
                    const UpdateFailureCallback& onFailure);
 
+  /** \brief Queues several RIB updates at once, so that they are applied to the FIB
+   *         in a single transaction.
+   *
+   *  \p onSuccess or \p onFailure is invoked once for each update.
+   */
+  void
+  beginApplyUpdates(const std::vector<RibUpdate>& updates,
+                    const UpdateSuccessCallback& onSuccess,
+                    const UpdateFailureCallback& onFailure);
+
   /** \brief Starts the FIB update process when a face has been destroyed.
    */
   void
@@ -149,10 +159,23 @@ private:
                    const Rib::UpdateFailureCallback& onFailure);
 
   /** \brief Send the first update batch in the queue, if no other update is in progress.
+   *
+   *  If several batches are queued, they are sent together as one FIB transaction.
    */
   void
   sendBatchFromQueue();
 
+  /** \brief Send up to MAX_BATCHES_PER_TRANSACTION queued batches as one FIB transaction.
+   *
+   *  The RIB is updated while the FIB diff is computed, but the routes added by the transaction
+   *  are announced through afterInsertEntry and afterAddRoute only after the FIB has accepted
+   *  the diff. Batches whose face no longer exists fail; the routes they left on that face are
+   *  never announced, and are removed silently before any other queued update. If the FIB
+   *  rejects the diff for any other reason, the changes are rolled back and all batches fail.
+   */
+  void
+  sendTransactionFromQueue();
+
   void
   onFibUpdateSuccess(const RibUpdateBatch& batch,
                      const RibUpdateList& inheritedRoutes,
@@ -167,20 +190,49 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
   erase(const Name& prefix, const Route& route);
 
 private:
-  using RouteComparePredicate = bool (*)(const Route&, const Route&);
-  using RouteSet = std::set<Route, RouteComparePredicate>;
+  /** \brief Emits afterAddRoute, or holds it back while a FIB transaction is in progress.
+   */
+  void
+  notifyAfterAddRoute(const shared_ptr<RibEntry>& entry, RibEntry::const_iterator routeIt);
+
+  /** \brief Emits afterAddRoute, preceded by afterInsertEntry if the entry was not announced yet.
+   */
+  void
+  announceRoute(const shared_ptr<RibEntry>& entry, RibEntry::const_iterator routeIt);
 
-  /** \brief Find entries under \p prefix.
-   *  \pre a RIB entry exists at \p prefix
+  bool
+  isUnannounced(const RibEntry& entry, const Route& route) const;
+
+  /** \brief Announces the routes held back by a FIB transaction, except those on \p excludedFaceIds.
    */
-  std::list<shared_ptr<RibEntry>>
-  findDescendants(const Name& prefix) const;
+  void
+  announceTransactionRoutes(const std::set<uint64_t>& excludedFaceIds);
 
-  /** \brief Find entries under \p prefix.
-   *  \pre a RIB entry does not exist at \p prefix
+  /** \brief Keeps the changes made by a FIB transaction.
    */
-  std::list<shared_ptr<RibEntry>>
-  findDescendantsForNonInsertedName(const Name& prefix) const;
+  void
+  commitTransaction();
+
+  /** \brief Undoes the changes made by a FIB transaction, in reverse order.
+   *
+   *  Routes that the transaction erased or replaced are restored with their expiration events,
+   *  and the routes it inserted are erased silently. The restored routes are then held back
+   *  like new routes, until announceTransactionRoutes() is invoked.
+   */
+  void
+  rollBackTransaction();
+
+  using RouteComparePredicate = bool (*)(const Route&, const Route&);
+  using RouteSet = std::set<Route, RouteComparePredicate>;
+
+  /** \brief Find the entries under \p prefix that have no other entry between them and
+   *         \p prefix, i.e., the children that a RIB entry at \p prefix has or would have.
+   *
+   *  The subtree of each child is skipped with a single lookup, so that the cost depends on
+   *  the number of children rather than on the number of descendants.
+   */
+  RibEntryList
+  findChildren(const Name& prefix) const;
 
   RibTable::iterator
   eraseEntry(RibTable::iterator it);
@@ -226,6 +278,10 @@ public:
    */
   signal::Signal<Rib, RibRouteRef> afterAddRoute;
 
+  /** \brief Signals after an existing Route is replaced with new fields, such as a new cost.
+   */
+  signal::Signal<Rib, RibRouteRef> afterUpdateRoute;
+
   /** \brief Signals before a route is removed.
    */
   signal::Signal<Rib, RibRouteRef> beforeRemoveRoute;
@@ -247,6 +303,45 @@ private:
   using UpdateQueue = std::list<UpdateQueueItem>;
   UpdateQueue m_updateBatches;
   bool m_isUpdateInProgress = false;
+  bool m_isTransactionInProgress = false;
+  // Entries and routes added by a FIB transaction whose signals have not been emitted yet
+  std::set<Name> m_unannouncedEntries;
+  std::set<std::tuple<Name, uint64_t, ndn::nfd::RouteOrigin>> m_unannouncedRoutes;
+  // Batches of the FIB transaction in progress
+  UpdateQueue m_transactionItems;
+
+  /** \brief A change made to the RIB by a FIB transaction, recorded so that it can be undone.
+   */
+  struct TransactionChange
+  {
+    enum Type {
+      ROUTE_INSERTED,
+      ROUTE_UPDATED,
+      ROUTE_ERASED,
+      INHERITED_ROUTE_ADDED,
+      INHERITED_ROUTE_REMOVED,
+    };
+
+    Type type;
+    Name name;
+    /// the inserted route, the route before the update, the erased route, or the inherited route
+    Route route;
+    /// the inherited routes of the entry, if ROUTE_ERASED also erased the entry
+    std::optional<RibEntry::RouteList> inheritedRoutes;
+  };
+
+  // The expiration events of replaced and erased routes are cancelled only on commit
+  std::vector<TransactionChange> m_transactionChanges;
+
+  void
+  onFibTransactionComplete(const std::set<uint64_t>& missingFaceIds);
+
+  void
+  onFibTransactionFailure(uint32_t code, const std::string& error);
+
+  /** \brief Maximum number of queued batches that are sent in one FIB transaction.
+   */
+  static constexpr size_t MAX_BATCHES_PER_TRANSACTION = 1024;
 
   friend FibUpdater;
 };
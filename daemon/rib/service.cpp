@@ -48,6 +48,7 @@ const std::string CFG_LOCALHOP_SECURITY = "localhop_security";
 const std::string CFG_PA_VALIDATION = "prefix_announcement_validation";
 const std::string CFG_PREFIX_PROPAGATE = "auto_prefix_propagate";
 const std::string CFG_READVERTISE_NLSR = "readvertise_nlsr";
+const std::string CFG_READVERTISE_NLSR_OPTIONS = "readvertise_nlsr_options";
 const Name READVERTISE_NLSR_PREFIX = "/localhost/nlsr";
 constexpr uint64_t PROPAGATE_DEFAULT_COST = 15;
 constexpr time::milliseconds PROPAGATE_DEFAULT_TIMEOUT = 10_s;
@@ -61,6 +62,33 @@ loadConfigSectionFromFile(const std::string& filename)
   return config;
 }
 
+static ReadvertiseOptions
+parseReadvertiseOptions(const ConfigSection& section, const std::string& sectionName)
+{
+  ReadvertiseOptions options;
+  for (const auto& item : section) {
+    const std::string& key = item.first;
+    if (key == "hold_down") {
+      options.holdDown = time::seconds(ConfigFile::parseNumber<uint32_t>(item, sectionName));
+    }
+    else if (key == "command_rate") {
+      options.commandRate = ConfigFile::parseNumber<uint32_t>(item, sectionName);
+    }
+    else if (key == "command_burst") {
+      auto burst = ConfigFile::parseNumber<uint32_t>(item, sectionName);
+      ConfigFile::checkRange(burst, 1U, std::numeric_limits<uint32_t>::max(), key, sectionName);
+      options.commandBurst = burst;
+    }
+    else if (key == "max_in_flight") {
+      options.maxInFlight = ConfigFile::parseNumber<uint32_t>(item, sectionName);
+    }
+    else {
+      NDN_THROW(ConfigFile::Error("Unrecognized option " + sectionName + "." + key));
+    }
+  }
+  return options;
+}
+
 // Look into NFD's config file and construct an appropriate transport to communicate with NFD.
 static shared_ptr<ndn::Transport>
 makeLocalNfdTransport(const ConfigSection& config)
@@ -199,6 +227,7 @@ Service::applyConfig(const ConfigSection& section, const std::string& filename)
 {
   bool wantPrefixPropagate = false;
   bool wantReadvertiseNlsr = false;
+  ReadvertiseOptions readvertiseNlsrOptions;
 
   for (const auto& item : section) {
     const std::string& key = item.first;
@@ -237,6 +266,10 @@ Service::applyConfig(const ConfigSection& section, const std::string& filename)
     else if (key == CFG_READVERTISE_NLSR) {
       wantReadvertiseNlsr = ConfigFile::parseYesNo(item, CFG_RIB + "." + CFG_READVERTISE_NLSR);
     }
+    else if (key == CFG_READVERTISE_NLSR_OPTIONS) {
+      const std::string sectionName = CFG_RIB + "." + CFG_READVERTISE_NLSR_OPTIONS;
+      readvertiseNlsrOptions = parseReadvertiseOptions(value, sectionName);
+    }
     else {
       NDN_THROW(ConfigFile::Error("Unrecognized option " + CFG_RIB + "." + key));
     }
@@ -253,7 +286,11 @@ Service::applyConfig(const ConfigSection& section, const std::string& filename)
     m_readvertiseNlsr = make_unique<Readvertise>(
       m_rib,
       make_unique<ClientToNlsrReadvertisePolicy>(),
-      make_unique<NfdRibReadvertiseDestination>(m_nfdController, m_rib, options));
+      make_unique<NfdRibReadvertiseDestination>(m_nfdController, m_rib, options),
+      readvertiseNlsrOptions);
+  }
+  else if (wantReadvertiseNlsr) {
+    m_readvertiseNlsr->setOptions(readvertiseNlsrOptions);
   }
   else if (!wantReadvertiseNlsr && m_readvertiseNlsr != nullptr) {
     NFD_LOG_DEBUG("Disabling readvertise-to-nlsr");
@@ -27,6 +27,7 @@
 #define NFD_DAEMON_RIB_SERVICE_HPP
 
 #include "common/config-file.hpp"
+#include "mgmt/dataset-publisher.hpp"
 #include "mgmt/rib-manager.hpp"
 #include "rib/fib-updater.hpp"
 #include "rib/rib.hpp"
@@ -88,6 +89,26 @@ public:
     return m_ribManager;
   }
 
+  /**
+   * \brief Apply FIB updates through \p func instead of FIB management commands.
+   * \sa FibUpdater::setDirectUpdateFunc
+   */
+  void
+  setDirectFibUpdateFunc(FibUpdater::DirectUpdateFunc func)
+  {
+    m_fibUpdater.setDirectUpdateFunc(std::move(func));
+  }
+
+  /**
+   * \brief Serve status datasets of the forwarder on the RIB thread.
+   * \sa DatasetPublisher
+   */
+  void
+  publishDatasets(const std::vector<SnapshotDataset>& datasets)
+  {
+    m_datasetPublisher = make_unique<DatasetPublisher>(m_face, m_keyChain, m_nfdController, datasets);
+  }
+
 private:
   template<typename ConfigParseFunc>
   Service(ndn::KeyChain& keyChain, shared_ptr<ndn::Transport> localNfdTransport,
@@ -115,6 +136,7 @@ private:
   unique_ptr<Readvertise> m_readvertisePropagation;
   ndn::mgmt::Dispatcher m_dispatcher;
   RibManager m_ribManager;
+  unique_ptr<DatasetPublisher> m_datasetPublisher;
 };
 
 } // namespace nfd::rib
@@ -30,32 +30,16 @@ namespace nfd {
 void
 cleanupOnFaceRemoval(NameTree& nt, Fib& fib, Pit& pit, const Face& face)
 {
-  std::multimap<size_t, const name_tree::Entry*> maybeEmptyNtes;
-
-  // visit FIB and PIT entries in one pass of NameTree enumeration
-  for (const name_tree::Entry& nte : nt) {
-    fib::Entry* fibEntry = nte.getFibEntry();
-    if (fibEntry != nullptr) {
-      fib.removeNextHop(*fibEntry, face);
-    }
-
-    for (const auto& pitEntry : nte.getPitEntries()) {
-      pit.deleteInOutRecords(pitEntry.get(), face);
+  for (fib::Entry* fibEntry : fib.findEntriesByNextHop(face)) {
+    name_tree::Entry* nte = nt.getEntry(*fibEntry);
+    if (fib.removeNextHop(*fibEntry, face) == Fib::RemoveNextHopResult::FIB_ENTRY_REMOVED) {
+      // an ancestor that still has a FIB entry to visit is not empty, so it is not erased here
+      nt.eraseIfEmpty(nte);
     }
-
-    if (!nte.hasTableEntries()) {
-      maybeEmptyNtes.emplace(nte.getName().size(), &nte);
-    }
-  }
-
-  // try to erase longer names first, so that children are erased before parent is checked
-  for (auto i = maybeEmptyNtes.rbegin(); i != maybeEmptyNtes.rend(); ++i) {
-    nt.eraseIfEmpty(const_cast<name_tree::Entry*>(i->second), false);
   }
 
-  BOOST_ASSERT(nt.size() == 0 ||
-               std::none_of(nt.begin(), nt.end(),
-                            [] (const name_tree::Entry& nte) { return nte.isEmpty(); }));
+  // PIT entries are kept, so their name tree entries cannot become empty
+  pit.deleteInOutRecords(face);
 }
 
 } // namespace nfd
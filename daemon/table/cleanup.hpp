@@ -34,15 +34,15 @@ namespace nfd {
 
 /** \brief Cleanup tables when a face is destroyed.
  *
- *  This function enumerates the NameTree, calls Fib::removeNextHop() for each FIB entry,
- *  calls Pit::deleteInOutRecords() for each PIT entry, and finally
- *  deletes any name tree entries that have become empty.
+ *  This function calls Fib::removeNextHop() for each FIB entry with a nexthop toward \p face,
+ *  deletes any name tree entries that have become empty, and calls Pit::deleteInOutRecords()
+ *  for each PIT entry with an in-record or out-record of \p face.
+ *
+ *  The affected entries are found through the per-face indices of Fib and Pit, so that
+ *  the time taken depends on the number of these entries rather than the size of NameTree.
  *
  *  \note It's a design choice to let Fib and Pit classes decide what to do with each entry.
- *        This function is only responsible for implementing the enumeration procedure.
- *        The benefit of having this function instead of doing the enumeration in Fib and Pit
- *        classes is to perform both FIB and PIT cleanups in one pass of NameTree enumeration,
- *        so as to reduce performance overhead.
+ *        This function is only responsible for finding the entries.
  */
 void
 cleanupOnFaceRemoval(NameTree& nt, Fib& fib, Pit& pit, const Face& face);
@@ -0,0 +1,173 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-admission-policy.hpp"
+#include "common/logger.hpp"
+
+#include <ndn-cxx/util/random.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/range/adaptor/map.hpp>
+#include <boost/range/algorithm/copy.hpp>
+
+#include <random>
+
+namespace nfd::cs {
+
+NFD_LOG_INIT(CsAdmissionPolicy);
+
+AdmissionPolicy::Registry&
+AdmissionPolicy::getRegistry()
+{
+  static Registry registry;
+  return registry;
+}
+
+unique_ptr<AdmissionPolicy>
+AdmissionPolicy::create(const std::string& policyName)
+{
+  Registry& registry = getRegistry();
+  auto i = registry.find(policyName);
+  return i == registry.end() ? nullptr : i->second();
+}
+
+std::set<std::string>
+AdmissionPolicy::getPolicyNames()
+{
+  std::set<std::string> policyNames;
+  boost::copy(getRegistry() | boost::adaptors::map_keys,
+              std::inserter(policyNames, policyNames.end()));
+  return policyNames;
+}
+
+AdmissionPolicy::AdmissionPolicy(std::string_view policyName)
+  : m_policyName(policyName)
+{
+}
+
+void
+AdmissionPolicy::setParameter(const std::string& key, const std::string&)
+{
+  NDN_THROW(std::invalid_argument("Policy '" + m_policyName + "' does not accept parameter '" + key + "'"));
+}
+
+template<typename T>
+static T
+parseParameter(const std::string& key, const std::string& value)
+{
+  try {
+    return boost::lexical_cast<T>(value);
+  }
+  catch (const boost::bad_lexical_cast&) {
+    NDN_THROW(std::invalid_argument("Invalid value '" + value + "' for parameter '" + key + "'"));
+  }
+}
+
+const std::string AdmitAllAdmissionPolicy::POLICY_NAME("admit-all");
+NFD_REGISTER_CS_ADMISSION_POLICY(AdmitAllAdmissionPolicy);
+
+AdmitAllAdmissionPolicy::AdmitAllAdmissionPolicy()
+  : AdmissionPolicy(POLICY_NAME)
+{
+}
+
+bool
+AdmitAllAdmissionPolicy::shouldAdmit(const Data&)
+{
+  return true;
+}
+
+const std::string ProbabilisticAdmissionPolicy::POLICY_NAME("probabilistic");
+NFD_REGISTER_CS_ADMISSION_POLICY(ProbabilisticAdmissionPolicy);
+
+ProbabilisticAdmissionPolicy::ProbabilisticAdmissionPolicy()
+  : AdmissionPolicy(POLICY_NAME)
+{
+}
+
+void
+ProbabilisticAdmissionPolicy::setParameter(const std::string& key, const std::string& value)
+{
+  if (key != "probability") {
+    return AdmissionPolicy::setParameter(key, value);
+  }
+
+  auto probability = parseParameter<double>(key, value);
+  if (!(probability > 0.0 && probability <= 1.0)) {
+    NDN_THROW(std::invalid_argument("probability must be in (0,1]"));
+  }
+  m_probability = probability;
+  NFD_LOG_INFO(POLICY_NAME << " probability=" << m_probability);
+}
+
+bool
+ProbabilisticAdmissionPolicy::shouldAdmit(const Data&)
+{
+  std::bernoulli_distribution dist(m_probability);
+  return dist(ndn::random::getRandomNumberEngine());
+}
+
+const std::string PopularityAdmissionPolicy::POLICY_NAME("popularity");
+NFD_REGISTER_CS_ADMISSION_POLICY(PopularityAdmissionPolicy);
+
+PopularityAdmissionPolicy::PopularityAdmissionPolicy()
+  : AdmissionPolicy(POLICY_NAME)
+  , m_counters(N_COUNTERS, 0)
+{
+}
+
+void
+PopularityAdmissionPolicy::setParameter(const std::string& key, const std::string& value)
+{
+  if (key != "threshold") {
+    return AdmissionPolicy::setParameter(key, value);
+  }
+
+  auto threshold = parseParameter<int>(key, value);
+  if (threshold < 1 || threshold > std::numeric_limits<uint8_t>::max()) {
+    NDN_THROW(std::invalid_argument("threshold must be in [1,255]"));
+  }
+  m_threshold = static_cast<uint8_t>(threshold);
+  NFD_LOG_INFO(POLICY_NAME << " threshold=" << static_cast<int>(m_threshold));
+}
+
+bool
+PopularityAdmissionPolicy::shouldAdmit(const Data& data)
+{
+  if (++m_nSinceAging >= m_counters.size()) {
+    for (auto& counter : m_counters) {
+      counter /= 2;
+    }
+    m_nSinceAging = 0;
+  }
+
+  auto& counter = m_counters[std::hash<Name>()(data.getName()) % m_counters.size()];
+  if (counter < std::numeric_limits<uint8_t>::max()) {
+    ++counter;
+  }
+  return counter >= m_threshold;
+}
+
+} // namespace nfd::cs
@@ -0,0 +1,202 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_ADMISSION_POLICY_HPP
+#define NFD_DAEMON_TABLE_CS_ADMISSION_POLICY_HPP
+
+#include "core/common.hpp"
+
+namespace nfd::cs {
+
+/**
+ * \brief Decides whether a solicited Data packet should be admitted into the ContentStore.
+ *
+ * Admission is separate from replacement (cs::Policy): a Data that is not admitted never
+ * enters the CS, and therefore never causes an eviction. This reduces CS write amplification
+ * and, on routers that share traffic, improves the diversity of the cached content.
+ */
+class AdmissionPolicy : noncopyable
+{
+public: // registry
+  template<typename P>
+  static void
+  registerPolicy(const std::string& policyName = P::POLICY_NAME)
+  {
+    BOOST_ASSERT(!policyName.empty());
+    auto r = getRegistry().insert_or_assign(policyName, [] { return make_unique<P>(); });
+    BOOST_VERIFY(r.second);
+  }
+
+  /**
+   * \brief Returns an AdmissionPolicy identified by \p policyName,
+   *        or nullptr if \p policyName is unknown.
+   */
+  static unique_ptr<AdmissionPolicy>
+  create(const std::string& policyName);
+
+  /**
+   * \brief Returns a list of available policy names.
+   */
+  static std::set<std::string>
+  getPolicyNames();
+
+public:
+  virtual
+  ~AdmissionPolicy() = default;
+
+  const std::string&
+  getName() const noexcept
+  {
+    return m_policyName;
+  }
+
+  /** \brief Sets a policy-specific parameter.
+   *  \throw std::invalid_argument the parameter is unknown or \p value is invalid
+   */
+  virtual void
+  setParameter(const std::string& key, const std::string& value);
+
+  /** \brief Decides whether \p data should be admitted.
+   *
+   *  This is invoked for every solicited Data that is not already in the CS,
+   *  so it must be cheap.
+   */
+  virtual bool
+  shouldAdmit(const Data& data) = 0;
+
+protected:
+  explicit
+  AdmissionPolicy(std::string_view policyName);
+
+private:
+  using CreateFunc = std::function<unique_ptr<AdmissionPolicy>()>;
+  using Registry = std::map<std::string, CreateFunc>; // indexed by policy name
+
+  static Registry&
+  getRegistry();
+
+private:
+  const std::string m_policyName;
+};
+
+/**
+ * \brief Admits every Data.
+ */
+class AdmitAllAdmissionPolicy final : public AdmissionPolicy
+{
+public:
+  AdmitAllAdmissionPolicy();
+
+  bool
+  shouldAdmit(const Data& data) final;
+
+public:
+  static const std::string POLICY_NAME;
+};
+
+/**
+ * \brief Admits each Data independently with a fixed probability.
+ *
+ * Parameters:
+ *  - `probability`: admission probability, in (0,1] (default 0.5)
+ */
+class ProbabilisticAdmissionPolicy final : public AdmissionPolicy
+{
+public:
+  ProbabilisticAdmissionPolicy();
+
+  void
+  setParameter(const std::string& key, const std::string& value) final;
+
+  bool
+  shouldAdmit(const Data& data) final;
+
+  double
+  getProbability() const noexcept
+  {
+    return m_probability;
+  }
+
+public:
+  static const std::string POLICY_NAME;
+
+private:
+  double m_probability = 0.5;
+};
+
+/**
+ * \brief Admits a Data only once its name has been seen a number of times recently.
+ *
+ * Occurrences are counted in a fixed-size array of saturating counters indexed by a hash
+ * of the Data name. All counters are halved every time as many Data as there are counters
+ * have been seen, so that counts reflect recent popularity. With the default threshold of 2,
+ * content that is requested only once is never cached.
+ *
+ * Parameters:
+ *  - `threshold`: number of occurrences required for admission, in [1,255] (default 2)
+ */
+class PopularityAdmissionPolicy final : public AdmissionPolicy
+{
+public:
+  PopularityAdmissionPolicy();
+
+  void
+  setParameter(const std::string& key, const std::string& value) final;
+
+  bool
+  shouldAdmit(const Data& data) final;
+
+  uint8_t
+  getThreshold() const noexcept
+  {
+    return m_threshold;
+  }
+
+public:
+  static const std::string POLICY_NAME;
+  static constexpr size_t N_COUNTERS = 65536;
+
+private:
+  std::vector<uint8_t> m_counters;
+  size_t m_nSinceAging = 0;
+  uint8_t m_threshold = 2;
+};
+
+} // namespace nfd::cs
+
+/** \brief Registers a CS admission policy.
+ *  \param P a subclass of nfd::cs::AdmissionPolicy
+ */
+#define NFD_REGISTER_CS_ADMISSION_POLICY(P)                     \
+static class NfdAuto ## P ## CsAdmissionPolicyRegistrationClass \
+{                                                               \
+public:                                                         \
+  NfdAuto ## P ## CsAdmissionPolicyRegistrationClass()          \
+  {                                                             \
+    ::nfd::cs::AdmissionPolicy::registerPolicy<P>();            \
+  }                                                             \
+} g_nfdAuto ## P ## CsAdmissionPolicyRegistrationVariable
+
+#endif // NFD_DAEMON_TABLE_CS_ADMISSION_POLICY_HPP
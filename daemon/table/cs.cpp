@@ -39,7 +39,28 @@ makeDefaultPolicy()
   return Policy::create("lru");
 }
 
+/** \brief Returns \p data, or a copy whose wire encoding is in a buffer of its own if the
+ *         encoding occupies less than half of the buffer it shares.
+ *
+ *  StreamTransport delivers packets that share its receive chunk, so a cached Data would
+ *  otherwise keep the whole chunk alive for as long as it stays in the CS.
+ */
+static shared_ptr<const Data>
+detachWire(const Data& data)
+{
+  const Block& wire = data.wireEncode();
+  if (wire.getBuffer()->size() <= 2 * wire.size()) {
+    return data.shared_from_this();
+  }
+
+  // the copy keeps the packet tags
+  auto copy = make_shared<Data>(data);
+  copy->wireDecode(Block(make_shared<const ndn::Buffer>(wire.begin(), wire.end())));
+  return copy;
+}
+
 Cs::Cs(size_t nMaxPackets)
+  : m_admissionPolicy(AdmissionPolicy::create(AdmitAllAdmissionPolicy::POLICY_NAME))
 {
   setPolicyImpl(makeDefaultPolicy());
   m_policy->setLimit(nMaxPackets);
@@ -62,21 +83,28 @@ Cs::insert(const Data& data, bool isUnsolicited)
     }
   }
 
-  auto [it, isNewEntry] = m_table.emplace(data.shared_from_this(), isUnsolicited);
-  auto& entry = const_cast<Entry&>(*it);
-
-  entry.updateFreshUntil();
-
-  if (!isNewEntry) { // existing entry
+  const Name& fullName = data.getFullName();
+  auto it = m_table.lower_bound(fullName);
+  if (it != m_table.end() && it->getFullName() == fullName) { // existing entry
+    auto& entry = const_cast<Entry&>(*it);
+    entry.updateFreshUntil();
     // XXX This doesn't forbid unsolicited Data from refreshing a solicited entry.
     if (entry.isUnsolicited() && !isUnsolicited) {
       entry.clearUnsolicited();
     }
     m_policy->afterRefresh(it);
+    return;
   }
-  else {
-    m_policy->afterInsert(it);
+
+  // the admission policy only decides whether a new entry is created
+  if (!isUnsolicited && !m_admissionPolicy->shouldAdmit(data)) {
+    NFD_LOG_DEBUG("insert " << data.getName() << " not-admitted policy=" << m_admissionPolicy->getName());
+    return;
   }
+
+  it = m_table.emplace_hint(it, detachWire(data), isUnsolicited);
+  const_cast<Entry&>(*it).updateFreshUntil();
+  m_policy->afterInsert(it);
 }
 
 std::pair<Cs::const_iterator, Cs::const_iterator>
@@ -145,6 +173,14 @@ Cs::setPolicy(unique_ptr<Policy> policy)
   m_policy->setLimit(limit);
 }
 
+void
+Cs::setAdmissionPolicy(unique_ptr<AdmissionPolicy> policy)
+{
+  BOOST_ASSERT(policy != nullptr);
+  NFD_LOG_DEBUG("set-admission-policy " << policy->getName());
+  m_admissionPolicy = std::move(policy);
+}
+
 void
 Cs::setPolicyImpl(unique_ptr<Policy> policy)
 {
@@ -26,6 +26,7 @@
 #ifndef NFD_DAEMON_TABLE_CS_HPP
 #define NFD_DAEMON_TABLE_CS_HPP
 
+#include "cs-admission-policy.hpp"
 #include "cs-policy.hpp"
 
 namespace nfd {
@@ -40,6 +41,7 @@ namespace cs {
  *  and a few additional attributes such as when the Data becomes non-fresh.
  *
  *  The replacement policy is implemented in a subclass of \c Policy.
+ *  Before a solicited Data is inserted, an \c AdmissionPolicy decides whether it is cached at all.
  */
 class Cs : noncopyable
 {
@@ -127,6 +129,19 @@ public: // configuration
   void
   setPolicy(unique_ptr<Policy> policy);
 
+  /** \brief Get admission policy.
+   */
+  AdmissionPolicy*
+  getAdmissionPolicy() const noexcept
+  {
+    return m_admissionPolicy.get();
+  }
+
+  /** \brief Change admission policy.
+   */
+  void
+  setAdmissionPolicy(unique_ptr<AdmissionPolicy> policy);
+
   /** \brief Get CS_ENABLE_ADMIT flag.
    *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt#Update-config
    */
@@ -192,6 +207,7 @@ NFD_PUBLIC_WITH_TESTS_ELSE_PRIVATE:
 private:
   Table m_table;
   unique_ptr<Policy> m_policy;
+  unique_ptr<AdmissionPolicy> m_admissionPolicy;
   signal::ScopedConnection m_beforeEvictConnection;
 
   bool m_shouldAdmit = true; ///< if false, no Data will be admitted
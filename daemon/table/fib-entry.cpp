@@ -25,61 +25,99 @@
 
 #include "fib-entry.hpp"
 
+#include <atomic>
+
 namespace nfd::fib {
 
-Entry::Entry(const Name& prefix)
-  : m_prefix(prefix)
+static const shared_ptr<NextHopList>&
+getEmptyNextHopList()
 {
+  // function-local so that it is initialized before Fib's static empty entry;
+  // this reference keeps the list shared, so that it is never modified
+  static const auto emptyList = make_shared<NextHopList>();
+  return emptyList;
 }
 
-NextHopList::iterator
-Entry::findNextHop(const Face& face)
+template<typename List>
+static auto
+findNextHop(List& nexthops, const Face& face)
 {
-  return std::find_if(m_nextHops.begin(), m_nextHops.end(),
+  return std::find_if(nexthops.begin(), nexthops.end(),
                       [&face] (const NextHop& nexthop) {
                         return &nexthop.getFace() == &face;
                       });
 }
 
+Entry::Entry(const Name& prefix)
+  : m_prefix(prefix)
+  , m_nextHops(getEmptyNextHopList())
+{
+}
+
 bool
 Entry::hasNextHop(const Face& face) const
 {
-  return const_cast<Entry*>(this)->findNextHop(face) != m_nextHops.end();
+  return findNextHop(*m_nextHops, face) != m_nextHops->end();
+}
+
+NextHopList&
+Entry::getNextHopsForUpdate()
+{
+  // Other threads can only release their references to a snapshot, so a list that is not
+  // shared now cannot become shared while it is being modified
+  if (m_nextHops.use_count() > 1) {
+    m_nextHops = make_shared<NextHopList>(*m_nextHops);
+  }
+  else {
+    // synchronize with the release of the last reference held by another thread
+    std::atomic_thread_fence(std::memory_order_acquire);
+  }
+  return *m_nextHops;
 }
 
-std::pair<NextHopList::iterator, bool>
+std::pair<NextHopList::const_iterator, bool>
 Entry::addOrUpdateNextHop(Face& face, uint64_t cost)
 {
-  auto it = this->findNextHop(face);
+  auto& nexthops = this->getNextHopsForUpdate();
+  auto it = findNextHop(nexthops, face);
   bool isNew = false;
-  if (it == m_nextHops.end()) {
-    m_nextHops.emplace_back(face);
-    it = std::prev(m_nextHops.end());
+  if (it == nexthops.end()) {
+    it = nexthops.emplace(nexthops.end(), face);
     isNew = true;
   }
-
   it->setCost(cost);
-  this->sortNextHops();
 
-  return {it, isNew};
+  std::stable_sort(nexthops.begin(), nexthops.end(),
+                   [] (const NextHop& a, const NextHop& b) { return a.getCost() < b.getCost(); });
+
+  return {findNextHop(nexthops, face), isNew};
 }
 
 bool
 Entry::removeNextHop(const Face& face)
 {
-  auto it = this->findNextHop(face);
-  if (it != m_nextHops.end()) {
-    m_nextHops.erase(it);
+  auto it = findNextHop(*m_nextHops, face);
+  if (it == m_nextHops->end()) {
+    return false;
+  }
+
+  if (m_nextHops.use_count() == 1) {
+    this->getNextHopsForUpdate().erase(it);
     return true;
   }
-  return false;
-}
 
-void
-Entry::sortNextHops()
-{
-  std::sort(m_nextHops.begin(), m_nextHops.end(),
-            [] (const NextHop& a, const NextHop& b) { return a.getCost() < b.getCost(); });
+  if (m_nextHops->size() == 1) {
+    m_nextHops = getEmptyNextHopList();
+    return true;
+  }
+
+  // copy the remaining nexthops only, rather than the whole list
+  auto nexthops = make_shared<NextHopList>();
+  nexthops->reserve(m_nextHops->size() - 1);
+  nexthops->insert(nexthops->end(), m_nextHops->begin(), it);
+  nexthops->insert(nexthops->end(), std::next(it), m_nextHops->end());
+  m_nextHops = std::move(nexthops);
+  return true;
 }
 
 } // namespace nfd::fib
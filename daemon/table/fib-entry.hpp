@@ -46,6 +46,20 @@ class Fib;
  */
 using NextHopList = std::vector<NextHop>;
 
+/**
+ * \brief A point-in-time copy of a FIB entry.
+ *
+ * The nexthop list is shared with the entry rather than copied, so taking a snapshot is cheap.
+ * It never changes, so the snapshot can be read on any thread, but only NextHop::getFaceId()
+ * and NextHop::getCost() may be used, because the faces may be destroyed in the meantime.
+ */
+struct EntrySnapshot
+{
+  Name prefix;
+  shared_ptr<const NextHopList> nextHops;
+  uint64_t nextHopsVersion = 0;
+};
+
 /**
  * \brief Represents an entry in the FIB.
  * \sa Fib
@@ -62,18 +76,36 @@ public:
     return m_prefix;
   }
 
-  const NextHopList&
+  /** \brief Returns the current nexthop list.
+   *
+   *  A list is never modified while it is shared, so the returned list stays valid and
+   *  unchanged for as long as the pointer is held, even if this entry is modified or erased
+   *  in the meantime. Callers that iterate over the list should keep the pointer in a local
+   *  variable rather than dereference a temporary.
+   */
+  shared_ptr<const NextHopList>
   getNextHops() const
   {
     return m_nextHops;
   }
 
+  /** \brief Returns a snapshot of this entry.
+   *
+   *  Modifications to this entry replace its nexthop list instead of changing it in place,
+   *  so the snapshot stays valid after this entry is modified or erased.
+   */
+  EntrySnapshot
+  getSnapshot() const
+  {
+    return {m_prefix, m_nextHops, m_nextHopsVersion};
+  }
+
   /** \return whether this Entry has any NextHop record
    */
   bool
   hasNextHops() const
   {
-    return !m_nextHops.empty();
+    return !m_nextHops->empty();
   }
 
   /** \return whether there is a NextHop record for \p face
@@ -81,37 +113,47 @@ public:
   bool
   hasNextHop(const Face& face) const;
 
+  /** \brief Returns a number that changes whenever the nexthop list of this entry is modified.
+   *
+   *  Within a Fib, no two entries ever share a version, so a (pointer, version) pair
+   *  identifies a nexthop list even after the entry is erased and its memory reused.
+   */
+  uint64_t
+  getNextHopsVersion() const noexcept
+  {
+    return m_nextHopsVersion;
+  }
+
 private:
   /** \brief Adds a NextHop record to the entry.
    *
    *  If a NextHop record for \p face already exists in the entry, its cost is set to \p cost.
+   *  The nexthop list is kept sorted by cost. It is modified in place, unless it is shared with
+   *  a snapshot or with a caller of getNextHops(), in which case it is replaced by a modified copy.
    *
    *  \return the iterator to the new or updated NextHop and a bool indicating whether a new
    *  NextHop was inserted
    */
-  std::pair<NextHopList::iterator, bool>
+  std::pair<NextHopList::const_iterator, bool>
   addOrUpdateNextHop(Face& face, uint64_t cost);
 
   /** \brief Removes a NextHop record.
    *
    *  If no NextHop record for face exists, do nothing.
+   *  Otherwise, the nexthop list is modified in place, or replaced by a modified copy if shared.
    */
   bool
   removeNextHop(const Face& face);
 
-  /** \note This method is non-const because mutable iterators are needed by callers.
-   */
-  NextHopList::iterator
-  findNextHop(const Face& face);
-
-  /** \brief Sorts the nexthop list.
+  /** \brief Returns the nexthop list for modification, after copying it if it is shared.
    */
-  void
-  sortNextHops();
+  NextHopList&
+  getNextHopsForUpdate();
 
 private:
   Name m_prefix;
-  NextHopList m_nextHops;
+  shared_ptr<NextHopList> m_nextHops; ///< never null, never modified while shared
+  uint64_t m_nextHopsVersion = 0;
 
   name_tree::Entry* m_nameTreeEntry = nullptr;
 
@@ -39,6 +39,7 @@ public:
   explicit
   NextHop(Face& face)
     : m_face(&face)
+    , m_faceId(face.getId())
   {
   }
 
@@ -48,6 +49,17 @@ public:
     return *m_face;
   }
 
+  /** \brief Returns the FaceId of the face when this record was created.
+   *
+   *  Unlike getFace(), this can be used when the face may have been destroyed,
+   *  e.g., when reading a FIB snapshot on another thread.
+   */
+  FaceId
+  getFaceId() const
+  {
+    return m_faceId;
+  }
+
   uint64_t
   getCost() const
   {
@@ -62,6 +74,7 @@ public:
 
 private:
   Face* m_face; // pointer instead of reference so that NextHop is movable
+  FaceId m_faceId;
   uint64_t m_cost = 0;
 };
 
@@ -57,6 +57,17 @@ Fib::findLongestPrefixMatchImpl(const K& key) const
   return *s_emptyEntry;
 }
 
+const Entry&
+Fib::findLongestPrefixMatchCached(const name_tree::Entry& nte) const
+{
+  auto& cache = nte.getFibCache();
+  if (cache.generation != m_generation) {
+    cache.value = &this->findLongestPrefixMatchImpl(nte);
+    cache.generation = m_generation;
+  }
+  return *cache.value;
+}
+
 const Entry&
 Fib::findLongestPrefixMatch(const Name& prefix) const
 {
@@ -66,13 +77,21 @@ Fib::findLongestPrefixMatch(const Name& prefix) const
 const Entry&
 Fib::findLongestPrefixMatch(const pit::Entry& pitEntry) const
 {
-  return this->findLongestPrefixMatchImpl(pitEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(pitEntry);
+  BOOST_ASSERT(nte != nullptr);
+  if (nte->getName().size() < pitEntry.getName().size()) {
+    // the match may start at a deeper name tree entry, see NameTree::findLongestPrefixMatch
+    return this->findLongestPrefixMatchImpl(pitEntry);
+  }
+  return this->findLongestPrefixMatchCached(*nte);
 }
 
 const Entry&
 Fib::findLongestPrefixMatch(const measurements::Entry& measurementsEntry) const
 {
-  return this->findLongestPrefixMatchImpl(measurementsEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(measurementsEntry);
+  BOOST_ASSERT(nte != nullptr);
+  return this->findLongestPrefixMatchCached(*nte);
 }
 
 Entry*
@@ -85,6 +104,16 @@ Fib::findExactMatch(const Name& prefix)
   return nullptr;
 }
 
+std::vector<Entry*>
+Fib::findEntriesByNextHop(const Face& face) const
+{
+  auto it = m_nextHopIndex.find(&face);
+  if (it == m_nextHopIndex.end()) {
+    return {};
+  }
+  return {it->second.begin(), it->second.end()};
+}
+
 std::pair<Entry*, bool>
 Fib::insert(const Name& prefix)
 {
@@ -95,8 +124,11 @@ Fib::insert(const Name& prefix)
   }
 
   nte.setFibEntry(make_unique<Entry>(prefix));
+  entry = nte.getFibEntry();
+  entry->m_nextHopsVersion = ++m_lastNextHopsVersion;
   ++m_nItems;
-  return {nte.getFibEntry(), true};
+  ++m_generation;
+  return {entry, true};
 }
 
 void
@@ -104,11 +136,18 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 {
   BOOST_ASSERT(nte != nullptr);
 
+  Name prefix = nte->getName();
+  auto nexthops = nte->getFibEntry()->getNextHops();
+  for (const auto& nexthop : *nexthops) {
+    this->removeFromNextHopIndex(nexthop.getFace(), nte->getFibEntry());
+  }
   nte->setFibEntry(nullptr);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
   }
   --m_nItems;
+  ++m_generation;
+  this->afterNextHopsChange(prefix);
 }
 
 void
@@ -135,8 +174,12 @@ void
 Fib::addOrUpdateNextHop(Entry& entry, Face& face, uint64_t cost)
 {
   auto [it, isNew] = entry.addOrUpdateNextHop(face, cost);
-  if (isNew)
+  entry.m_nextHopsVersion = ++m_lastNextHopsVersion;
+  if (isNew) {
+    m_nextHopIndex[&face].insert(&entry);
     this->afterNewNextHop(entry.getPrefix(), *it);
+  }
+  this->afterNextHopsChange(entry.getPrefix());
 }
 
 Fib::RemoveNextHopResult
@@ -147,16 +190,42 @@ Fib::removeNextHop(Entry& entry, const Face& face)
   if (!isRemoved) {
     return RemoveNextHopResult::NO_SUCH_NEXTHOP;
   }
-  else if (!entry.hasNextHops()) {
+  this->removeFromNextHopIndex(face, &entry);
+
+  entry.m_nextHopsVersion = ++m_lastNextHopsVersion;
+  if (!entry.hasNextHops()) {
     name_tree::Entry* nte = m_nameTree.getEntry(entry);
     this->erase(nte, false);
     return RemoveNextHopResult::FIB_ENTRY_REMOVED;
   }
   else {
+    this->afterNextHopsChange(entry.getPrefix());
     return RemoveNextHopResult::NEXTHOP_REMOVED;
   }
 }
 
+std::vector<EntrySnapshot>
+Fib::takeSnapshot() const
+{
+  std::vector<EntrySnapshot> snapshot;
+  snapshot.reserve(m_nItems);
+  for (const auto& entry : *this) {
+    snapshot.push_back(entry.getSnapshot());
+  }
+  return snapshot;
+}
+
+void
+Fib::removeFromNextHopIndex(const Face& face, Entry* entry)
+{
+  auto it = m_nextHopIndex.find(&face);
+  BOOST_ASSERT(it != m_nextHopIndex.end());
+  it->second.erase(entry);
+  if (it->second.empty()) {
+    m_nextHopIndex.erase(it);
+  }
+}
+
 Fib::Range
 Fib::getRange() const
 {
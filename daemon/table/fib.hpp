@@ -31,6 +31,9 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <unordered_map>
+#include <unordered_set>
+
 namespace nfd {
 
 namespace measurements {
@@ -84,6 +87,13 @@ public: // lookup
   Entry*
   findExactMatch(const Name& prefix);
 
+  /** \brief Returns the entries that have a NextHop record for \p face.
+   *
+   *  This does not enumerate the FIB; it takes time proportional to the number of results.
+   */
+  std::vector<Entry*>
+  findEntriesByNextHop(const Face& face) const;
+
 public: // mutation
   /** \brief Maximum number of components in a FIB entry prefix.
    */
@@ -148,11 +158,24 @@ public: // enumeration
     return this->getRange().end();
   }
 
+  /** \brief Returns a point-in-time copy of all entries.
+   *
+   *  Nexthop lists are shared with the FIB rather than copied, so this is much cheaper than
+   *  copying the entries, and the result can be handed to another thread.
+   *  \sa EntrySnapshot
+   */
+  std::vector<EntrySnapshot>
+  takeSnapshot() const;
+
 public: // signal
   /** \brief Signals on Fib entry nexthop creation.
    */
   signal::Signal<Fib, Name, NextHop> afterNewNextHop;
 
+  /** \brief Signals after the nexthops of a Fib entry are modified, or the entry is erased.
+   */
+  signal::Signal<Fib, Name> afterNextHopsChange;
+
 private:
   /** \tparam K a parameter acceptable to NameTree::findLongestPrefixMatch
    */
@@ -160,15 +183,30 @@ private:
   const Entry&
   findLongestPrefixMatchImpl(const K& key) const;
 
+  /** \brief Performs a longest prefix match starting at \p nte, using the result cached on
+   *         \p nte if it is still valid.
+   */
+  const Entry&
+  findLongestPrefixMatchCached(const name_tree::Entry& nte) const;
+
   void
   erase(name_tree::Entry* nte, bool canDeleteNte = true);
 
+  void
+  removeFromNextHopIndex(const Face& face, Entry* entry);
+
   Range
   getRange() const;
 
 private:
   NameTree& m_nameTree;
   size_t m_nItems = 0;
+  /// incremented whenever an entry is inserted or erased, invalidating cached matches
+  uint64_t m_generation = 1;
+  /// last value assigned to an Entry's nexthops version
+  uint64_t m_lastNextHopsVersion = 0;
+  /// entries that have a NextHop record for each face
+  std::unordered_map<const Face*, std::unordered_set<Entry*>> m_nextHopIndex;
 
   /** \brief The empty FIB entry.
    *
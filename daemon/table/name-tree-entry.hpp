@@ -165,6 +165,38 @@ public: // attached table entries
     return tableEntry.m_nameTreeEntry;
   }
 
+public: // longest prefix match caches
+  /** \brief Result of a longest prefix match that starts at this entry, cached by a table.
+   *
+   *  \c value is valid only while \c generation equals the current generation of the table
+   *  that stored it. A table increments its generation on every change that may alter the
+   *  result of a longest prefix match.
+   */
+  template<typename T>
+  struct LpmCache
+  {
+    T* value = nullptr;
+    uint64_t generation = 0;
+  };
+
+  /** \brief Cached longest prefix match on the FIB.
+   *  \note This is for Fib internal use.
+   */
+  LpmCache<const fib::Entry>&
+  getFibCache() const noexcept
+  {
+    return m_fibCache;
+  }
+
+  /** \brief Cached effective strategy.
+   *  \note This is for StrategyChoice internal use.
+   */
+  LpmCache<fw::Strategy>&
+  getStrategyCache() const noexcept
+  {
+    return m_strategyCache;
+  }
+
 private:
   Name m_name;
   Node* m_node;
@@ -176,6 +208,9 @@ private:
   unique_ptr<measurements::Entry> m_measurementsEntry;
   unique_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
 
+  mutable LpmCache<const fib::Entry> m_fibCache;
+  mutable LpmCache<fw::Strategy> m_strategyCache;
+
   friend Node* getNode(const Entry& entry);
 };
 
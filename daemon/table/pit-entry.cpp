@@ -26,9 +26,52 @@
 #include "pit-entry.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 namespace nfd::pit {
 
+FaceIndex::~FaceIndex()
+{
+  // records may outlive the index, so they must not point to its list heads
+  for (auto& [face, records] : m_records) {
+    records.clear();
+  }
+}
+
+void
+FaceIndex::link(FaceRecord& record, Entry* entry)
+{
+  BOOST_ASSERT(!record.m_faceIndexHook.is_linked());
+  record.m_entry = entry;
+  m_records[&record.getFace()].push_back(record);
+}
+
+std::vector<Entry*>
+FaceIndex::find(const Face& face) const
+{
+  std::vector<Entry*> entries;
+  auto it = m_records.find(&face);
+  if (it != m_records.end()) {
+    for (const auto& record : it->second) {
+      entries.push_back(record.m_entry);
+    }
+    // an entry appears twice if it has both an in-record and an out-record for the face
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+  }
+  return entries;
+}
+
+void
+FaceIndex::erase(const Face& face)
+{
+  auto it = m_records.find(&face);
+  if (it != m_records.end()) {
+    BOOST_ASSERT(it->second.empty());
+    m_records.erase(it);
+  }
+}
+
 Entry::Entry(const Interest& interest)
   : m_interest(interest.shared_from_this())
 {
@@ -47,43 +90,118 @@ Entry::canMatch(const Interest& interest, size_t nEqualNameComps) const
   /// \todo #3162 match ForwardingHint field
 }
 
+static uint32_t
+toNonceKey(Interest::Nonce nonce)
+{
+  uint32_t key;
+  std::memcpy(&key, nonce.data(), sizeof(key));
+  return key;
+}
+
 InRecordCollection::iterator
-Entry::getInRecord(const Face& face)
+Entry::findInRecord(const Face& face) const
 {
-  return std::find_if(m_inRecords.begin(), m_inRecords.end(),
+  auto& inRecords = const_cast<InRecordCollection&>(m_inRecords);
+  if (m_inRecordIndex != nullptr) {
+    auto it = m_inRecordIndex->byFace.find(&face);
+    return it == m_inRecordIndex->byFace.end() ? inRecords.end() : it->second;
+  }
+  return std::find_if(inRecords.begin(), inRecords.end(),
     [&face] (const InRecord& inRecord) { return &inRecord.getFace() == &face; });
 }
 
+InRecordCollection::iterator
+Entry::getInRecord(const Face& face)
+{
+  return this->findInRecord(face);
+}
+
+InRecordCollection::const_iterator
+Entry::getInRecord(const Face& face) const
+{
+  return this->findInRecord(face);
+}
+
+size_t
+Entry::countInRecordsWithNonce(Interest::Nonce nonce) const
+{
+  if (m_inRecordIndex != nullptr) {
+    auto it = m_inRecordIndex->nNonces.find(toNonceKey(nonce));
+    return it == m_inRecordIndex->nNonces.end() ? 0 : it->second;
+  }
+  return std::count_if(m_inRecords.begin(), m_inRecords.end(),
+    [nonce] (const InRecord& inRecord) { return inRecord.getLastNonce() == nonce; });
+}
+
 InRecordCollection::iterator
 Entry::insertOrUpdateInRecord(Face& face, const Interest& interest)
 {
   BOOST_ASSERT(this->canMatch(interest));
 
-  auto it = std::find_if(m_inRecords.begin(), m_inRecords.end(),
-    [&face] (const InRecord& inRecord) { return &inRecord.getFace() == &face; });
+  auto it = this->findInRecord(face);
   if (it == m_inRecords.end()) {
     m_inRecords.emplace_front(face);
     it = m_inRecords.begin();
+    if (m_inRecordIndex != nullptr) {
+      m_inRecordIndex->byFace.emplace(&face, it);
+    }
+    this->linkFaceRecord(*it);
+  }
+  else if (m_inRecordIndex != nullptr) {
+    auto nonceIt = m_inRecordIndex->nNonces.find(toNonceKey(it->getLastNonce()));
+    BOOST_ASSERT(nonceIt != m_inRecordIndex->nNonces.end());
+    if (--nonceIt->second == 0) {
+      m_inRecordIndex->nNonces.erase(nonceIt);
+    }
   }
 
   it->update(interest);
+
+  if (m_inRecordIndex != nullptr) {
+    ++m_inRecordIndex->nNonces[toNonceKey(it->getLastNonce())];
+  }
+  else if (m_inRecords.size() >= IN_RECORD_INDEX_THRESHOLD) {
+    this->buildInRecordIndex();
+  }
   return it;
 }
 
+void
+Entry::buildInRecordIndex()
+{
+  m_inRecordIndex = make_unique<InRecordIndex>();
+  m_inRecordIndex->byFace.reserve(m_inRecords.size());
+  for (auto it = m_inRecords.begin(); it != m_inRecords.end(); ++it) {
+    m_inRecordIndex->byFace.emplace(&it->getFace(), it);
+    ++m_inRecordIndex->nNonces[toNonceKey(it->getLastNonce())];
+  }
+}
+
 void
 Entry::deleteInRecord(const Face& face)
 {
-  auto it = std::find_if(m_inRecords.begin(), m_inRecords.end(),
-    [&face] (const InRecord& inRecord) { return &inRecord.getFace() == &face; });
-  if (it != m_inRecords.end()) {
-    m_inRecords.erase(it);
+  auto it = this->findInRecord(face);
+  if (it == m_inRecords.end()) {
+    return;
   }
+
+  if (m_inRecordIndex != nullptr) {
+    m_inRecordIndex->byFace.erase(&face);
+    auto nonceIt = m_inRecordIndex->nNonces.find(toNonceKey(it->getLastNonce()));
+    BOOST_ASSERT(nonceIt != m_inRecordIndex->nNonces.end());
+    if (--nonceIt->second == 0) {
+      m_inRecordIndex->nNonces.erase(nonceIt);
+    }
+  }
+  // erasing the record also removes it from the face index
+  m_inRecords.erase(it);
 }
 
 void
 Entry::clearInRecords()
 {
   m_inRecords.clear();
+  m_inRecordIndex.reset();
 }
 
 OutRecordCollection::iterator
@@ -103,6 +221,7 @@ Entry::insertOrUpdateOutRecord(Face& face, const Interest& interest)
   if (it == m_outRecords.end()) {
     m_outRecords.emplace_front(face);
     it = m_outRecords.begin();
+    this->linkFaceRecord(*it);
   }
 
   it->update(interest);
@@ -119,4 +238,20 @@ Entry::deleteOutRecord(const Face& face)
   }
 }
 
+void
+Entry::detachFaceIndex()
+{
+  if (m_faceIndex == nullptr) {
+    return;
+  }
+
+  for (auto& inRecord : m_inRecords) {
+    inRecord.m_faceIndexHook.unlink();
+  }
+  for (auto& outRecord : m_outRecords) {
+    outRecord.m_faceIndexHook.unlink();
+  }
+  m_faceIndex = nullptr;
+}
+
 } // namespace nfd::pit
@@ -29,7 +29,10 @@
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
 
+#include <boost/intrusive/list.hpp>
+
 #include <list>
+#include <unordered_map>
 
 namespace nfd::name_tree {
 class Entry;
@@ -47,6 +50,43 @@ using InRecordCollection = std::list<InRecord>;
  */
 using OutRecordCollection = std::list<OutRecord>;
 
+class Entry;
+class Pit;
+
+/** \brief Index of PIT entries by the faces of their in-records and out-records.
+ *
+ *  The records of each face are kept in an intrusive list, hooked into the records themselves.
+ *  A record is unlinked in constant time when it is destroyed, without any lookup.
+ */
+class FaceIndex : noncopyable
+{
+public:
+  ~FaceIndex();
+
+  /** \brief Adds \p record, which belongs to \p entry, to the list of its face.
+   */
+  void
+  link(FaceRecord& record, Entry* entry);
+
+  /** \brief Returns the entries that have an in-record or out-record for \p face.
+   */
+  std::vector<Entry*>
+  find(const Face& face) const;
+
+  /** \brief Drops the list of \p face, which must not have any records left.
+   */
+  void
+  erase(const Face& face);
+
+private:
+  using RecordList = boost::intrusive::list<FaceRecord,
+    boost::intrusive::member_hook<FaceRecord, FaceRecord::FaceIndexHook,
+                                  &FaceRecord::m_faceIndexHook>,
+    boost::intrusive::constant_time_size<false>>;
+
+  std::unordered_map<const Face*, RecordList> m_records;
+};
+
 /**
  * \brief Represents an entry in the %Interest table (PIT).
  *
@@ -140,8 +180,20 @@ public: // in-record
   InRecordCollection::iterator
   getInRecord(const Face& face);
 
+  /** \brief Get the in-record for \p face.
+   *  \return an iterator to the in-record, or in_end() if it does not exist
+   */
+  InRecordCollection::const_iterator
+  getInRecord(const Face& face) const;
+
+  /** \brief Count the in-records whose last Nonce is \p nonce.
+   */
+  size_t
+  countInRecordsWithNonce(Interest::Nonce nonce) const;
+
   /** \brief Insert or update an in-record.
    *  \return an iterator to the new or updated in-record
+   *  \note In-records must only be updated through this function.
    */
   InRecordCollection::iterator
   insertOrUpdateInRecord(Face& face, const Interest& interest);
@@ -234,14 +286,52 @@ public:
    */
   time::milliseconds dataFreshnessPeriod = 0_ms;
 
+public:
+  /** \brief Number of in-records at which in-records start being indexed by face and Nonce.
+   */
+  static constexpr size_t IN_RECORD_INDEX_THRESHOLD = 16;
+
+private:
+  InRecordCollection::iterator
+  findInRecord(const Face& face) const;
+
+  void
+  buildInRecordIndex();
+
+  /** \brief Adds \p record to the face index, if this entry is in a Pit.
+   */
+  void
+  linkFaceRecord(FaceRecord& record)
+  {
+    if (m_faceIndex != nullptr) {
+      m_faceIndex->link(record, this);
+    }
+  }
+
+  /** \brief Removes all records of this entry from the face index, and stops maintaining it.
+   */
+  void
+  detachFaceIndex();
+
 private:
   shared_ptr<const Interest> m_interest;
   InRecordCollection m_inRecords;
   OutRecordCollection m_outRecords;
 
+  /** \brief Index of in-records, used when there are many downstreams, e.g., in a flash crowd.
+   */
+  struct InRecordIndex
+  {
+    std::unordered_map<const Face*, InRecordCollection::iterator> byFace;
+    std::unordered_map<uint32_t, size_t> nNonces; ///< number of in-records per last Nonce
+  };
+  unique_ptr<InRecordIndex> m_inRecordIndex; ///< null until IN_RECORD_INDEX_THRESHOLD is reached
+
   name_tree::Entry* m_nameTreeEntry = nullptr;
+  FaceIndex* m_faceIndex = nullptr; ///< set while the entry is in a Pit
 
   friend ::nfd::name_tree::Entry;
+  friend Pit;
 };
 
 } // namespace nfd::pit
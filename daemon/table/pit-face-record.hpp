@@ -29,8 +29,13 @@
 #include "face/face.hpp"
 #include "strategy-info-host.hpp"
 
+#include <boost/intrusive/list_hook.hpp>
+
 namespace nfd::pit {
 
+class Entry;
+class FaceIndex;
+
 /**
  * \brief Contains information about an Interest on an incoming or outgoing face.
  * \note This class is an implementation detail to extract common functionality
@@ -82,6 +87,15 @@ private:
   Interest::Nonce m_lastNonce{0, 0, 0, 0};
   time::steady_clock::time_point m_lastRenewed = time::steady_clock::time_point::min();
   time::steady_clock::time_point m_expiry = time::steady_clock::time_point::min();
+
+  using FaceIndexHook = boost::intrusive::list_member_hook<
+    boost::intrusive::link_mode<boost::intrusive::auto_unlink>>;
+  /// links the record into the FaceIndex list of its face; unlinked when the record is destroyed
+  FaceIndexHook m_faceIndexHook;
+  Entry* m_entry = nullptr; ///< the PIT entry owning this record, set while it is linked
+
+  friend Entry;
+  friend FaceIndex;
 };
 
 } // namespace nfd::pit
@@ -76,6 +76,7 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
   }
 
   auto entry = make_shared<Entry>(interest);
+  entry->m_faceIndex = &m_faceIndex;
   nte->insertPitEntry(entry);
   ++m_nItems;
   return {entry, true};
@@ -103,6 +104,7 @@ Pit::erase(Entry* entry, bool canDeleteNte)
   name_tree::Entry* nte = m_nameTree.getEntry(*entry);
   BOOST_ASSERT(nte != nullptr);
 
+  entry->detachFaceIndex();
   nte->erasePitEntry(entry);
   if (canDeleteNte) {
     m_nameTree.eraseIfEmpty(nte);
@@ -121,6 +123,15 @@ Pit::deleteInOutRecords(Entry* entry, const Face& face)
   /// \todo decide whether to delete PIT entry if there's no more in/out-record left
 }
 
+void
+Pit::deleteInOutRecords(const Face& face)
+{
+  for (Entry* entry : m_faceIndex.find(face)) {
+    this->deleteInOutRecords(entry, face);
+  }
+  m_faceIndex.erase(face);
+}
+
 Pit::const_iterator
 Pit::begin() const
 {
@@ -98,6 +98,24 @@ public:
   void
   deleteInOutRecords(Entry* entry, const Face& face);
 
+  /** \brief Deletes in-records and out-records for \p face in all entries.
+   *
+   *  This does not enumerate the PIT; it takes time proportional to the number of entries
+   *  that have a record for \p face.
+   */
+  void
+  deleteInOutRecords(const Face& face);
+
+  /** \brief Returns the entries that have an in-record or out-record for \p face.
+   *
+   *  This does not enumerate the PIT; it takes time proportional to the number of results.
+   */
+  std::vector<Entry*>
+  findEntriesByFace(const Face& face) const
+  {
+    return m_faceIndex.find(face);
+  }
+
 public: // enumeration
   using const_iterator = Iterator;
 
@@ -136,6 +154,7 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems = 0;
+  FaceIndex m_faceIndex;
 };
 
 } // namespace pit
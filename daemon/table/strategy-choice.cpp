@@ -64,6 +64,7 @@ StrategyChoice::setDefaultStrategy(const Name& strategyName)
   name_tree::Entry& nte = m_nameTree.lookup(Name());
   nte.setStrategyChoiceEntry(std::move(entry));
   ++m_nItems;
+  ++m_generation;
 }
 
 StrategyChoice::InsertResult
@@ -110,6 +111,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
   this->changeStrategy(*entry, *oldStrategy, *strategy);
   entry->setStrategy(std::move(strategy));
+  ++m_generation;
   return InsertResult::OK;
 }
 
@@ -159,6 +161,7 @@ StrategyChoice::erase(const Name& prefix)
   nte->setStrategyChoiceEntry(nullptr);
   m_nameTree.eraseIfEmpty(nte);
   --m_nItems;
+  ++m_generation;
 }
 
 std::pair<bool, Name>
@@ -186,22 +189,45 @@ StrategyChoice::findEffectiveStrategyImpl(const K& key) const
   return nte->getStrategyChoiceEntry()->getStrategy();
 }
 
+Strategy&
+StrategyChoice::findEffectiveStrategyCached(const name_tree::Entry& nte) const
+{
+  auto& cache = nte.getStrategyCache();
+  if (cache.generation != m_generation) {
+    cache.value = &this->findEffectiveStrategyImpl(nte);
+    cache.generation = m_generation;
+  }
+  return *cache.value;
+}
+
 Strategy&
 StrategyChoice::findEffectiveStrategy(const Name& prefix) const
 {
+  const name_tree::Entry* nte = m_nameTree.findExactMatch(prefix);
+  if (nte != nullptr) {
+    return this->findEffectiveStrategyCached(*nte);
+  }
   return this->findEffectiveStrategyImpl(prefix);
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const pit::Entry& pitEntry) const
 {
-  return this->findEffectiveStrategyImpl(pitEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(pitEntry);
+  BOOST_ASSERT(nte != nullptr);
+  if (nte->getName().size() < pitEntry.getName().size()) {
+    // the match may start at a deeper name tree entry, see NameTree::findLongestPrefixMatch
+    return this->findEffectiveStrategyImpl(pitEntry);
+  }
+  return this->findEffectiveStrategyCached(*nte);
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const measurements::Entry& measurementsEntry) const
 {
-  return this->findEffectiveStrategyImpl(measurementsEntry);
+  const name_tree::Entry* nte = m_nameTree.getEntry(measurementsEntry);
+  BOOST_ASSERT(nte != nullptr);
+  return this->findEffectiveStrategyCached(*nte);
 }
 
 static inline void
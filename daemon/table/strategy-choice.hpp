@@ -187,6 +187,12 @@ private:
   fw::Strategy&
   findEffectiveStrategyImpl(const K& key) const;
 
+  /** \brief Finds the effective strategy for \p nte, using the result cached on \p nte
+   *         if it is still valid.
+   */
+  fw::Strategy&
+  findEffectiveStrategyCached(const name_tree::Entry& nte) const;
+
   Range
   getRange() const;
 
@@ -194,6 +200,8 @@ private:
   Forwarder& m_forwarder;
   NameTree& m_nameTree;
   size_t m_nItems = 0;
+  /// incremented whenever a strategy is set or unset, invalidating cached effective strategies
+  uint64_t m_generation = 1;
 };
 
 std::ostream&
@@ -28,15 +28,32 @@
 
 #include "fw/strategy-info.hpp"
 
-#include <unordered_map>
+#include <algorithm>
 
 namespace nfd {
 
 /** \brief Base class for an entity onto which StrategyInfo items may be placed
+ *
+ *  One item whose type fits in \c INLINE_SIZE bytes is constructed within the host itself,
+ *  without any allocation. Larger items, and small items once the inline slot is taken, are
+ *  allocated on the heap. The overflow list itself is allocated only when needed, so that
+ *  the host is no larger than a hash table of items would be.
  */
 class StrategyInfoHost
 {
 public:
+  StrategyInfoHost() = default;
+
+  StrategyInfoHost(const StrategyInfoHost&) = delete;
+
+  StrategyInfoHost&
+  operator=(const StrategyInfoHost&) = delete;
+
+  ~StrategyInfoHost()
+  {
+    this->clearStrategyInfo();
+  }
+
   /** \brief Get a StrategyInfo item
    *  \tparam T type of StrategyInfo, must be a subclass of fw::StrategyInfo
    *  \return an existing StrategyInfo item of type T, or nullptr if it does not exist
@@ -46,12 +63,19 @@ public:
   getStrategyInfo() const
   {
     static_assert(std::is_base_of_v<fw::StrategyInfo, T>);
+    static_assert(T::getTypeId() != EMPTY_TYPE_ID);
 
-    auto it = m_items.find(T::getTypeId());
-    if (it == m_items.end()) {
-      return nullptr;
+    if (m_inline.typeId == T::getTypeId()) {
+      return static_cast<T*>(m_inline.item);
     }
-    return static_cast<T*>(it->second.get());
+    if (m_overflow != nullptr) {
+      for (const auto& [typeId, item] : *m_overflow) {
+        if (typeId == T::getTypeId()) {
+          return static_cast<T*>(item.get());
+        }
+      }
+    }
+    return nullptr;
   }
 
   /** \brief Insert a StrategyInfo item
@@ -64,13 +88,27 @@ public:
   insertStrategyInfo(A&&... args)
   {
     static_assert(std::is_base_of_v<fw::StrategyInfo, T>);
+    static_assert(T::getTypeId() != EMPTY_TYPE_ID);
+
+    T* existing = this->getStrategyInfo<T>();
+    if (existing != nullptr) {
+      return {existing, false};
+    }
 
-    auto& item = m_items[T::getTypeId()];
-    bool isNew = item == nullptr;
-    if (isNew) {
-      item = make_unique<T>(std::forward<A>(args)...);
+    if constexpr (sizeof(T) <= INLINE_SIZE && alignof(T) <= alignof(std::max_align_t)) {
+      if (m_inline.typeId == EMPTY_TYPE_ID) {
+        T* item = new (m_inline.storage) T(std::forward<A>(args)...);
+        m_inline.item = item;
+        m_inline.typeId = T::getTypeId();
+        return {item, true};
+      }
     }
-    return {static_cast<T*>(item.get()), isNew};
+
+    if (m_overflow == nullptr) {
+      m_overflow = make_unique<OverflowList>();
+    }
+    auto& item = m_overflow->emplace_back(T::getTypeId(), make_unique<T>(std::forward<A>(args)...));
+    return {static_cast<T*>(item.second.get()), true};
   }
 
   /** \brief Erase a StrategyInfo item
@@ -82,8 +120,24 @@ public:
   eraseStrategyInfo()
   {
     static_assert(std::is_base_of_v<fw::StrategyInfo, T>);
+    static_assert(T::getTypeId() != EMPTY_TYPE_ID);
 
-    return m_items.erase(T::getTypeId());
+    if (m_inline.typeId == T::getTypeId()) {
+      destroy(m_inline);
+      return 1;
+    }
+    if (m_overflow == nullptr) {
+      return 0;
+    }
+    auto it = std::find_if(m_overflow->begin(), m_overflow->end(),
+                           [] (const auto& p) { return p.first == T::getTypeId(); });
+    if (it == m_overflow->end()) {
+      return 0;
+    }
+    // the item is destroyed after it has been removed from the host
+    auto item = std::move(it->second);
+    m_overflow->erase(it);
+    return 1;
   }
 
   /** \brief Clear all StrategyInfo items
@@ -91,11 +145,40 @@ public:
   void
   clearStrategyInfo()
   {
-    m_items.clear();
+    if (m_inline.typeId != EMPTY_TYPE_ID) {
+      destroy(m_inline);
+    }
+    auto overflow = std::move(m_overflow);
   }
 
+public:
+  /// maximum size of an item stored within the host
+  static constexpr size_t INLINE_SIZE = 32;
+
+private:
+  static constexpr int EMPTY_TYPE_ID = 0;
+
+  struct Slot
+  {
+    int typeId = EMPTY_TYPE_ID;
+    fw::StrategyInfo* item = nullptr;
+    alignas(std::max_align_t) unsigned char storage[INLINE_SIZE];
+  };
+
+  static void
+  destroy(Slot& slot) noexcept
+  {
+    // mark the slot empty before running the destructor
+    fw::StrategyInfo* item = std::exchange(slot.item, nullptr);
+    slot.typeId = EMPTY_TYPE_ID;
+    item->~StrategyInfo();
+  }
+
+  using OverflowList = std::vector<std::pair<int, unique_ptr<fw::StrategyInfo>>>;
+
 private:
-  std::unordered_map<int, unique_ptr<fw::StrategyInfo>> m_items;
+  Slot m_inline;
+  unique_ptr<OverflowList> m_overflow;
 };
 
 } // namespace nfd
@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "core/control-parameters-list.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd::tests {
+
+using ndn::nfd::ControlParameters;
+
+BOOST_AUTO_TEST_SUITE(TestControlParametersList)
+
+BOOST_AUTO_TEST_CASE(EncodeDecode)
+{
+  ControlParametersList list1;
+  list1.addItem(ControlParameters().setName("/A").setFaceId(1))
+       .addItem(ControlParameters().setName("/B").setCost(10));
+
+  Block wire = list1.wireEncode();
+  BOOST_CHECK_EQUAL(wire.type(), ControlParametersList::TLV_TYPE);
+
+  ControlParametersList list2(wire);
+  BOOST_REQUIRE_EQUAL(list2.getItems().size(), 2);
+  BOOST_CHECK_EQUAL(list2.getItems()[0].getName(), "/A");
+  BOOST_CHECK_EQUAL(list2.getItems()[0].getFaceId(), 1);
+  BOOST_CHECK_EQUAL(list2.getItems()[1].getName(), "/B");
+  BOOST_CHECK_EQUAL(list2.getItems()[1].getCost(), 10);
+
+  ControlParametersList empty(ControlParametersList().wireEncode());
+  BOOST_CHECK(empty.getItems().empty());
+}
+
+BOOST_AUTO_TEST_CASE(DecodeError)
+{
+  // wrong outer type
+  BOOST_CHECK_THROW(ControlParametersList(ControlParameters().setName("/A").wireEncode()),
+                    ControlParametersList::Error);
+
+  // wrong element type
+  Block wire(ControlParametersList::TLV_TYPE);
+  wire.push_back(ndn::makeNonNegativeIntegerBlock(tlv::nfd::FaceId, 1));
+  wire.encode();
+  BOOST_CHECK_THROW(ControlParametersList{wire}, ControlParametersList::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestControlParametersList
+
+} // namespace nfd::tests
@@ -137,6 +137,29 @@ BOOST_FIXTURE_TEST_CASE(AdvanceClocks, RibIoTimeFixture)
   BOOST_CHECK_EQUAL(hasRibRun, true);
 }
 
+BOOST_AUTO_TEST_CASE(AliveToken)
+{
+  auto token = make_shared<nfd::AliveToken>();
+  BOOST_TEST(token->isOpen());
+
+  int nRuns = 0;
+  BOOST_TEST(token->post([&] { ++nRuns; }));
+  pollIo();
+  BOOST_TEST(nRuns == 1);
+
+  // a function posted before the token is closed does not run
+  BOOST_TEST(token->post([&] { ++nRuns; }));
+  token->close();
+  BOOST_TEST(!token->isOpen());
+  pollIo();
+  BOOST_TEST(nRuns == 1);
+
+  // nothing is posted after the token is closed
+  BOOST_TEST(!token->post([&] { ++nRuns; }));
+  pollIo();
+  BOOST_TEST(nRuns == 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestGlobal
 
 } // namespace nfd::tests
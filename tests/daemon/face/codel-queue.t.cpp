@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/codel-queue.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+namespace nfd::tests {
+
+using namespace nfd::face;
+
+class CoDelQueueFixture : public GlobalIoTimeFixture
+{
+protected:
+  CoDelQueueFixture()
+  {
+    queue.afterDrop.connect([this] (const Block& packet) { droppedPackets.push_back(packet); });
+  }
+
+  static Block
+  makePacket(uint32_t type, size_t size = 1000)
+  {
+    return ndn::encoding::makeStringBlock(type, std::string(size, 'x'));
+  }
+
+protected:
+  CoDelQueue queue{{}};
+  std::vector<Block> droppedPackets;
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestCoDelQueue, CoDelQueueFixture)
+
+BOOST_AUTO_TEST_CASE(Fifo)
+{
+  BOOST_CHECK(queue.empty());
+  BOOST_CHECK(!queue.pop());
+
+  auto pkt1 = makePacket(300);
+  auto pkt2 = makePacket(301, 500);
+  BOOST_CHECK(queue.push(pkt1));
+  BOOST_CHECK(queue.push(pkt2));
+  BOOST_CHECK_EQUAL(queue.size(), 2);
+  BOOST_CHECK_EQUAL(queue.getBytes(), pkt1.size() + pkt2.size());
+
+  this->advanceClocks(1_s);
+  auto res = queue.pop();
+  BOOST_REQUIRE(res);
+  BOOST_CHECK_EQUAL(res->type(), 300);
+  res = queue.pop();
+  BOOST_REQUIRE(res);
+  BOOST_CHECK_EQUAL(res->type(), 301);
+  BOOST_CHECK(!queue.pop());
+  BOOST_CHECK_EQUAL(queue.getBytes(), 0);
+  BOOST_CHECK(droppedPackets.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  auto pkt = makePacket(300);
+  CoDelQueue::Options options;
+  options.capacity = pkt.size() * 2;
+  queue.setOptions(options);
+
+  BOOST_CHECK(queue.push(pkt));
+  BOOST_CHECK(queue.push(pkt));
+  BOOST_CHECK(!queue.push(pkt));
+  BOOST_CHECK_EQUAL(queue.size(), 2);
+  BOOST_CHECK_EQUAL(droppedPackets.size(), 1);
+
+  queue.pop();
+  BOOST_CHECK(queue.push(pkt));
+  BOOST_CHECK_EQUAL(droppedPackets.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(BelowTarget)
+{
+  CoDelQueue::Options options;
+  options.isCoDelEnabled = true;
+  queue.setOptions(options);
+
+  // a standing queue of 10 packets, each leaving 2 ms after arrival, for more than one interval
+  for (int i = 0; i < 10; ++i) {
+    queue.push(makePacket(300));
+  }
+  for (int i = 0; i < 200; ++i) {
+    this->advanceClocks(2_ms);
+    for (int j = 0; j < 10; ++j) {
+      BOOST_CHECK(queue.pop());
+      queue.push(makePacket(300));
+    }
+  }
+  BOOST_CHECK(droppedPackets.empty());
+  BOOST_CHECK(!queue.isDropping());
+}
+
+BOOST_AUTO_TEST_CASE(AboveTarget)
+{
+  CoDelQueue::Options options;
+  options.isCoDelEnabled = true;
+  options.target = 5_ms;
+  options.interval = 100_ms;
+  queue.setOptions(options);
+
+  for (int i = 0; i < 100; ++i) {
+    queue.push(makePacket(300));
+  }
+
+  // sojourn time above target, but not yet for one interval
+  this->advanceClocks(10_ms);
+  BOOST_CHECK(queue.pop());
+  BOOST_CHECK(droppedPackets.empty());
+  BOOST_CHECK(!queue.isDropping());
+
+  // above target for one interval: drop one packet and enter dropping state
+  this->advanceClocks(100_ms);
+  BOOST_CHECK(queue.pop());
+  BOOST_CHECK_EQUAL(droppedPackets.size(), 1);
+  BOOST_CHECK(queue.isDropping());
+
+  // next drop is scheduled one interval later
+  this->advanceClocks(50_ms);
+  BOOST_CHECK(queue.pop());
+  BOOST_CHECK_EQUAL(droppedPackets.size(), 1);
+  this->advanceClocks(50_ms);
+  BOOST_CHECK(queue.pop());
+  BOOST_CHECK_EQUAL(droppedPackets.size(), 2);
+
+  // drop interval shrinks with the square root of the drop count (100ms / sqrt(2))
+  this->advanceClocks(71_ms);
+  BOOST_CHECK(queue.pop());
+  BOOST_CHECK_EQUAL(droppedPackets.size(), 3);
+
+  // packets enqueued after the backlog is flushed have a low sojourn time
+  queue.clear();
+  BOOST_CHECK(!queue.isDropping());
+  queue.push(makePacket(301));
+  BOOST_CHECK(queue.pop());
+  BOOST_CHECK_EQUAL(droppedPackets.size(), 3);
+  BOOST_CHECK(!queue.isDropping());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCoDelQueue
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace nfd::tests
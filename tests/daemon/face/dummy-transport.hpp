@@ -72,6 +72,31 @@ public:
     m_sendQueueLength = sendQueueLength;
   }
 
+  bool
+  isSendQueueDrainPending() const override
+  {
+    return m_isDrainPending;
+  }
+
+  /** \brief Simulates a send queue that is being flushed by the transport itself.
+   *
+   *  While pending, isSendQueueDrainPending() returns true. drainSendQueue() empties the
+   *  queue and emits afterSendQueueDrained.
+   */
+  void
+  setSendQueueDrainPending(bool isDrainPending)
+  {
+    m_isDrainPending = isDrainPending;
+  }
+
+  void
+  drainSendQueue()
+  {
+    m_sendQueueLength = 0;
+    m_isDrainPending = false;
+    this->notifySendQueueDrained();
+  }
+
   void
   receivePacket(const Block& block)
   {
@@ -104,6 +129,7 @@ public:
 
 private:
   ssize_t m_sendQueueLength = 0;
+  bool m_isDrainPending = false;
 };
 
 using DummyTransport = DummyTransportBase<true>;
@@ -0,0 +1,239 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/egress-scheduler.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd::tests {
+
+using namespace nfd::face;
+
+class EgressSchedulerFixture
+{
+protected:
+  static Block
+  makePacket(uint32_t type, size_t size = 1000)
+  {
+    // TLV-TYPE and TLV-LENGTH take 3 octets each
+    BOOST_ASSERT(size >= 259);
+    return ndn::encoding::makeStringBlock(type, std::string(size - 6, 'x'));
+  }
+
+  static EgressScheduler::Class
+  makeClass(const std::string& name, uint8_t priority, uint32_t weight)
+  {
+    EgressScheduler::Class cls;
+    cls.name = name;
+    cls.priority = priority;
+    cls.weight = weight;
+    return cls;
+  }
+
+  /** \brief Pops \p n packets and returns their TLV-TYPEs.
+   */
+  std::vector<uint32_t>
+  popTypes(size_t n)
+  {
+    std::vector<uint32_t> types;
+    for (size_t i = 0; i < n; ++i) {
+      auto packet = scheduler.pop();
+      BOOST_REQUIRE(packet);
+      types.push_back(packet->type());
+    }
+    return types;
+  }
+
+protected:
+  EgressScheduler scheduler{{}};
+};
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestEgressScheduler, EgressSchedulerFixture)
+
+BOOST_AUTO_TEST_CASE(Fifo)
+{
+  BOOST_CHECK(!scheduler.getOptions().isEnabled());
+  BOOST_CHECK_EQUAL(scheduler.getNClasses(), 1);
+  BOOST_CHECK_EQUAL(scheduler.classify(PacketType::INTEREST, "/A"), 0);
+
+  for (uint32_t type = 300; type < 305; ++type) {
+    scheduler.push(makePacket(type), 0);
+  }
+  BOOST_CHECK_EQUAL(scheduler.size(), 5);
+  BOOST_CHECK_EQUAL(scheduler.getBytes(), 5000);
+
+  std::vector<uint32_t> expected{300, 301, 302, 303, 304};
+  auto actual = popTypes(5);
+  BOOST_TEST(actual == expected, boost::test_tools::per_element());
+  BOOST_CHECK(scheduler.empty());
+  BOOST_CHECK(!scheduler.pop());
+}
+
+BOOST_AUTO_TEST_CASE(Classify)
+{
+  EgressScheduler::Options options;
+  options.classes.push_back(makeClass("control", 0, 1));
+  options.classes.back().packetTypes = static_cast<uint8_t>(PacketType::NACK);
+  options.classes.back().prefixes = {"/localhop", "/localhost"};
+  options.classes.push_back(makeClass("a", 128, 1));
+  options.classes.back().prefixes = {"/A"};
+  options.classes.push_back(makeClass("data", 128, 1));
+  options.classes.back().packetTypes = static_cast<uint8_t>(PacketType::DATA);
+  scheduler.setOptions(options);
+  BOOST_CHECK_EQUAL(scheduler.getNClasses(), 4);
+
+  BOOST_CHECK_EQUAL(scheduler.classify(PacketType::NACK, "/localhop/nfd"), 1);
+  BOOST_CHECK_EQUAL(scheduler.classify(PacketType::INTEREST, "/localhop/nfd"), 0);
+  BOOST_CHECK_EQUAL(scheduler.classify(PacketType::NACK, "/A/B"), 2);
+  BOOST_CHECK_EQUAL(scheduler.classify(PacketType::DATA, "/A/B"), 2);
+  BOOST_CHECK_EQUAL(scheduler.classify(PacketType::DATA, "/C"), 3);
+  BOOST_CHECK_EQUAL(scheduler.classify(PacketType::INTEREST, "/C"), 0);
+}
+
+BOOST_AUTO_TEST_CASE(StrictPriority)
+{
+  EgressScheduler::Options options;
+  options.classes.push_back(makeClass("high", 0, 1));
+  options.classes.push_back(makeClass("low", 200, 100));
+  scheduler.setOptions(options);
+
+  scheduler.push(makePacket(302), 2);
+  scheduler.push(makePacket(300), 0);
+  scheduler.push(makePacket(301), 1);
+  scheduler.push(makePacket(300), 0);
+  scheduler.push(makePacket(301), 1);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(0), 2);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(1), 2);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(2), 1);
+
+  std::vector<uint32_t> expected{301, 301, 300};
+  auto actual = popTypes(3);
+  BOOST_TEST(actual == expected, boost::test_tools::per_element());
+
+  // a newly arrived high priority packet overtakes the queued ones
+  scheduler.push(makePacket(301), 1);
+  expected = {301, 300, 302};
+  actual = popTypes(3);
+  BOOST_TEST(actual == expected, boost::test_tools::per_element());
+  BOOST_CHECK(scheduler.empty());
+}
+
+BOOST_AUTO_TEST_CASE(DeficitRoundRobin)
+{
+  EgressScheduler::Options options;
+  options.classes.push_back(makeClass("heavy", 128, 3));
+  options.quantum = 1000;
+  scheduler.setOptions(options);
+
+  for (int i = 0; i < 8; ++i) {
+    scheduler.push(makePacket(300), 0);
+    scheduler.push(makePacket(301), 1);
+  }
+
+  // the heavy class is served three times as often as the default class
+  std::vector<uint32_t> expected{300, 301, 301, 301, 300, 301, 301, 301};
+  auto actual = popTypes(8);
+  BOOST_TEST(actual == expected, boost::test_tools::per_element());
+
+  // the default class gets the whole link once the heavy class is idle
+  actual = popTypes(8);
+  BOOST_CHECK_EQUAL(std::count(actual.begin(), actual.end(), 300), 6);
+  BOOST_CHECK(scheduler.empty());
+}
+
+BOOST_AUTO_TEST_CASE(LargePacket)
+{
+  EgressScheduler::Options options;
+  options.classes.push_back(makeClass("other", 128, 1));
+  options.quantum = 500;
+  scheduler.setOptions(options);
+
+  // a packet larger than the quantum is sent after its class accumulates enough deficit
+  scheduler.push(makePacket(300, 1200), 0);
+  scheduler.push(makePacket(301, 400), 1);
+  scheduler.push(makePacket(301, 400), 1);
+  scheduler.push(makePacket(301, 400), 1);
+
+  std::vector<uint32_t> expected{301, 301, 300, 301};
+  auto actual = popTypes(4);
+  BOOST_TEST(actual == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(SetOptions)
+{
+  EgressScheduler::Options options;
+  options.classes.push_back(makeClass("a", 0, 1));
+  options.classes.push_back(makeClass("b", 0, 1));
+  scheduler.setOptions(options);
+
+  scheduler.push(makePacket(300), 0);
+  scheduler.push(makePacket(301), 1);
+  scheduler.push(makePacket(302), 2);
+  scheduler.push(makePacket(303), 2);
+
+  // changing only priorities and weights keeps packets in their classes
+  options.classes[1].priority = 1;
+  options.classes[1].weight = 2;
+  scheduler.setOptions(options);
+  BOOST_CHECK_EQUAL(scheduler.getNClasses(), 3);
+  BOOST_CHECK_EQUAL(scheduler.size(), 4);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(0), 1);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(1), 1);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(2), 2);
+
+  // if the classes change, all packets are moved to the default class
+  options.classes.pop_back();
+  scheduler.setOptions(options);
+  BOOST_CHECK_EQUAL(scheduler.getNClasses(), 2);
+  BOOST_CHECK_EQUAL(scheduler.size(), 4);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(0), 4);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(1), 0);
+
+  scheduler.push(makePacket(304), 1);
+  std::vector<uint32_t> expected{304, 300, 301, 302, 303};
+  auto actual = popTypes(5);
+  BOOST_TEST(actual == expected, boost::test_tools::per_element());
+
+  // a changed prefix list also invalidates the classification
+  options.classes.push_back(makeClass("b", 0, 1));
+  scheduler.setOptions(options);
+  scheduler.push(makePacket(305), 2);
+  options.classes[1].prefixes.push_back("/b");
+  scheduler.setOptions(options);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(0), 1);
+  BOOST_CHECK_EQUAL(scheduler.getQueueLength(2), 0);
+  scheduler.pop();
+
+  scheduler.push(makePacket(300), 1);
+  scheduler.clear();
+  BOOST_CHECK(scheduler.empty());
+  BOOST_CHECK_EQUAL(scheduler.getBytes(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestEgressScheduler
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace nfd::tests
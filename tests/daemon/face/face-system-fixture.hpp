@@ -168,7 +168,10 @@ public:
                   FaceSystem::ConfigContext& context) final
   {
     processConfigHistory.push_back({configSection, context.isDryRun,
-                                    context.generalConfig.wantCongestionMarking});
+                                    context.generalConfig.wantCongestionMarking,
+                                    context.generalConfig.streamSendQueueOptions,
+                                    context.generalConfig.rateLimitOptions,
+                                    context.generalConfig.trafficClassOptions});
     if (!context.isDryRun) {
       providedSchemes = newProvidedSchemes;
     }
@@ -180,6 +183,9 @@ public:
     OptionalConfigSection configSection;
     bool isDryRun;
     bool wantCongestionMarking;
+    face::CoDelQueue::Options streamSendQueueOptions;
+    face::TokenBucketShaper::Options rateLimitOptions;
+    face::EgressScheduler::Options trafficClassOptions;
   };
   std::vector<ProcessConfigArgs> processConfigHistory;
 
@@ -83,6 +83,235 @@ BOOST_AUTO_TEST_CASE(Normal)
   BOOST_CHECK_EQUAL(f2->processConfigHistory.back().configSection->get<std::string>("key"), "v2");
 }
 
+BOOST_AUTO_TEST_CASE(SendQueue)
+{
+  faceSystem.m_factories["f1"] = make_unique<DummyProtocolFactory>(faceSystem.makePFCtorParams());
+  auto f1 = static_cast<DummyProtocolFactory*>(faceSystem.getFactoryById("f1"));
+
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        send_queue
+        {
+          capacity 1048576
+          enable_codel yes
+          codel_target 10
+          codel_interval 200
+        }
+      }
+      f1
+      {
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, false);
+  BOOST_REQUIRE_EQUAL(f1->processConfigHistory.size(), 1);
+  const auto& options = f1->processConfigHistory.back().streamSendQueueOptions;
+  BOOST_CHECK_EQUAL(options.capacity, 1048576);
+  BOOST_CHECK_EQUAL(options.isCoDelEnabled, true);
+  BOOST_CHECK_EQUAL(options.target, 10_ms);
+  BOOST_CHECK_EQUAL(options.interval, 200_ms);
+
+  const std::string CONFIG_BAD_INTERVAL = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        send_queue
+        {
+          enable_codel yes
+          codel_target 100
+          codel_interval 100
+        }
+      }
+    }
+  )CONFIG";
+  BOOST_CHECK_THROW(parseConfig(CONFIG_BAD_INTERVAL, true), ConfigFile::Error);
+
+  const std::string CONFIG_UNKNOWN_KEY = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        send_queue
+        {
+          hello world
+        }
+      }
+    }
+  )CONFIG";
+  BOOST_CHECK_THROW(parseConfig(CONFIG_UNKNOWN_KEY, true), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(RateLimit)
+{
+  faceSystem.m_factories["f1"] = make_unique<DummyProtocolFactory>(faceSystem.makePFCtorParams());
+  auto f1 = static_cast<DummyProtocolFactory*>(faceSystem.getFactoryById("f1"));
+
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        rate_limit
+        {
+          byte_rate 125000
+          packet_rate 1000
+          byte_burst 20000
+          packet_burst 10
+          queue_capacity 50000
+        }
+      }
+      f1
+      {
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, false);
+  BOOST_REQUIRE_EQUAL(f1->processConfigHistory.size(), 1);
+  const auto& options = f1->processConfigHistory.back().rateLimitOptions;
+  BOOST_CHECK_EQUAL(options.byteRate, 125000);
+  BOOST_CHECK_EQUAL(options.packetRate, 1000);
+  BOOST_CHECK_EQUAL(options.byteBurst, 20000);
+  BOOST_CHECK_EQUAL(options.packetBurst, 10);
+  BOOST_CHECK_EQUAL(options.queueCapacity, 50000);
+
+  const std::string CONFIG_ZERO_BURST = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        rate_limit
+        {
+          byte_rate 125000
+          byte_burst 0
+        }
+      }
+    }
+  )CONFIG";
+  BOOST_CHECK_THROW(parseConfig(CONFIG_ZERO_BURST, true), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(TrafficClasses)
+{
+  faceSystem.m_factories["f1"] = make_unique<DummyProtocolFactory>(faceSystem.makePFCtorParams());
+  auto f1 = static_cast<DummyProtocolFactory*>(faceSystem.getFactoryById("f1"));
+
+  const std::string CONFIG = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        traffic_classes
+        {
+          quantum 1500
+          max_transport_backlog 10000
+          class
+          {
+            name control
+            priority 0
+            packet_type nack
+            prefix /localhop
+            prefix /localhost
+          }
+          class
+          {
+            name bulk
+            weight 4
+            packet_type interest
+            packet_type data
+          }
+          default
+          {
+            priority 10
+            weight 2
+          }
+        }
+      }
+      f1
+      {
+      }
+    }
+  )CONFIG";
+
+  parseConfig(CONFIG, false);
+  BOOST_REQUIRE_EQUAL(f1->processConfigHistory.size(), 1);
+  const auto& options = f1->processConfigHistory.back().trafficClassOptions;
+  BOOST_CHECK_EQUAL(options.quantum, 1500);
+  BOOST_CHECK_EQUAL(options.maxTransportBacklog, 10000);
+  BOOST_REQUIRE_EQUAL(options.classes.size(), 2);
+  BOOST_CHECK_EQUAL(options.classes[0].name, "control");
+  BOOST_CHECK_EQUAL(options.classes[0].priority, 0);
+  BOOST_CHECK_EQUAL(options.classes[0].weight, 1);
+  BOOST_CHECK_EQUAL(options.classes[0].packetTypes, static_cast<uint8_t>(face::PacketType::NACK));
+  BOOST_CHECK_EQUAL(options.classes[0].prefixes.size(), 2);
+  BOOST_CHECK_EQUAL(options.classes[1].name, "bulk");
+  BOOST_CHECK_EQUAL(options.classes[1].priority, 128);
+  BOOST_CHECK_EQUAL(options.classes[1].weight, 4);
+  BOOST_CHECK_EQUAL(options.classes[1].packetTypes,
+                    static_cast<uint8_t>(face::PacketType::INTEREST) |
+                    static_cast<uint8_t>(face::PacketType::DATA));
+  BOOST_CHECK_EQUAL(options.defaultClass.priority, 10);
+  BOOST_CHECK_EQUAL(options.defaultClass.weight, 2);
+
+  const std::string CONFIG_NO_NAME = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        traffic_classes
+        {
+          class
+          {
+            priority 1
+          }
+        }
+      }
+    }
+  )CONFIG";
+  BOOST_CHECK_THROW(parseConfig(CONFIG_NO_NAME, true), ConfigFile::Error);
+
+  const std::string CONFIG_BAD_TYPE = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        traffic_classes
+        {
+          class
+          {
+            name x
+            packet_type frame
+          }
+        }
+      }
+    }
+  )CONFIG";
+  BOOST_CHECK_THROW(parseConfig(CONFIG_BAD_TYPE, true), ConfigFile::Error);
+
+  const std::string CONFIG_BAD_PRIORITY = R"CONFIG(
+    face_system
+    {
+      general
+      {
+        traffic_classes
+        {
+          class
+          {
+            name x
+            priority 256
+          }
+        }
+      }
+    }
+  )CONFIG";
+  BOOST_CHECK_THROW(parseConfig(CONFIG_BAD_PRIORITY, true), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(OmittedSection)
 {
   faceSystem.m_factories["f1"] = make_unique<DummyProtocolFactory>(faceSystem.makePFCtorParams());
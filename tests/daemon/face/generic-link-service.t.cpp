@@ -901,6 +901,190 @@ BOOST_AUTO_TEST_CASE(DefaultThreshold)
 
 BOOST_AUTO_TEST_SUITE_END() // CongestionMark
 
+BOOST_AUTO_TEST_SUITE(RateLimit)
+
+BOOST_AUTO_TEST_CASE(PacketRate)
+{
+  GenericLinkService::Options options;
+  options.shaperOptions.packetRate = 10;
+  options.shaperOptions.packetBurst = 2;
+  options.shaperOptions.queueCapacity = 1000;
+  initialize(options);
+
+  for (int i = 0; i < 5; ++i) {
+    face->sendInterest(*makeInterest("/test/" + to_string(i)));
+  }
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+
+  advanceClocks(10_ms, 100_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+  advanceClocks(10_ms, 200_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 5);
+
+  // the bucket refills up to its depth
+  advanceClocks(100_ms, 1_s);
+  for (int i = 0; i < 3; ++i) {
+    face->sendInterest(*makeInterest("/test/" + to_string(i)));
+  }
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 7);
+
+  // disabling the rate limit flushes the queue
+  options.shaperOptions.packetRate = 0;
+  service->setOptions(options);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 8);
+}
+
+BOOST_AUTO_TEST_CASE(QueueFull)
+{
+  GenericLinkService::Options options;
+  options.shaperOptions.byteRate = 1000;
+  options.shaperOptions.byteBurst = 1;
+  options.shaperOptions.queueCapacity = 1;
+  initialize(options);
+
+  face->sendInterest(*makeInterest("/test/1"));
+  face->sendInterest(*makeInterest("/test/2"));
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+
+  // the second Interest was dropped rather than queued
+  advanceClocks(10_ms, 1_s);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ShapeBeforeReliability)
+{
+  GenericLinkService::Options options;
+  options.reliabilityOptions.isEnabled = true;
+  options.reliabilityOptions.maxRetx = 0;
+  options.shaperOptions.packetRate = 1;
+  options.shaperOptions.packetBurst = 1;
+  initialize(options);
+
+  std::vector<Name> droppedInterests;
+  service->onDroppedInterest.connect([&] (const Interest& interest) {
+    droppedInterests.push_back(interest.getName());
+  });
+
+  for (int i = 1; i <= 3; ++i) {
+    face->sendInterest(*makeInterest("/test/" + to_string(i)));
+  }
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 1);
+  lp::Packet pkt1(transport->sentPackets.back());
+  BOOST_CHECK(pkt1.has<lp::TxSequenceField>());
+
+  // the retransmission timer of an Interest starts when it is transmitted, not when it is queued:
+  // /test/3 has waited longer than the initial RTO (1 s), but has not been transmitted yet
+  advanceClocks(10_ms, 1500_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+  BOOST_REQUIRE_EQUAL(droppedInterests.size(), 1);
+  BOOST_CHECK_EQUAL(droppedInterests.front(), Name("/test/1"));
+
+  advanceClocks(10_ms, 1_s);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+  lp::Packet pkt3(transport->sentPackets.back());
+  BOOST_CHECK(pkt3.has<lp::TxSequenceField>());
+  BOOST_CHECK_EQUAL(pkt3.get<lp::SequenceField>(), pkt1.get<lp::SequenceField>() + 2);
+}
+
+BOOST_AUTO_TEST_CASE(TransportBacklog)
+{
+  GenericLinkService::Options options;
+  options.schedulerOptions.classes.resize(1);
+  options.schedulerOptions.classes[0].name = "interest";
+  options.schedulerOptions.classes[0].packetTypes = static_cast<uint8_t>(face::PacketType::INTEREST);
+  options.schedulerOptions.maxTransportBacklog = 1000;
+  initialize(options);
+
+  // the transport is flushing its own queue: wait for afterSendQueueDrained without polling
+  transport->setSendQueueLength(2000);
+  transport->setSendQueueDrainPending(true);
+  face->sendInterest(*makeInterest("/test/1"));
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+  transport->setSendQueueLength(0);
+  advanceClocks(1_ms, 10_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+  transport->drainSendQueue();
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+
+  // the backlog is not owned by the transport: the gate is polled
+  transport->setSendQueueLength(2000);
+  face->sendInterest(*makeInterest("/test/2"));
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+  transport->setSendQueueLength(0);
+  advanceClocks(1_ms, 5_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(TransportRetryBackoff)
+{
+  GenericLinkService::Options options;
+  options.schedulerOptions.classes.resize(1);
+  options.schedulerOptions.classes[0].name = "interest";
+  options.schedulerOptions.classes[0].packetTypes = static_cast<uint8_t>(face::PacketType::INTEREST);
+  options.schedulerOptions.maxTransportBacklog = 1000;
+  initialize(options);
+
+  // the gate stays closed: retries at 1, 3, 7, 15, 31, 63, 95 ms, then every 32 ms
+  transport->setSendQueueLength(2000);
+  face->sendInterest(*makeInterest("/test/1"));
+  advanceClocks(1_ms, 100_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+
+  transport->setSendQueueLength(0);
+  advanceClocks(1_ms, 20_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+  advanceClocks(1_ms, 10_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 1);
+
+  // the delay starts over once the transport has accepted a packet
+  transport->setSendQueueLength(2000);
+  face->sendInterest(*makeInterest("/test/2"));
+  transport->setSendQueueLength(0);
+  advanceClocks(1_ms, 1_ms);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(TrafficClasses)
+{
+  GenericLinkService::Options options;
+  options.schedulerOptions.classes.resize(1);
+  options.schedulerOptions.classes[0].name = "urgent";
+  options.schedulerOptions.classes[0].priority = 0;
+  options.schedulerOptions.classes[0].packetTypes = static_cast<uint8_t>(face::PacketType::NACK);
+  options.schedulerOptions.maxTransportBacklog = 1000;
+  initialize(options);
+
+  // packets wait while the transport is busy
+  transport->setSendQueueLength(2000);
+  transport->setSendQueueDrainPending(true);
+  face->sendInterest(*makeInterest("/test/1"));
+  face->sendInterest(*makeInterest("/test/2"));
+  face->sendNack(makeNack(*makeInterest("/test/3", false, std::nullopt, 323),
+                          lp::NackReason::CONGESTION));
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 0);
+
+  // the Nack overtakes the Interest that arrived before it,
+  // except the one that was already selected for transmission
+  transport->drainSendQueue();
+  BOOST_REQUIRE_EQUAL(transport->sentPackets.size(), 3);
+  BOOST_CHECK(!lp::Packet(transport->sentPackets[0]).has<lp::NackField>());
+  BOOST_CHECK(lp::Packet(transport->sentPackets[1]).has<lp::NackField>());
+  BOOST_CHECK(!lp::Packet(transport->sentPackets[2]).has<lp::NackField>());
+  BOOST_CHECK_EQUAL(service->getCounters().nOutInterests, 2);
+  BOOST_CHECK_EQUAL(service->getCounters().nOutNacks, 1);
+
+  // disabling traffic classes flushes the queue
+  transport->setSendQueueLength(2000);
+  transport->setSendQueueDrainPending(true);
+  face->sendInterest(*makeInterest("/test/4"));
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 3);
+  options.schedulerOptions.classes.clear();
+  service->setOptions(options);
+  BOOST_CHECK_EQUAL(transport->sentPackets.size(), 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // RateLimit
+
 BOOST_AUTO_TEST_SUITE(LpFields)
 
 BOOST_AUTO_TEST_CASE(ReceiveNextHopFaceId)
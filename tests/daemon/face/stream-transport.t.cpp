@@ -69,6 +69,34 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Send, T, StreamTransportFixtures, T)
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(SendBatch, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // more packets than fit into one gather-write
+  const size_t nPackets = std::remove_pointer_t<decltype(T::transport)>::MAX_SEND_BATCH * 2 + 10;
+  ndn::Buffer expected;
+  for (size_t i = 0; i < nPackets; ++i) {
+    auto block = ndn::encoding::makeNonNegativeIntegerBlock(300, i);
+    this->transport->send(block);
+    expected.insert(expected.end(), block.begin(), block.end());
+  }
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutPackets, nPackets);
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nOutBytes, expected.size());
+
+  std::vector<uint8_t> readBuf(expected.size());
+  boost::asio::async_read(this->remoteSocket, boost::asio::buffer(readBuf),
+    [this] (const boost::system::error_code& error, size_t) {
+      BOOST_REQUIRE_EQUAL(error, boost::system::errc::success);
+      this->limitedIo.afterOp();
+    });
+
+  BOOST_REQUIRE_EQUAL(this->limitedIo.run(1, 1_s), LimitedIo::EXCEED_OPS);
+
+  BOOST_CHECK_EQUAL_COLLECTIONS(readBuf.begin(), readBuf.end(), expected.begin(), expected.end());
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveNormal, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
@@ -136,6 +164,33 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveMultipleBlocks, T, StreamTransportFixtur
   BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveMultipleChunks, T, StreamTransportFixtures, T)
+{
+  TRANSPORT_TEST_INIT();
+
+  // packets spanning several receive buffer chunks, with boundaries falling inside packets
+  const size_t chunkSize = std::remove_pointer_t<decltype(T::transport)>::RECEIVE_CHUNK_SIZE;
+  std::vector<Block> packets;
+  ndn::Buffer buf;
+  for (size_t i = 0; buf.size() < 3 * chunkSize; ++i) {
+    std::vector<uint8_t> value(4000 + i * 17 % 3000, static_cast<uint8_t>(i));
+    packets.push_back(ndn::encoding::makeBinaryBlock(300, value));
+    buf.insert(buf.end(), packets.back().begin(), packets.back().end());
+  }
+
+  this->remoteWrite(buf);
+
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInPackets, packets.size());
+  BOOST_CHECK_EQUAL(this->transport->getCounters().nInBytes, buf.size());
+  BOOST_CHECK_EQUAL(this->transport->getState(), TransportState::UP);
+
+  // received packets are still intact after the transport has reused or replaced its chunks
+  BOOST_REQUIRE_EQUAL(this->receivedPackets->size(), packets.size());
+  for (size_t i = 0; i < packets.size(); ++i) {
+    BOOST_CHECK(this->receivedPackets->at(i).packet == packets[i]);
+  }
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(ReceiveTooLarge, T, StreamTransportFixtures, T)
 {
   TRANSPORT_TEST_INIT();
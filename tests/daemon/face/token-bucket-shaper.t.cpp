@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "face/token-bucket-shaper.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+
+namespace nfd::tests {
+
+using namespace nfd::face;
+
+BOOST_AUTO_TEST_SUITE(Face)
+BOOST_FIXTURE_TEST_SUITE(TestTokenBucketShaper, GlobalIoTimeFixture)
+
+BOOST_AUTO_TEST_CASE(Disabled)
+{
+  TokenBucketShaper shaper;
+  BOOST_CHECK(!shaper.getOptions().isEnabled());
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK(shaper.canSend(1000));
+    shaper.consume(1000);
+  }
+  BOOST_CHECK_EQUAL(shaper.getDelay(1000), 0_ns);
+}
+
+BOOST_AUTO_TEST_CASE(ByteRate)
+{
+  TokenBucketShaper::Options options;
+  options.byteRate = 10000;
+  options.byteBurst = 2000;
+  TokenBucketShaper shaper(options);
+
+  // burst of two packets
+  for (int i = 0; i < 2; ++i) {
+    BOOST_CHECK(shaper.canSend(1000));
+    shaper.consume(1000);
+  }
+  BOOST_CHECK(!shaper.canSend(1000));
+  BOOST_CHECK_EQUAL(shaper.getDelay(1000), 100_ms);
+
+  // one packet every 100 ms
+  advanceClocks(1_ms, 99_ms);
+  BOOST_CHECK(!shaper.canSend(1000));
+  advanceClocks(1_ms, 1_ms);
+  BOOST_CHECK(shaper.canSend(1000));
+  shaper.consume(1000);
+  BOOST_CHECK(!shaper.canSend(1000));
+
+  // the bucket refills up to its depth
+  advanceClocks(100_ms, 1_s);
+  for (int i = 0; i < 2; ++i) {
+    BOOST_CHECK(shaper.canSend(1000));
+    shaper.consume(1000);
+  }
+  BOOST_CHECK(!shaper.canSend(1000));
+}
+
+BOOST_AUTO_TEST_CASE(PacketRate)
+{
+  TokenBucketShaper::Options options;
+  options.packetRate = 10;
+  options.packetBurst = 2;
+  TokenBucketShaper shaper(options);
+
+  // packet size does not matter
+  for (int i = 0; i < 2; ++i) {
+    BOOST_CHECK(shaper.canSend(8000));
+    shaper.consume(8000);
+  }
+  BOOST_CHECK(!shaper.canSend(100));
+  BOOST_CHECK_EQUAL(shaper.getDelay(100), 100_ms);
+
+  advanceClocks(10_ms, 100_ms);
+  BOOST_CHECK(shaper.canSend(100));
+}
+
+BOOST_AUTO_TEST_CASE(OversizedPacket)
+{
+  TokenBucketShaper::Options options;
+  options.byteRate = 1000;
+  options.byteBurst = 500;
+  TokenBucketShaper shaper(options);
+
+  // a packet larger than the bucket depth may be sent once the bucket is full
+  BOOST_CHECK(shaper.canSend(1500));
+  shaper.consume(1500);
+
+  // the bucket is in debt for 1 s, then needs another 0.5 s to fill up
+  BOOST_CHECK(!shaper.canSend(1500));
+  BOOST_CHECK_EQUAL(shaper.getDelay(1500), 1500_ms);
+  advanceClocks(10_ms, 1400_ms);
+  BOOST_CHECK(!shaper.canSend(1500));
+  advanceClocks(10_ms, 100_ms);
+  BOOST_CHECK(shaper.canSend(1500));
+}
+
+BOOST_AUTO_TEST_CASE(SetOptions)
+{
+  TokenBucketShaper shaper;
+
+  // tokens in excess of the new depth are discarded
+  TokenBucketShaper::Options options;
+  options.byteRate = 1000;
+  options.byteBurst = 1000;
+  shaper.setOptions(options);
+  BOOST_CHECK(shaper.canSend(1000));
+  shaper.consume(1000);
+  BOOST_CHECK(!shaper.canSend(1000));
+  BOOST_CHECK_EQUAL(shaper.getDelay(1000), 1_s);
+
+  // disabling the rate limit lets everything through
+  shaper.setOptions({});
+  BOOST_CHECK(shaper.canSend(1000));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTokenBucketShaper
+BOOST_AUTO_TEST_SUITE_END() // Face
+
+} // namespace nfd::tests
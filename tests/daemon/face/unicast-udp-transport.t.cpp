@@ -64,6 +64,27 @@ BOOST_AUTO_TEST_CASE(PersistencyChange)
   BOOST_CHECK_EQUAL(transport->canChangePersistencyTo(ndn::nfd::FACE_PERSISTENCY_PERMANENT), true);
 }
 
+BOOST_AUTO_TEST_CASE(ReceiveBatch)
+{
+  TRANSPORT_TEST_INIT();
+
+  // more datagrams than processed per receive completion, all queued before the transport runs
+  const size_t nPackets = UnicastUdpTransport::MAX_RECEIVE_BATCH + 8;
+  std::vector<Block> packets;
+  for (size_t i = 0; i < nPackets; ++i) {
+    packets.push_back(ndn::encoding::makeNonNegativeIntegerBlock(300, i));
+    remoteSocket.send(boost::asio::buffer(packets.back()));
+  }
+  limitedIo.defer(1_s);
+
+  BOOST_REQUIRE_EQUAL(receivedPackets->size(), nPackets);
+  for (size_t i = 0; i < nPackets; ++i) {
+    BOOST_CHECK(receivedPackets->at(i).packet == packets[i]);
+  }
+  BOOST_CHECK_EQUAL(transport->getCounters().nInPackets, nPackets);
+  BOOST_CHECK_EQUAL(transport->getState(), TransportState::UP);
+}
+
 BOOST_AUTO_TEST_CASE(ExpirationTime)
 {
   TRANSPORT_TEST_INIT(ndn::nfd::FACE_PERSISTENCY_ON_DEMAND);
@@ -147,6 +147,33 @@ BOOST_AUTO_TEST_CASE(Nonce)
   BOOST_CHECK_EQUAL(findDuplicateNonce(entry5, 19004, *face2), DUPLICATE_NONCE_NONE);
 }
 
+BOOST_AUTO_TEST_CASE(NonceManyInRecords)
+{
+  std::vector<shared_ptr<DummyFace>> faces;
+  for (size_t i = 0; i < pit::Entry::IN_RECORD_INDEX_THRESHOLD + 1; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+  }
+  auto otherFace = make_shared<DummyFace>();
+
+  auto interest = makeInterest("/XpHnDdtz");
+  pit::Entry entry(*interest);
+  for (size_t i = 0; i < faces.size(); ++i) {
+    interest->setNonce(static_cast<uint32_t>(i));
+    entry.insertOrUpdateInRecord(*faces[i], *interest);
+  }
+
+  BOOST_CHECK_EQUAL(findDuplicateNonce(entry, 3, *faces[3]), DUPLICATE_NONCE_IN_SAME);
+  BOOST_CHECK_EQUAL(findDuplicateNonce(entry, 3, *faces[4]), DUPLICATE_NONCE_IN_OTHER);
+  BOOST_CHECK_EQUAL(findDuplicateNonce(entry, 3, *otherFace), DUPLICATE_NONCE_IN_OTHER);
+  BOOST_CHECK_EQUAL(findDuplicateNonce(entry, 9999, *faces[3]), DUPLICATE_NONCE_NONE);
+
+  interest->setNonce(3);
+  entry.insertOrUpdateInRecord(*faces[4], *interest);
+  BOOST_CHECK_EQUAL(findDuplicateNonce(entry, 3, *faces[3]),
+                    DUPLICATE_NONCE_IN_SAME | DUPLICATE_NONCE_IN_OTHER);
+  BOOST_CHECK_EQUAL(findDuplicateNonce(entry, 4, *faces[4]), DUPLICATE_NONCE_NONE);
+}
+
 BOOST_FIXTURE_TEST_CASE(HasPendingOutRecords, GlobalIoTimeFixture)
 {
   auto face1 = make_shared<DummyFace>();
@@ -24,6 +24,7 @@
  */
 
 #include "fw/asf-measurements.hpp"
+#include "table/pit-entry.hpp"
 
 #include "tests/test-common.hpp"
 #include "tests/daemon/global-io-fixture.hpp"
@@ -43,33 +44,44 @@ BOOST_FIXTURE_TEST_CASE(FaceInfo, GlobalIoTimeFixture)
   BOOST_CHECK_EQUAL(info.getSrtt(), FaceInfo::RTT_NO_MEASUREMENT);
 
   info.recordRtt(100_ms);
-  Name interestName("/ndn/interest");
+  auto pitEntry = make_shared<pit::Entry>(*makeInterest("/ndn/interest"));
 
   // Receive Interest and forward to next hop; should update RTO information
   BOOST_CHECK_EQUAL(info.isTimeoutScheduled(), false);
-  auto rto = info.scheduleTimeout(interestName, []{});
+  auto rto = info.scheduleTimeout(*pitEntry, time::steady_clock::now());
   BOOST_CHECK_EQUAL(info.isTimeoutScheduled(), true);
   BOOST_CHECK_EQUAL(rto, 300_ms);
 
   // Receive Data
   time::nanoseconds rtt(5_ms);
   this->advanceClocks(5_ms);
+  BOOST_CHECK_EQUAL(info.isTimeoutExpired(time::steady_clock::now()), false);
   info.recordRtt(rtt);
-  info.cancelTimeout(interestName);
+  info.cancelTimeout(*pitEntry);
+  BOOST_CHECK_EQUAL(info.isTimeoutScheduled(), false);
 
   BOOST_CHECK_EQUAL(info.getLastRtt(), rtt);
   BOOST_CHECK_EQUAL(info.getSrtt(), 88125_us);
 
   // Send out another Interest which times out
-  rto = info.scheduleTimeout(interestName, []{});
+  rto = info.scheduleTimeout(*pitEntry, time::steady_clock::now());
   BOOST_CHECK_EQUAL(rto, 333125_us);
 
+  // Data satisfying a different PIT entry does not cancel the timeout
+  auto otherPitEntry = make_shared<pit::Entry>(*makeInterest("/ndn/other"));
+  info.cancelTimeout(*otherPitEntry);
+  BOOST_CHECK_EQUAL(info.isTimeoutScheduled(), true);
+
+  this->advanceClocks(1_ms, rto);
+  BOOST_CHECK_EQUAL(info.isTimeoutExpired(time::steady_clock::now()), true);
+
   auto previousSrtt = info.getSrtt();
-  info.recordTimeout(interestName);
+  info.recordTimeout();
 
   BOOST_CHECK_EQUAL(info.getLastRtt(), FaceInfo::RTT_TIMEOUT);
   BOOST_CHECK_EQUAL(info.getSrtt(), previousSrtt);
   BOOST_CHECK_EQUAL(info.isTimeoutScheduled(), false);
+  BOOST_CHECK_EQUAL(info.isTimeoutExpired(time::steady_clock::now()), false);
 }
 
 BOOST_FIXTURE_TEST_CASE(NamespaceInfo, GlobalIoTimeFixture)
@@ -82,8 +94,24 @@ BOOST_FIXTURE_TEST_CASE(NamespaceInfo, GlobalIoTimeFixture)
   auto& faceInfo = info.getOrCreateFaceInfo(1234);
   BOOST_CHECK(info.getFaceInfo(1234) == &faceInfo);
 
-  this->advanceClocks(fw::asf::AsfMeasurements::MEASUREMENTS_LIFETIME + 1_s);
+  auto& faceInfo2 = info.getOrCreateFaceInfo(5678);
+  BOOST_CHECK(info.getFaceInfo(5678) == &faceInfo2);
+  BOOST_CHECK(info.getFaceInfo(1234) != nullptr);
+
+  this->advanceClocks(1_min);
+  info.extendFaceInfoLifetime(faceInfo2);
+
+  this->advanceClocks(fw::asf::AsfMeasurements::MEASUREMENTS_LIFETIME - 30_s);
   BOOST_CHECK(info.getFaceInfo(1234) == nullptr); // expired
+  BOOST_CHECK(info.getFaceInfo(5678) != nullptr);
+
+  this->advanceClocks(1_min);
+  BOOST_CHECK(info.getFaceInfo(5678) == nullptr); // expired
+
+  // an expired FaceInfo is replaced with a fresh one
+  info.getOrCreateFaceInfo(5678).recordRtt(10_ms);
+  BOOST_REQUIRE(info.getFaceInfo(5678) != nullptr);
+  BOOST_CHECK_EQUAL(info.getFaceInfo(5678)->getLastRtt(), 10_ms);
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestAsfStrategy
@@ -236,6 +236,41 @@ BOOST_FIXTURE_TEST_CASE(InterestForwarding, AsfStrategyDelayedDataFixture)
   BOOST_CHECK_EQUAL(consumer->getForwarderFace().getCounters().nOutData, 1);
 }
 
+class AsfStrategyLateDataFixture : public AsfGridFixture
+{
+protected:
+  AsfStrategyLateDataFixture()
+    : AsfGridFixture(Name(AsfStrategy::getStrategyName()), 1500_ms)
+  {
+  }
+};
+
+BOOST_FIXTURE_TEST_CASE(LateData, AsfStrategyLateDataFixture)
+{
+  topo.registerPrefix(nodeB, linkBC->getFace(nodeB), PRODUCER_PREFIX);
+  topo.registerPrefix(nodeD, linkCD->getFace(nodeD), PRODUCER_PREFIX);
+
+  // The Interest goes via link AD, and its Data arrives after the initial RTO of 1 second
+  Name name(PRODUCER_PREFIX);
+  name.appendTimestamp();
+  consumer->getClientFace().expressInterest(*makeInterest(name), nullptr, nullptr, nullptr);
+  this->advanceClocks(10_ms, 2500_ms);
+  BOOST_REQUIRE_EQUAL(linkAD->getFace(nodeA).getCounters().nOutInterests, 1);
+  BOOST_REQUIRE_EQUAL(linkAD->getFace(nodeA).getCounters().nInData, 1);
+
+  auto* me = topo.getForwarder(nodeA).getMeasurements().findExactMatch(PRODUCER_PREFIX);
+  BOOST_REQUIRE(me != nullptr);
+  auto* namespaceInfo = me->getStrategyInfo<fw::asf::NamespaceInfo>();
+  BOOST_REQUIRE(namespaceInfo != nullptr);
+  auto* faceInfo = namespaceInfo->getFaceInfo(linkAD->getFace(nodeA).getId());
+  BOOST_REQUIRE(faceInfo != nullptr);
+
+  // The late Data does not cancel the timeout, which is counted, but its RTT is recorded
+  BOOST_CHECK_EQUAL(faceInfo->getNTimeouts(), 1);
+  BOOST_CHECK_GT(faceInfo->getLastRtt(), 1_s);
+  BOOST_CHECK(!faceInfo->isTimeoutScheduled());
+}
+
 BOOST_AUTO_TEST_CASE(Retransmission) // Bug #4874
 {
   // Avoid clearing pit entry for those incoming interest that have pit entry but no next hops
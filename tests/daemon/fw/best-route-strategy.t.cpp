@@ -139,6 +139,58 @@ BOOST_AUTO_TEST_CASE(Forward)
   // face1 cannot be used because it's gone from FIB entry
 }
 
+BOOST_AUTO_TEST_CASE(DecisionCache)
+{
+  fib::Entry* fibEntry = fib.insert(Name()).first;
+  fib.addOrUpdateNextHop(*fibEntry, *face2, 10);
+  fib.addOrUpdateNextHop(*fibEntry, *face3, 20);
+
+  auto receiveNewInterest = [&] (const Name& name, Face& ingress) {
+    auto interest = makeInterest(name);
+    auto pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(ingress, *interest);
+    strategy.afterReceiveInterest(*interest, FaceEndpoint(ingress), pitEntry);
+  };
+
+  receiveNewInterest("/A/1", *face1);
+  receiveNewInterest("/A/2", *face1);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 2);
+  BOOST_TEST(strategy.sendInterestHistory.back().outFaceId == face2->getId());
+  BOOST_TEST(strategy.m_decisions.size() == 1);
+
+  // the decision depends on the ingress face
+  receiveNewInterest("/A/3", *face2);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 3);
+  BOOST_TEST(strategy.sendInterestHistory.back().outFaceId == face3->getId());
+  BOOST_TEST(strategy.m_decisions.size() == 2);
+
+  // scope-controlled names are not cached
+  receiveNewInterest("/localhop/A", *face1);
+  BOOST_TEST(strategy.sendInterestHistory.size() == 3);
+  BOOST_TEST(strategy.sendNackHistory.size() == 1);
+  BOOST_TEST(strategy.m_decisions.size() == 2);
+
+  // a cost change invalidates the cached decision
+  fib.addOrUpdateNextHop(*fibEntry, *face3, 5);
+  receiveNewInterest("/A/4", *face1);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 4);
+  BOOST_TEST(strategy.sendInterestHistory.back().outFaceId == face3->getId());
+
+  // so does a nexthop removal
+  fib.removeNextHop(*fibEntry, *face3);
+  receiveNewInterest("/A/5", *face1);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 5);
+  BOOST_TEST(strategy.sendInterestHistory.back().outFaceId == face2->getId());
+
+  // a FIB entry re-created after being erased is not mistaken for the old one
+  fib.removeNextHop(*fibEntry, *face2);
+  fibEntry = fib.insert(Name()).first;
+  fib.addOrUpdateNextHop(*fibEntry, *face4, 10);
+  receiveNewInterest("/A/6", *face1);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 6);
+  BOOST_TEST(strategy.sendInterestHistory.back().outFaceId == face4->getId());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestBestRouteStrategy
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
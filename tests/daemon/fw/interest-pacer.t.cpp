@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/interest-pacer.hpp"
+#include "fw/asf-strategy.hpp"
+#include "fw/best-route-strategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+
+namespace nfd::tests {
+
+using BestRouteStrategyTester = StrategyTester<fw::BestRouteStrategy>;
+
+class InterestPacerFixture : public GlobalIoTimeFixture
+{
+protected:
+  InterestPacerFixture()
+    : strategy(choose<BestRouteStrategyTester>(forwarder, "/",
+                 Name(BestRouteStrategyTester::getStrategyName()).append("pacing~1")
+                                                               .append("pacing-max-delay~25")))
+    , face1(make_shared<DummyFace>())
+    , face2(make_shared<DummyFace>())
+  {
+    faceTable.add(face1);
+    faceTable.add(face2);
+
+    fib::Entry& fibEntry = *fib.insert(Name()).first;
+    fib.addOrUpdateNextHop(fibEntry, *face2, 10);
+  }
+
+  shared_ptr<pit::Entry>
+  receiveInterest(const Name& name)
+  {
+    auto interest = makeInterest(name);
+    auto pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*face1, *interest);
+    strategy.afterReceiveInterest(*interest, FaceEndpoint(*face1), pitEntry);
+    return pitEntry;
+  }
+
+protected:
+  FaceTable faceTable;
+  Forwarder forwarder{faceTable};
+  BestRouteStrategyTester& strategy;
+  Fib& fib{forwarder.getFib()};
+  Pit& pit{forwarder.getPit()};
+
+  shared_ptr<DummyFace> face1;
+  shared_ptr<DummyFace> face2;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestInterestPacer, InterestPacerFixture)
+
+BOOST_AUTO_TEST_CASE(CongestionMark)
+{
+  BOOST_REQUIRE(strategy.m_pacer != nullptr);
+
+  // not paced before any congestion signal
+  shared_ptr<pit::Entry> pitEntry;
+  for (int i = 0; i < 5; ++i) {
+    this->advanceClocks(10_ms);
+    pitEntry = receiveInterest("/A/" + std::to_string(i));
+  }
+  BOOST_TEST(strategy.sendInterestHistory.size() == 5);
+
+  // pacing starts at the offered rate of one Interest every 10ms, reduced by 1/32
+  auto data = makeData("/A/4");
+  data->setCongestionMark(1);
+  strategy.beforeSatisfyInterest(*data, FaceEndpoint(*face2), pitEntry);
+
+  receiveInterest("/B/0");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 6);
+  receiveInterest("/B/1");
+  receiveInterest("/B/2");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 6);
+  BOOST_TEST(strategy.sendNackHistory.size() == 0);
+
+  // /B/3 would wait more than 25ms
+  receiveInterest("/B/3");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 6);
+  BOOST_REQUIRE_EQUAL(strategy.sendNackHistory.size(), 1);
+  BOOST_TEST(strategy.sendNackHistory.back().header.getReason() == lp::NackReason::CONGESTION);
+  BOOST_TEST(strategy.rejectPendingInterestHistory.size() == 1);
+
+  this->advanceClocks(1_ms, 11);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 7);
+  BOOST_TEST(strategy.sendInterestHistory.back().pitInterest.getName() == "/B/1");
+  this->advanceClocks(1_ms, 10);
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 8);
+  BOOST_TEST(strategy.sendInterestHistory.back().pitInterest.getName() == "/B/2");
+}
+
+BOOST_AUTO_TEST_CASE(CongestionNack)
+{
+  auto pitEntry = receiveInterest("/A/0");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 1);
+
+  auto nack = makeNack(*makeInterest("/A/0"), lp::NackReason::CONGESTION);
+  strategy.afterReceiveNack(nack, FaceEndpoint(*face2), pitEntry);
+
+  receiveInterest("/A/1");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 2);
+  receiveInterest("/A/2");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 2);
+  this->advanceClocks(1_ms);
+  BOOST_TEST(strategy.sendInterestHistory.size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(PendingSendCancelled)
+{
+  auto pitEntry = receiveInterest("/A/0");
+  auto data = makeData("/A/0");
+  data->setCongestionMark(1);
+  strategy.beforeSatisfyInterest(*data, FaceEndpoint(*face2), pitEntry);
+
+  receiveInterest("/A/1");
+  pitEntry = receiveInterest("/A/2");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 2);
+
+  // the delayed Interest is not sent after its PIT entry is gone
+  pit.erase(pitEntry.get());
+  pitEntry.reset();
+  this->advanceClocks(1_ms, 10);
+  BOOST_TEST(strategy.sendInterestHistory.size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(Parameters)
+{
+  const Name bestRoute = fw::BestRouteStrategy::getStrategyName();
+  BOOST_TEST((fw::BestRouteStrategy(forwarder, bestRoute).m_pacer == nullptr));
+  BOOST_TEST((fw::BestRouteStrategy(forwarder, Name(bestRoute).append("pacing~0")).m_pacer == nullptr));
+
+  fw::BestRouteStrategy s1(forwarder, Name(bestRoute).append("pacing~1")
+                                                     .append("pacing-max-delay~50")
+                                                     .append("pacing-ai~2.5"));
+  BOOST_REQUIRE(s1.m_pacer != nullptr);
+  BOOST_TEST(s1.m_pacer->m_maxDelay == 50_ms);
+  BOOST_TEST(s1.m_pacer->m_additiveIncrease == 2.5);
+
+  BOOST_CHECK_THROW(fw::BestRouteStrategy(forwarder, Name(bestRoute).append("pacing~2")),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(fw::BestRouteStrategy(forwarder, Name(bestRoute).append("pacing~1")
+                                                                    .append("pacing-max-delay~0")),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(fw::BestRouteStrategy(forwarder, Name(bestRoute).append("pacing~1")
+                                                                    .append("pacing-ai~-1")),
+                    std::invalid_argument);
+
+  const Name asf = fw::AsfStrategy::getStrategyName();
+  BOOST_TEST((fw::AsfStrategy(forwarder, asf).m_pacer == nullptr));
+  BOOST_TEST((fw::AsfStrategy(forwarder, Name(asf).append("pacing~1")).m_pacer != nullptr));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestInterestPacer
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace nfd::tests
@@ -0,0 +1,250 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/multipath-strategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+
+namespace nfd::tests {
+
+using MultipathStrategyTester = StrategyTester<fw::MultipathStrategy>;
+NFD_REGISTER_STRATEGY(MultipathStrategyTester);
+
+class MultipathStrategyFixture : public GlobalIoTimeFixture
+{
+protected:
+  MultipathStrategyFixture()
+    : strategy(choose<MultipathStrategyTester>(forwarder))
+    , face1(make_shared<DummyFace>())
+    , face2(make_shared<DummyFace>())
+    , face3(make_shared<DummyFace>())
+  {
+    faceTable.add(face1);
+    faceTable.add(face2);
+    faceTable.add(face3);
+  }
+
+  shared_ptr<pit::Entry>
+  receiveInterest(const Name& name)
+  {
+    auto interest = makeInterest(name);
+    auto pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*face1, *interest);
+    strategy.afterReceiveInterest(*interest, FaceEndpoint(*face1), pitEntry);
+    return pitEntry;
+  }
+
+  size_t
+  countSentTo(const Face& face) const
+  {
+    return std::count_if(strategy.sendInterestHistory.begin(), strategy.sendInterestHistory.end(),
+                         [&] (const auto& args) { return args.outFaceId == face.getId(); });
+  }
+
+  const fw::MultipathStrategy::Window*
+  getWindow(const Face& face)
+  {
+    auto mi = forwarder.getMeasurements().get(Name()).getStrategyInfo<fw::MultipathStrategy::MtInfo>();
+    if (mi == nullptr) {
+      return nullptr;
+    }
+    for (const auto& [faceId, w] : mi->windows) {
+      if (faceId == face.getId()) {
+        return w.get();
+      }
+    }
+    return nullptr;
+  }
+
+protected:
+  FaceTable faceTable;
+  Forwarder forwarder{faceTable};
+  MultipathStrategyTester& strategy;
+  Fib& fib{forwarder.getFib()};
+  Pit& pit{forwarder.getPit()};
+
+  shared_ptr<DummyFace> face1;
+  shared_ptr<DummyFace> face2;
+  shared_ptr<DummyFace> face3;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestMultipathStrategy, MultipathStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(NoNextHop)
+{
+  fib::Entry& fibEntry = *fib.insert(Name()).first;
+  fib.addOrUpdateNextHop(fibEntry, *face1, 10);
+
+  receiveInterest("/A");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 0);
+  BOOST_REQUIRE_EQUAL(strategy.sendNackHistory.size(), 1);
+  BOOST_TEST(strategy.sendNackHistory.back().header.getReason() == lp::NackReason::NO_ROUTE);
+  BOOST_TEST(strategy.rejectPendingInterestHistory.size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(SplitByFreeWindow)
+{
+  fib::Entry& fibEntry = *fib.insert(Name()).first;
+  fib.addOrUpdateNextHop(fibEntry, *face2, 10);
+  fib.addOrUpdateNextHop(fibEntry, *face3, 100);
+
+  // both windows start at 4; neither nexthop is used beyond its window while the other has room
+  for (int i = 0; i < 8; ++i) {
+    receiveInterest("/A/" + std::to_string(i));
+  }
+  BOOST_TEST(countSentTo(*face2) == 4);
+  BOOST_TEST(countSentTo(*face3) == 4);
+  BOOST_TEST(getWindow(*face2)->nInFlight == 4);
+  BOOST_TEST(getWindow(*face3)->nInFlight == 4);
+
+  // when all windows are full, the least loaded nexthop is used
+  receiveInterest("/A/8");
+  receiveInterest("/A/9");
+  BOOST_TEST(countSentTo(*face2) == 5);
+  BOOST_TEST(countSentTo(*face3) == 5);
+}
+
+BOOST_AUTO_TEST_CASE(NackShrinksWindow)
+{
+  fib::Entry& fibEntry = *fib.insert(Name()).first;
+  fib.addOrUpdateNextHop(fibEntry, *face2, 10);
+  fib.addOrUpdateNextHop(fibEntry, *face3, 10);
+
+  auto pitEntry = receiveInterest("/A/0");
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  FaceId nackedId = strategy.sendInterestHistory.back().outFaceId;
+  Face& nacked = nackedId == face2->getId() ? *face2 : *face3;
+  Face& other = nackedId == face2->getId() ? *face3 : *face2;
+
+  auto nack = makeNack(*makeInterest("/A/0"), lp::NackReason::CONGESTION);
+  strategy.afterReceiveNack(nack, FaceEndpoint(nacked), pitEntry);
+  BOOST_TEST(getWindow(nacked)->cwnd == 2.0);
+  BOOST_TEST(getWindow(nacked)->nInFlight == 0);
+
+  // a second Nack for the same out-record has no effect
+  strategy.afterReceiveNack(nack, FaceEndpoint(nacked), pitEntry);
+  BOOST_TEST(getWindow(nacked)->cwnd == 2.0);
+
+  strategy.sendInterestHistory.clear();
+  for (int i = 1; i <= 6; ++i) {
+    receiveInterest("/A/" + std::to_string(i));
+  }
+  BOOST_TEST(countSentTo(nacked) == 2);
+  BOOST_TEST(countSentTo(other) == 4);
+}
+
+BOOST_AUTO_TEST_CASE(DataAndCongestionMark)
+{
+  fib::Entry& fibEntry = *fib.insert(Name()).first;
+  fib.addOrUpdateNextHop(fibEntry, *face2, 10);
+
+  std::vector<shared_ptr<pit::Entry>> pitEntries;
+  for (int i = 0; i < 4; ++i) {
+    pitEntries.push_back(receiveInterest("/A/" + std::to_string(i)));
+  }
+  BOOST_TEST(getWindow(*face2)->nInFlight == 4);
+
+  this->advanceClocks(10_ms);
+
+  // unmarked Data grows the window additively
+  auto data = makeData("/A/0");
+  strategy.beforeSatisfyInterest(*data, FaceEndpoint(*face2), pitEntries[0]);
+  BOOST_TEST(getWindow(*face2)->nInFlight == 3);
+  BOOST_TEST(getWindow(*face2)->cwnd == 4.25);
+  BOOST_TEST(getWindow(*face2)->srtt == 10_ms);
+
+  // marked Data shrinks the window multiplicatively
+  data = makeData("/A/1");
+  data->setCongestionMark(1);
+  strategy.beforeSatisfyInterest(*data, FaceEndpoint(*face2), pitEntries[1]);
+  BOOST_TEST(getWindow(*face2)->nInFlight == 2);
+  BOOST_TEST(getWindow(*face2)->cwnd == 2.125);
+
+  // at most one decrease per RTT
+  data = makeData("/A/2");
+  data->setCongestionMark(1);
+  strategy.beforeSatisfyInterest(*data, FaceEndpoint(*face2), pitEntries[2]);
+  BOOST_TEST(getWindow(*face2)->nInFlight == 1);
+  BOOST_TEST(getWindow(*face2)->cwnd == 2.125);
+
+  // RTT samples: 10ms, 10ms, 10ms, 30ms => srtt is 12.5ms
+  this->advanceClocks(20_ms);
+  data = makeData("/A/3");
+  data->setCongestionMark(1);
+  strategy.beforeSatisfyInterest(*data, FaceEndpoint(*face2), pitEntries[3]);
+  BOOST_TEST(getWindow(*face2)->nInFlight == 0);
+  BOOST_TEST(getWindow(*face2)->srtt == 12500_us);
+  BOOST_TEST(getWindow(*face2)->cwnd == 1.0625);
+}
+
+BOOST_AUTO_TEST_CASE(UnansweredInterest)
+{
+  fib::Entry& fibEntry = *fib.insert(Name()).first;
+  fib.addOrUpdateNextHop(fibEntry, *face2, 10);
+
+  auto pitEntry = receiveInterest("/A/0");
+  BOOST_TEST(getWindow(*face2)->nInFlight == 1);
+
+  // the PIT entry goes away without an answer
+  pit.erase(pitEntry.get());
+  pitEntry.reset();
+  BOOST_TEST(getWindow(*face2)->nInFlight == 0);
+  BOOST_TEST(getWindow(*face2)->hasPendingLoss);
+  BOOST_TEST(getWindow(*face2)->cwnd == 4.0);
+
+  // the loss is applied when the window is next used
+  receiveInterest("/A/1");
+  BOOST_TEST(!getWindow(*face2)->hasPendingLoss);
+  BOOST_TEST(getWindow(*face2)->cwnd == 2.0);
+  BOOST_TEST(getWindow(*face2)->nInFlight == 1);
+}
+
+BOOST_AUTO_TEST_CASE(Parameters)
+{
+  using fw::MultipathStrategy;
+  const Name prefix = MultipathStrategy::getStrategyName();
+
+  MultipathStrategy s1(forwarder, Name(prefix).append("initial-window~10").append("ai~2").append("md~0.8"));
+  BOOST_TEST(s1.m_initialWindow == 10.0);
+  BOOST_TEST(s1.m_ai == 2.0);
+  BOOST_TEST(s1.m_md == 0.8);
+
+  BOOST_CHECK_THROW(MultipathStrategy(forwarder, Name(prefix).append("initial-window~0")),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(MultipathStrategy(forwarder, Name(prefix).append("ai~0")), std::invalid_argument);
+  BOOST_CHECK_THROW(MultipathStrategy(forwarder, Name(prefix).append("ai~foo")), std::invalid_argument);
+  BOOST_CHECK_THROW(MultipathStrategy(forwarder, Name(prefix).append("md~1")), std::invalid_argument);
+  BOOST_CHECK_THROW(MultipathStrategy(forwarder, Name(prefix).append("md~-0.5")), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestMultipathStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace nfd::tests
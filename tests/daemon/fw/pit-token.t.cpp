@@ -23,6 +23,8 @@
  * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "fw/multicast-strategy.hpp"
+
 #include "tests/daemon/global-io-fixture.hpp"
 #include "topology-tester.hpp"
 
@@ -82,6 +84,31 @@ BOOST_FIXTURE_TEST_CASE(Downstream, GlobalIoTimeFixture)
   BOOST_CHECK(tokenD1 == tokenI1);
 }
 
+// PIT token is stripped from an Interest sent to multiple upstreams.
+BOOST_FIXTURE_TEST_CASE(DownstreamMulticast, GlobalIoTimeFixture)
+{
+  TopologyTester topo;
+  TopologyNode nodeR = topo.addForwarder("R");
+  topo.setStrategy<fw::MulticastStrategy>(nodeR, "/U");
+  auto linkC = topo.addBareLink("C", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  auto linkS1 = topo.addBareLink("S1", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  auto linkS2 = topo.addBareLink("S2", nodeR, ndn::nfd::FACE_SCOPE_NON_LOCAL);
+  topo.registerPrefix(nodeR, linkS1->getForwarderFace(), "/U", 5);
+  topo.registerPrefix(nodeR, linkS2->getForwarderFace(), "/U", 5);
+
+  // C sends Interest /U/0 with PIT token A
+  lp::Packet lppI0("641A pit-token=6206A0A1A2A3A4A5 payload=5010 interest=050E 0706080155080130 0A0400000001"_block);
+  linkC->receivePacket(lppI0.wireEncode());
+  advanceClocks(5_ms, 30_ms);
+
+  // S1 and S2 should receive Interest without PIT token
+  for (const auto& linkS : {linkS1, linkS2}) {
+    BOOST_REQUIRE_EQUAL(linkS->sentPackets.size(), 1);
+    lp::Packet lppS(linkS->sentPackets.back());
+    BOOST_CHECK_EQUAL(lppS.count<lp::PitTokenField>(), 0);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestPitToken
 BOOST_AUTO_TEST_SUITE_END() // Fw
 
@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fw/self-learning-strategy.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
+#include "choose-strategy.hpp"
+#include "strategy-tester.hpp"
+
+namespace nfd::tests {
+
+using SelfLearningStrategyTester = StrategyTester<fw::SelfLearningStrategy>;
+NFD_REGISTER_STRATEGY(SelfLearningStrategyTester);
+
+class SelfLearningStrategyFixture : public GlobalIoTimeFixture
+{
+protected:
+  SelfLearningStrategyFixture()
+    : strategy(choose<SelfLearningStrategyTester>(forwarder, "/",
+                 Name(SelfLearningStrategyTester::getStrategyName()).append("flood-interval~100")))
+    , face1(make_shared<DummyFace>())
+    , face2(make_shared<DummyFace>())
+  {
+    faceTable.add(face1);
+    faceTable.add(face2);
+  }
+
+  void
+  receiveDiscoveryInterest(const Name& name)
+  {
+    auto interest = makeInterest(name);
+    auto pitEntry = pit.insert(*interest).first;
+    pitEntry->insertOrUpdateInRecord(*face1, *interest);
+    strategy.afterReceiveInterest(*interest, FaceEndpoint(*face1), pitEntry);
+  }
+
+protected:
+  FaceTable faceTable;
+  Forwarder forwarder{faceTable};
+  SelfLearningStrategyTester& strategy;
+  Pit& pit{forwarder.getPit()};
+
+  shared_ptr<DummyFace> face1;
+  shared_ptr<DummyFace> face2;
+};
+
+BOOST_AUTO_TEST_SUITE(Fw)
+BOOST_FIXTURE_TEST_SUITE(TestSelfLearningStrategy, SelfLearningStrategyFixture)
+
+BOOST_AUTO_TEST_CASE(FloodRateLimit)
+{
+  BOOST_TEST(strategy.m_floodInterval == 100_ms);
+
+  receiveDiscoveryInterest("/A/1");
+  BOOST_REQUIRE_EQUAL(strategy.sendInterestHistory.size(), 1);
+  BOOST_TEST(strategy.sendInterestHistory.back().outFaceId == face2->getId());
+
+  // same prefix within flood-interval
+  receiveDiscoveryInterest("/A/2");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 1);
+
+  // different prefix
+  receiveDiscoveryInterest("/B/1");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 2);
+
+  this->advanceClocks(10_ms, 100_ms);
+  receiveDiscoveryInterest("/A/3");
+  BOOST_TEST(strategy.sendInterestHistory.size() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(Parameters)
+{
+  const Name selfLearning = fw::SelfLearningStrategy::getStrategyName();
+  BOOST_TEST(fw::SelfLearningStrategy(forwarder, selfLearning).m_floodInterval == 0_ms);
+  BOOST_CHECK_THROW(fw::SelfLearningStrategy(forwarder, Name(selfLearning).append("flood-interval~-1")),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(CoalesceRouteUpdates)
+{
+  ndn::PrefixAnnouncement pa;
+  pa.setAnnouncedName("/A");
+
+  strategy.enqueueRouteUpdate({"/A", face1->getId(), pa, 1_h});
+  strategy.enqueueRouteUpdate({"/A", face2->getId(), std::nullopt, 10_min});
+  strategy.enqueueRouteUpdate({"/A", face1->getId(), std::nullopt, 2_h});
+  strategy.enqueueRouteUpdate({"/A", face2->getId(), std::nullopt, 0_ms});
+  BOOST_REQUIRE_EQUAL(strategy.m_pendingRouteUpdates.size(), 2);
+
+  // the renewal keeps the queued PrefixAnnouncement and extends its lifetime
+  const auto& update1 = strategy.m_pendingRouteUpdates.at({"/A", face1->getId()});
+  BOOST_REQUIRE(update1.announcement.has_value());
+  BOOST_TEST(update1.announcement->getAnnouncedName() == "/A");
+  BOOST_TEST(update1.lifetime == 2_h);
+
+  // a shorter lifetime does not shorten a queued update
+  const auto& update2 = strategy.m_pendingRouteUpdates.at({"/A", face2->getId()});
+  BOOST_TEST(!update2.announcement.has_value());
+  BOOST_TEST(update2.lifetime == 10_min);
+
+  // the RIB service does not exist in this test, so don't dispatch
+  strategy.m_pendingRouteUpdates.clear();
+  this->advanceClocks(1_ms);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSelfLearningStrategy
+BOOST_AUTO_TEST_SUITE_END() // Fw
+
+} // namespace nfd::tests
@@ -33,6 +33,7 @@
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy.hpp"
 #include "fw/multicast-strategy.hpp"
+#include "fw/multipath-strategy.hpp"
 #include "fw/random-strategy.hpp"
 
 #include "tests/daemon/global-io-fixture.hpp"
@@ -93,6 +94,7 @@ using Strategies = boost::mpl::vector<
   AsfStrategy,
   BestRouteStrategy,
   MulticastStrategy,
+  MultipathStrategy,
   RandomStrategy
 >;
 
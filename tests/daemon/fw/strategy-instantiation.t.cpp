@@ -32,6 +32,7 @@
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy.hpp"
 #include "fw/multicast-strategy.hpp"
+#include "fw/multipath-strategy.hpp"
 #include "fw/self-learning-strategy.hpp"
 #include "fw/random-strategy.hpp"
 
@@ -76,7 +77,8 @@ using Tests = boost::mpl::vector<
   Test<AsfStrategy, true, 4>,
   Test<BestRouteStrategy, true, 5>,
   Test<MulticastStrategy, true, 4>,
-  Test<SelfLearningStrategy, false, 1>,
+  Test<MultipathStrategy, true, 1>,
+  Test<SelfLearningStrategy, true, 1>,
   Test<RandomStrategy, false, 1>
 >;
 
@@ -149,7 +151,8 @@ private:
 using StrategiesWithRetxSuppressionExponential = boost::mpl::vector<
   AsfStrategy,
   BestRouteStrategy,
-  MulticastStrategy
+  MulticastStrategy,
+  MultipathStrategy
 >;
 
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(SuppressionParameters, S, StrategiesWithRetxSuppressionExponential,
@@ -29,6 +29,7 @@
 
 // Strategies implementing recommended Nack processing procedure, sorted alphabetically.
 #include "fw/best-route-strategy.hpp"
+#include "fw/multipath-strategy.hpp"
 #include "fw/random-strategy.hpp"
 
 #include "strategy-tester.hpp"
@@ -85,6 +86,7 @@ BOOST_AUTO_TEST_SUITE(TestStrategyNackReturn)
 
 using Strategies = boost::mpl::vector<
   BestRouteStrategy,
+  MultipathStrategy,
   RandomStrategy
 >;
 
@@ -32,6 +32,7 @@
 // sorted alphabetically.
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy.hpp"
+#include "fw/multipath-strategy.hpp"
 #include "fw/random-strategy.hpp"
 
 #include "tests/test-common.hpp"
@@ -149,6 +150,10 @@ using Tests = boost::mpl::vector<
   Test<BestRouteStrategy, NextHopIsDownstream<BestRouteStrategy>>,
   Test<BestRouteStrategy, NextHopViolatesScope<BestRouteStrategy>>,
 
+  Test<MultipathStrategy, EmptyNextHopList<MultipathStrategy>>,
+  Test<MultipathStrategy, NextHopIsDownstream<MultipathStrategy>>,
+  Test<MultipathStrategy, NextHopViolatesScope<MultipathStrategy>>,
+
   Test<RandomStrategy, EmptyNextHopList<RandomStrategy>>,
   Test<RandomStrategy, NextHopIsDownstream<RandomStrategy>>,
   Test<RandomStrategy, NextHopViolatesScope<RandomStrategy>>
@@ -32,6 +32,7 @@
 #include "fw/asf-strategy.hpp"
 #include "fw/best-route-strategy.hpp"
 #include "fw/multicast-strategy.hpp"
+#include "fw/multipath-strategy.hpp"
 #include "fw/random-strategy.hpp"
 
 #include "tests/test-common.hpp"
@@ -114,6 +115,7 @@ using Tests = boost::mpl::vector<
   Test<AsfStrategy, true, false, true>,
   Test<BestRouteStrategy, true, true, true>,
   Test<MulticastStrategy, false, false, false>,
+  Test<MultipathStrategy, true, true, true>,
   Test<RandomStrategy, true, true, true>
 >;
 
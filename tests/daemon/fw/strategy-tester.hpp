@@ -109,6 +109,17 @@ protected:
     return &*it;
   }
 
+  std::vector<pit::OutRecord*>
+  sendInterestToAll(const Interest& interest, const std::vector<Face*>& egresses,
+                    const shared_ptr<pit::Entry>& pitEntry) override
+  {
+    std::vector<pit::OutRecord*> outRecords;
+    for (Face* egress : egresses) {
+      outRecords.push_back(sendInterest(interest, *egress, pitEntry));
+    }
+    return outRecords;
+  }
+
   void
   rejectPendingInterest(const shared_ptr<pit::Entry>& pitEntry) override
   {
@@ -267,6 +267,81 @@ protected:
   const Name id1{"/localhost/CommandAuthenticator/1"};
 };
 
+BOOST_FIXTURE_TEST_CASE(KeyCache, IdentityAuthorizedFixture)
+{
+  const auto& counters = authenticator->getKeyCacheCounters();
+  BOOST_CHECK(authenticator->getKeyCacheLifetime() == CommandAuthenticator::DEFAULT_KEY_CACHE_LIFETIME);
+
+  BOOST_CHECK_EQUAL(authorize1_V03(nullptr), true);
+  BOOST_CHECK_EQUAL(counters.nMisses, 1);
+  BOOST_CHECK_EQUAL(counters.nHits, 0);
+
+  BOOST_CHECK_EQUAL(authorize1_V03(nullptr), true);
+  BOOST_CHECK_EQUAL(authorize1_V02(nullptr), true);
+  BOOST_CHECK(id1.isPrefixOf(lastRequester));
+  BOOST_CHECK_EQUAL(counters.nMisses, 1);
+  BOOST_CHECK_EQUAL(counters.nHits, 2);
+
+  // signature is still verified when the key is cached
+  BOOST_CHECK_EQUAL(authorize1_V03(
+    [] (Interest& interest) {
+      interest.setSignatureValue({0xBA, 0xAD});
+    }
+  ), false);
+  BOOST_CHECK(lastRejectReply == ndn::mgmt::RejectReply::STATUS403);
+  BOOST_CHECK_EQUAL(counters.nHits, 3);
+
+  // timestamp is still checked when the key is cached
+  time::system_clock::time_point tp;
+  BOOST_CHECK_EQUAL(authorize1_V03(
+    [&tp] (const Interest& interest) {
+      tp = interest.getSignatureInfo().value().getTime().value();
+    }
+  ), true);
+  BOOST_CHECK_EQUAL(authorize1_V03(
+    [&tp] (Interest& interest) {
+      auto sigInfo = interest.getSignatureInfo().value();
+      sigInfo.setTime(tp);
+      interest.setSignatureInfo(sigInfo);
+    }
+  ), false);
+  BOOST_CHECK(lastRejectReply == ndn::mgmt::RejectReply::STATUS403);
+
+  // cached key expires
+  advanceClocks(1_s, 61);
+  BOOST_CHECK_EQUAL(authorize1_V03(nullptr), true);
+  BOOST_CHECK_EQUAL(counters.nMisses, 2);
+}
+
+BOOST_AUTO_TEST_CASE(KeyCacheDisabled)
+{
+  Name id1("/localhost/CommandAuthenticator/1");
+  BOOST_REQUIRE(saveIdentityCert(id1, "1.ndncert", true));
+
+  makeModules({"module1"});
+  const std::string config = R"CONFIG(
+    authorizations
+    {
+      key_cache_lifetime 0
+      authorize
+      {
+        certfile "1.ndncert"
+        privileges
+        {
+          module1
+        }
+      }
+    }
+  )CONFIG";
+  loadConfig(config);
+  BOOST_CHECK(authenticator->getKeyCacheLifetime() == 0_ns);
+
+  BOOST_CHECK_EQUAL(authorize("module1", id1), true);
+  BOOST_CHECK_EQUAL(authorize("module1", id1), true);
+  BOOST_CHECK_EQUAL(authenticator->getKeyCacheCounters().nHits, 0);
+  BOOST_CHECK_EQUAL(authenticator->getKeyCacheCounters().nMisses, 0);
+}
+
 BOOST_FIXTURE_TEST_SUITE(Reject, IdentityAuthorizedFixture)
 
 BOOST_AUTO_TEST_CASE(NameTooShort)
@@ -459,6 +534,25 @@ BOOST_AUTO_TEST_CASE(UnrecognizedKey)
   BOOST_CHECK_THROW(loadConfig(config), ConfigFile::Error);
 }
 
+BOOST_AUTO_TEST_CASE(BadKeyCacheLifetime)
+{
+  const std::string config = R"CONFIG(
+    authorizations
+    {
+      key_cache_lifetime -1
+      authorize
+      {
+        certfile any
+        privileges
+        {
+        }
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(loadConfig(config), ConfigFile::Error);
+}
+
 BOOST_AUTO_TEST_CASE(CertfileMissing)
 {
   const std::string config = R"CONFIG(
@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mgmt/dataset-change-log.hpp"
+
+#include "tests/test-common.hpp"
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(Mgmt)
+BOOST_AUTO_TEST_SUITE(TestDatasetChangeLog)
+
+BOOST_AUTO_TEST_CASE(Record)
+{
+  DatasetChangeLog log;
+  uint64_t v0 = log.getVersion();
+  BOOST_CHECK_NE(v0, 0);
+  BOOST_CHECK_EQUAL(log.size(), 0);
+  BOOST_TEST(log.getChangesSince(v0).value().empty());
+
+  log.record("/A");
+  log.record("/B");
+  uint64_t v2 = log.getVersion();
+  BOOST_CHECK_EQUAL(v2, v0 + 2);
+  log.record("/A");
+  BOOST_CHECK_EQUAL(log.size(), 2);
+
+  std::vector<Name> expected{"/B", "/A"};
+  BOOST_TEST(log.getChangesSince(v0).value() == expected, boost::test_tools::per_element());
+  expected = {"/A"};
+  BOOST_TEST(log.getChangesSince(v2).value() == expected, boost::test_tools::per_element());
+  BOOST_TEST(log.getChangesSince(log.getVersion()).value().empty());
+
+  BOOST_CHECK(!log.getChangesSince(v0 - 1));
+  BOOST_CHECK(!log.getChangesSince(log.getVersion() + 1));
+}
+
+BOOST_AUTO_TEST_CASE(Capacity)
+{
+  DatasetChangeLog log(2);
+  uint64_t v0 = log.getVersion();
+
+  log.record("/A");
+  log.record("/B");
+  log.record("/C");
+  BOOST_CHECK_EQUAL(log.size(), 2);
+
+  // the change of /A at v0 + 1 has been dropped
+  BOOST_CHECK(!log.getChangesSince(v0));
+  std::vector<Name> expected{"/B", "/C"};
+  BOOST_TEST(log.getChangesSince(v0 + 1).value() == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDatasetChangeLog
+BOOST_AUTO_TEST_SUITE_END() // Mgmt
+
+} // namespace nfd::tests
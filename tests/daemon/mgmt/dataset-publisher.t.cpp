@@ -0,0 +1,222 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mgmt/dataset-publisher.hpp"
+#include "common/global.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/key-chain-fixture.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "tests/daemon/rib-io-fixture.hpp"
+
+#include <ndn-cxx/mgmt/nfd/control-command.hpp>
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+#include <future>
+
+namespace nfd::tests {
+
+class DatasetPublisherFixture : public GlobalIoTimeFixture, public KeyChainFixture
+{
+protected:
+  DatasetPublisherFixture()
+  {
+    setMainIoService(&g_io);
+  }
+
+  ~DatasetPublisherFixture() override
+  {
+    setMainIoService(nullptr);
+  }
+
+  SnapshotDataset
+  makeDataset(const PartialName& relPrefix)
+  {
+    return {relPrefix, [this] (const Name&, const Interest&) -> DatasetEncoder {
+      ++nSnapshots;
+      return [content = makeStringBlock(tlv::Content, "snapshot")] (auto& context) {
+        context.append(content);
+        context.end();
+      };
+    }};
+  }
+
+protected:
+  ndn::util::DummyClientFace face{g_io, m_keyChain, {true, true}};
+  ndn::nfd::Controller controller{face, m_keyChain};
+  int nSnapshots = 0;
+};
+
+class RibThreadDatasetPublisherFixture : public RibIoFixture, public KeyChainFixture
+{
+protected:
+  RibThreadDatasetPublisherFixture()
+  {
+    runOnRibIoService([this] {
+      face = make_unique<ndn::util::DummyClientFace>(getGlobalIoService(), m_keyChain);
+      controller = make_unique<ndn::nfd::Controller>(*face, m_keyChain);
+    });
+    poll();
+  }
+
+  ~RibThreadDatasetPublisherFixture() override
+  {
+    runOnRibIoService([this] {
+      publisher.reset();
+      controller.reset();
+      face.reset();
+    });
+    poll();
+  }
+
+protected:
+  // owned by the RIB thread
+  unique_ptr<ndn::util::DummyClientFace> face;
+  unique_ptr<ndn::nfd::Controller> controller;
+  unique_ptr<DatasetPublisher> publisher;
+};
+
+BOOST_AUTO_TEST_SUITE(Mgmt)
+BOOST_FIXTURE_TEST_SUITE(TestDatasetPublisher, DatasetPublisherFixture)
+
+BOOST_AUTO_TEST_CASE(AddRoutes)
+{
+  DatasetPublisher publisher(face, m_keyChain, controller,
+                             {makeDataset("fib/list"), makeDataset("faces/list")});
+  advanceClocks(1_ms);
+
+  std::set<Name> routes;
+  for (const auto& interest : face.sentInterests) {
+    ndn::nfd::FibAddNextHopCommand command;
+    BOOST_REQUIRE(command.getPrefix().isPrefixOf(interest.getName()));
+    ndn::nfd::ControlParameters params(interest.getName().at(command.getPrefix().size()).blockFromValue());
+    BOOST_CHECK_EQUAL(params.getFaceId(), 0);
+    routes.insert(params.getName());
+  }
+  std::set<Name> expected{"/localhost/nfd/fib/list", "/localhost/nfd/faces/list"};
+  BOOST_TEST(routes == expected, boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(nSnapshots, 0);
+}
+
+BOOST_AUTO_TEST_CASE(Serve)
+{
+  DatasetPublisher publisher(face, m_keyChain, controller, {makeDataset("fib/list")});
+  advanceClocks(1_ms);
+
+  face.receive(*makeInterest("/localhost/nfd/fib/list", true));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nSnapshots, 1);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 1);
+  BOOST_CHECK(face.sentData[0].getName().getPrefix(3) == "/localhost/nfd/fib/list");
+  BOOST_CHECK_EQUAL(readString(face.sentData[0].getContent().blockFromValue()), "snapshot");
+
+  face.receive(*makeInterest("/localhost/nfd/faces/list", true));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(nSnapshots, 1);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(ServeFromRibThread, RibThreadDatasetPublisherFixture)
+{
+  std::promise<void> hasReceiveReturned;
+  std::thread::id snapshotThread;
+  bool isRibThreadFree = false;
+
+  // a response longer than one segment
+  const std::string payload(ndn::MAX_NDN_PACKET_SIZE, 'x');
+  SnapshotDataset dataset{"fib/list", [&] (const Name&, const Interest&) -> DatasetEncoder {
+    snapshotThread = std::this_thread::get_id();
+    // the RIB thread must not wait for the snapshot
+    isRibThreadFree = hasReceiveReturned.get_future().wait_for(std::chrono::seconds(1)) ==
+                      std::future_status::ready;
+    return [content = makeStringBlock(tlv::Content, payload)] (auto& context) {
+      context.append(content);
+      context.end();
+    };
+  }};
+
+  runOnRibIoService([&] {
+    publisher = make_unique<DatasetPublisher>(*face, m_keyChain, *controller,
+                                              std::vector<SnapshotDataset>{dataset});
+    face->receive(*makeInterest("/localhost/nfd/fib/list", true));
+    hasReceiveReturned.set_value();
+  });
+  // receive the Interest, take the snapshot, and publish the response
+  for (int i = 0; i < 3; ++i) {
+    poll();
+  }
+  BOOST_CHECK(snapshotThread == std::this_thread::get_id());
+  BOOST_CHECK(isRibThreadFree);
+
+  std::vector<Data> sentData;
+  runOnRibIoService([&] { sentData = face->sentData; });
+  poll();
+  BOOST_REQUIRE_EQUAL(sentData.size(), 1);
+
+  // the next segment is served from the stored response
+  runOnRibIoService([&, name = sentData[0].getName().getPrefix(-1).appendSegment(1)] {
+    face->receive(*makeInterest(name));
+    sentData = face->sentData;
+  });
+  poll();
+
+  BOOST_REQUIRE_EQUAL(sentData.size(), 2);
+  BOOST_CHECK_EQUAL(sentData[0].getName().at(-1).toSegment(), 0);
+  BOOST_CHECK_EQUAL(sentData[1].getName().at(-1).toSegment(), 1);
+  BOOST_CHECK(sentData[1].getFinalBlock() == sentData[1].getName().at(-1));
+}
+
+BOOST_FIXTURE_TEST_CASE(DestroyedBeforeSnapshot, RibThreadDatasetPublisherFixture)
+{
+  int nEncoded = 0;
+  SnapshotDataset dataset{"fib/list", [&] (const Name&, const Interest&) -> DatasetEncoder {
+    return [&] (auto& context) {
+      ++nEncoded;
+      context.end();
+    };
+  }};
+
+  runOnRibIoService([&] {
+    publisher = make_unique<DatasetPublisher>(*face, m_keyChain, *controller,
+                                              std::vector<SnapshotDataset>{dataset});
+    face->receive(*makeInterest("/localhost/nfd/fib/list", true));
+    // the publisher is gone before the main thread takes the snapshot
+    publisher.reset();
+  });
+  for (int i = 0; i < 3; ++i) {
+    poll();
+  }
+
+  size_t nSentData = 0;
+  runOnRibIoService([&] { nSentData = face->sentData.size(); });
+  poll();
+  BOOST_CHECK_EQUAL(nEncoded, 0);
+  BOOST_CHECK_EQUAL(nSentData, 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestDatasetPublisher
+BOOST_AUTO_TEST_SUITE_END() // Mgmt
+
+} // namespace nfd::tests
@@ -103,7 +103,8 @@ public: // for check
       return CheckNextHopResult::NO_FIB_ENTRY;
     }
 
-    const auto& nextHops = entry->getNextHops();
+    auto nextHopsPtr = entry->getNextHops();
+    const auto& nextHops = *nextHopsPtr;
     if (expectedNNextHops && nextHops.size() != *expectedNNextHops) {
       return CheckNextHopResult::WRONG_N_NEXTHOPS;
     }
@@ -398,6 +399,21 @@ BOOST_AUTO_TEST_CASE(RecordNotExist)
 
 BOOST_AUTO_TEST_SUITE_END() // RemoveNextHop
 
+BOOST_AUTO_TEST_CASE(ApplyDirectly)
+{
+  FaceId faceId = addFace();
+
+  BOOST_TEST(m_manager.applyAddNextHop("/hello", face::INVALID_FACEID, 101).getCode() == 410);
+  BOOST_TEST(m_manager.applyAddNextHop("/hello", faceId, 101).getCode() == 200);
+  BOOST_CHECK_EQUAL(checkNextHop("/hello", 1, faceId, 101), CheckNextHopResult::OK);
+
+  BOOST_TEST(m_manager.applyRemoveNextHop("/hello", faceId).getCode() == 200);
+  BOOST_CHECK_EQUAL(checkNextHop("/hello"), CheckNextHopResult::NO_FIB_ENTRY);
+
+  // no response is sent for direct updates
+  BOOST_TEST(m_responses.empty());
+}
+
 BOOST_AUTO_TEST_SUITE(List)
 
 BOOST_AUTO_TEST_CASE(FibDataset)
@@ -429,7 +445,8 @@ BOOST_AUTO_TEST_CASE(FibDataset)
 
     expectedRecords.emplace_back();
     expectedRecords.back().setPrefix(matchedEntry->getPrefix());
-    for (const auto& nh : matchedEntry->getNextHops()) {
+    auto nexthops = matchedEntry->getNextHops();
+    for (const auto& nh : *nexthops) {
       expectedRecords.back().addNextHopRecord(ndn::nfd::NextHopRecord()
                                               .setFaceId(nh.getFace().getId())
                                               .setCost(nh.getCost()));
@@ -440,6 +457,61 @@ BOOST_AUTO_TEST_CASE(FibDataset)
   BOOST_TEST(receivedRecords == expectedRecords, boost::test_tools::per_element());
 }
 
+BOOST_AUTO_TEST_CASE(Changes)
+{
+  auto face1 = m_faceTable.get(addFace());
+  auto face2 = m_faceTable.get(addFace());
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/A").first, *face1, 10);
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/B").first, *face1, 10);
+
+  // version 0 lists all entries
+  receiveInterest(Interest(Name("/localhost/nfd/fib/list").appendNumber(0)).setCanBePrefix(true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  uint64_t version = m_responses[0].getName().at(-3).toNumber();
+  Block content = m_responses[0].getContent();
+  content.parse();
+  BOOST_CHECK_EQUAL(content.elements().size(), 2);
+
+  m_fib.removeNextHop(*m_fib.findExactMatch("/A"), *face1);
+  m_fib.addOrUpdateNextHop(*m_fib.findExactMatch("/B"), *face2, 20);
+  m_fib.addOrUpdateNextHop(*m_fib.insert("/C").first, *face2, 30);
+
+  m_responses.clear();
+  receiveInterest(Interest(Name("/localhost/nfd/fib/list").appendNumber(version)).setCanBePrefix(true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(m_responses[0].getName().at(-3).toNumber(), version + 3);
+  content = m_responses[0].getContent();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 3);
+
+  ndn::nfd::FibEntry entryA(content.elements()[0]);
+  BOOST_CHECK_EQUAL(entryA.getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(entryA.getNextHopRecords().size(), 0);
+  ndn::nfd::FibEntry entryB(content.elements()[1]);
+  BOOST_CHECK_EQUAL(entryB.getPrefix(), "/B");
+  BOOST_CHECK_EQUAL(entryB.getNextHopRecords().size(), 2);
+  ndn::nfd::FibEntry entryC(content.elements()[2]);
+  BOOST_CHECK_EQUAL(entryC.getPrefix(), "/C");
+  BOOST_CHECK_EQUAL(entryC.getNextHopRecords().size(), 1);
+
+  // changes before the first version are not available
+  m_responses.clear();
+  Name staleQuery = Name("/localhost/nfd/fib/list").appendNumber(version - 1);
+  receiveInterest(Interest(staleQuery).setCanBePrefix(true));
+  BOOST_CHECK_EQUAL(checkResponse(0, staleQuery,
+                                  ControlResponse(410, "Changes since version " + to_string(version - 1) +
+                                                       " are unavailable"),
+                                  tlv::ContentType_Nack),
+                    CheckResponseResult::OK);
+
+  m_responses.clear();
+  Name malformedQuery = Name("/localhost/nfd/fib/list").append("x");
+  receiveInterest(Interest(malformedQuery).setCanBePrefix(true));
+  BOOST_CHECK_EQUAL(checkResponse(0, malformedQuery, ControlResponse(400, "Malformed version"),
+                                  tlv::ContentType_Nack),
+                    CheckResponseResult::OK);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // List
 
 BOOST_AUTO_TEST_SUITE_END() // TestFibManager
@@ -34,7 +34,7 @@ InterestSignerFixture::InterestSignerFixture()
 
 Interest
 InterestSignerFixture::makeControlCommandRequest(Name commandName,
-                                                 const ControlParameters& params,
+                                                 const ndn::mgmt::ControlParameters& params,
                                                  ndn::security::SignedInterestFormat format,
                                                  const Name& identity)
 {
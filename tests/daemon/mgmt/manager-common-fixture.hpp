@@ -55,7 +55,7 @@ protected:
    */
   Interest
   makeControlCommandRequest(Name commandName,
-                            const ControlParameters& params = {},
+                            const ndn::mgmt::ControlParameters& params = ControlParameters(),
                             ndn::security::SignedInterestFormat format = ndn::security::SignedInterestFormat::V03,
                             const Name& identity = DEFAULT_COMMAND_SIGNER_IDENTITY);
 
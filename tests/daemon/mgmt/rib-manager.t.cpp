@@ -452,6 +452,75 @@ BOOST_AUTO_TEST_CASE(NameTooLong)
   BOOST_CHECK_EQUAL(m_fibUpdater.updates.size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(Batch)
+{
+  ControlParametersList paramsRegister(std::vector<ControlParameters>{
+    makeRegisterParameters("/batch/a", 9527),
+    makeRegisterParameters("/batch/b"),
+    makeRegisterParameters("/batch/c", 9528),
+  });
+  ControlParametersList paramsUnregister;
+  paramsUnregister.addItem(makeUnregisterParameters("/batch/a", 9527));
+
+  auto commandRegister = makeControlCommandRequest("/localhost/nfd/rib/register-batch", paramsRegister);
+  commandRegister.setTag(make_shared<lp::IncomingFaceIdTag>(1234));
+  auto commandUnregister = makeControlCommandRequest("/localhost/nfd/rib/unregister-batch", paramsUnregister);
+  receiveInterest(commandRegister);
+  receiveInterest(commandUnregister);
+
+  // self-registration uses the incoming face
+  ControlParametersList expectedRegister(std::vector<ControlParameters>{
+    makeRegisterParameters("/batch/a", 9527),
+    makeRegisterParameters("/batch/b", 1234),
+    makeRegisterParameters("/batch/c", 9528),
+  });
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 2);
+  BOOST_CHECK_EQUAL(checkResponse(0, commandRegister.getName(),
+                                  ControlResponse(200, "Success").setBody(expectedRegister.wireEncode())),
+                    CheckResponseResult::OK);
+  BOOST_CHECK_EQUAL(checkResponse(1, commandUnregister.getName(),
+                                  ControlResponse(200, "Success").setBody(paramsUnregister.wireEncode())),
+                    CheckResponseResult::OK);
+
+  BOOST_REQUIRE_EQUAL(m_fibUpdater.updates.size(), 4);
+  m_fibUpdater.sortUpdates();
+  auto update = m_fibUpdater.updates.begin();
+  BOOST_CHECK_EQUAL(*update++, rib::FibUpdate::createAddUpdate("/batch/a", 9527, 10));
+  BOOST_CHECK_EQUAL(*update++, rib::FibUpdate::createRemoveUpdate("/batch/a", 9527));
+  BOOST_CHECK_EQUAL(*update++, rib::FibUpdate::createAddUpdate("/batch/b", 1234, 10));
+  BOOST_CHECK_EQUAL(*update++, rib::FibUpdate::createAddUpdate("/batch/c", 9528, 10));
+  BOOST_CHECK(m_rib.find("/batch/a") == m_rib.end());
+  BOOST_CHECK(m_rib.find("/batch/c") != m_rib.end());
+}
+
+BOOST_AUTO_TEST_CASE(BatchInvalid)
+{
+  Name prefix;
+  while (prefix.size() <= Fib::getMaxDepth()) {
+    prefix.append("A");
+  }
+  ControlParametersList params;
+  params.addItem(makeRegisterParameters("/batch/a", 9527))
+        .addItem(makeRegisterParameters(prefix, 9527));
+  auto command = makeControlCommandRequest("/localhost/nfd/rib/register-batch", params);
+  receiveInterest(command);
+
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  BOOST_CHECK_EQUAL(checkResponse(0, command.getName(),
+                                  ControlResponse(414, "Route prefix cannot exceed " +
+                                                  to_string(Fib::getMaxDepth()) + " components")),
+                    CheckResponseResult::OK);
+
+  // an empty list is rejected
+  command = makeControlCommandRequest("/localhost/nfd/rib/register-batch", ControlParametersList());
+  receiveInterest(command);
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 2);
+  BOOST_CHECK_EQUAL(checkResponse(1, command.getName(), ControlResponse(400, "failed in validating parameters")),
+                    CheckResponseResult::OK);
+
+  BOOST_CHECK_EQUAL(m_fibUpdater.updates.size(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // RegisterUnregister
 
 BOOST_FIXTURE_TEST_CASE(RibDataset, UnauthorizedRibManagerFixture)
@@ -510,6 +579,45 @@ BOOST_FIXTURE_TEST_CASE(RibDataset, UnauthorizedRibManagerFixture)
   BOOST_TEST(receivedRecords == expectedRecords, boost::test_tools::per_element());
 }
 
+BOOST_FIXTURE_TEST_CASE(RibDatasetChanges, UnauthorizedRibManagerFixture)
+{
+  auto makeRoute = [] (uint64_t faceId, uint64_t cost) {
+    rib::Route route;
+    route.faceId = faceId;
+    route.cost = cost;
+    return route;
+  };
+
+  m_rib.insert("/A", makeRoute(1, 10));
+  m_rib.insert("/B", makeRoute(1, 10));
+
+  // version 0 lists all entries
+  receiveInterest(*makeInterest(Name("/localhost/nfd/rib/list").appendNumber(0), true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  uint64_t version = m_responses[0].getName().at(-3).toNumber();
+  Block content = m_responses[0].getContent();
+  content.parse();
+  BOOST_CHECK_EQUAL(content.elements().size(), 2);
+
+  m_rib.erase("/A", makeRoute(1, 10));
+  m_rib.insert("/B", makeRoute(1, 20)); // update cost
+
+  m_responses.clear();
+  receiveInterest(*makeInterest(Name("/localhost/nfd/rib/list").appendNumber(version), true));
+  BOOST_REQUIRE_EQUAL(m_responses.size(), 1);
+  content = m_responses[0].getContent();
+  content.parse();
+  BOOST_REQUIRE_EQUAL(content.elements().size(), 2);
+
+  ndn::nfd::RibEntry entryA(content.elements()[0]);
+  BOOST_CHECK_EQUAL(entryA.getName(), "/A");
+  BOOST_CHECK_EQUAL(entryA.getRoutes().size(), 0);
+  ndn::nfd::RibEntry entryB(content.elements()[1]);
+  BOOST_CHECK_EQUAL(entryB.getName(), "/B");
+  BOOST_REQUIRE_EQUAL(entryB.getRoutes().size(), 1);
+  BOOST_CHECK_EQUAL(entryB.getRoutes().front().getCost(), 20);
+}
+
 BOOST_FIXTURE_TEST_SUITE(FaceMonitor, LocalhostAuthorizedRibManagerFixture)
 
 BOOST_AUTO_TEST_CASE(FetchActiveFacesEvent)
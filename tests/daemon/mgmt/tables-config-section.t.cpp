@@ -268,6 +268,99 @@ BOOST_AUTO_TEST_CASE(Unknown)
 
 BOOST_AUTO_TEST_SUITE_END() // CsUnsolicitedPolicy
 
+class CsAdmissionPolicyFixture : public TablesConfigSectionFixture
+{
+protected:
+  CsAdmissionPolicyFixture()
+  {
+    forwarder.getCs().setAdmissionPolicy(make_unique<cs::PopularityAdmissionPolicy>());
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(CsAdmissionPolicy, CsAdmissionPolicyFixture)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  cs::AdmissionPolicy* currentPolicy = forwarder.getCs().getAdmissionPolicy();
+  NFD_CHECK_TYPEID_EQUAL(*currentPolicy, cs::PopularityAdmissionPolicy);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  currentPolicy = forwarder.getCs().getAdmissionPolicy();
+  NFD_CHECK_TYPEID_EQUAL(*currentPolicy, cs::AdmitAllAdmissionPolicy);
+}
+
+BOOST_AUTO_TEST_CASE(Known)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_admission_policy probabilistic
+      cs_admission_parameters
+      {
+        probability 0.25
+      }
+    }
+  )CONFIG";
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, true));
+  cs::AdmissionPolicy* currentPolicy = forwarder.getCs().getAdmissionPolicy();
+  NFD_CHECK_TYPEID_EQUAL(*currentPolicy, cs::PopularityAdmissionPolicy);
+
+  BOOST_REQUIRE_NO_THROW(runConfig(CONFIG, false));
+  currentPolicy = forwarder.getCs().getAdmissionPolicy();
+  NFD_REQUIRE_TYPEID_EQUAL(*currentPolicy, cs::ProbabilisticAdmissionPolicy);
+  BOOST_TEST(static_cast<cs::ProbabilisticAdmissionPolicy*>(currentPolicy)->getProbability() == 0.25);
+}
+
+BOOST_AUTO_TEST_CASE(Unknown)
+{
+  const std::string CONFIG = R"CONFIG(
+    tables
+    {
+      cs_admission_policy unknown
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG, false), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_CASE(BadParameter)
+{
+  const std::string CONFIG1 = R"CONFIG(
+    tables
+    {
+      cs_admission_policy popularity
+      cs_admission_parameters
+      {
+        threshold 0
+      }
+    }
+  )CONFIG";
+  const std::string CONFIG2 = R"CONFIG(
+    tables
+    {
+      cs_admission_policy popularity
+      cs_admission_parameters
+      {
+        probability 0.5
+      }
+    }
+  )CONFIG";
+
+  BOOST_CHECK_THROW(runConfig(CONFIG1, true), ConfigFile::Error);
+  BOOST_CHECK_THROW(runConfig(CONFIG2, true), ConfigFile::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CsAdmissionPolicy
+
 BOOST_AUTO_TEST_SUITE(StrategyChoice)
 
 BOOST_AUTO_TEST_CASE(Unversioned)
@@ -0,0 +1,319 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rib/fib-updater.hpp"
+#include "common/global.hpp"
+
+#include "tests/test-common.hpp"
+#include "tests/key-chain-fixture.hpp"
+#include "tests/daemon/global-io-fixture.hpp"
+#include "tests/daemon/rib/create-route.hpp"
+
+#include <ndn-cxx/util/dummy-client-face.hpp>
+
+namespace nfd::tests {
+
+using rib::FibUpdate;
+using rib::FibUpdater;
+
+class FibUpdaterFixture : public GlobalIoFixture, public KeyChainFixture
+{
+protected:
+  void
+  beginUpdate(rib::RibUpdate::Action action, const Name& name, uint64_t faceId, uint64_t flags = 0)
+  {
+    rib::RibUpdate update;
+    update.setAction(action)
+          .setName(name)
+          .setRoute(createRoute(faceId, 0, 10, flags));
+
+    rib.beginApplyUpdate(update,
+                         [this] { ++nSuccesses; },
+                         [this] (uint32_t code, const std::string&) { failures.push_back(code); });
+  }
+
+  void
+  insertRoute(const Name& name, uint64_t faceId, uint64_t flags)
+  {
+    beginUpdate(rib::RibUpdate::REGISTER, name, faceId, flags);
+    pollIo();
+  }
+
+protected:
+  static constexpr uint64_t UNKNOWN_FACE_ID = 3;
+  static constexpr uint64_t REJECTED_FACE_ID = 4;
+
+  ndn::util::DummyClientFace face{g_io, m_keyChain};
+  ndn::nfd::Controller controller{face, m_keyChain};
+  rib::Rib rib;
+  FibUpdater fibUpdater{rib, controller};
+
+  int nSuccesses = 0;
+  std::vector<uint32_t> failures;
+};
+
+class DirectFibUpdaterFixture : public FibUpdaterFixture
+{
+protected:
+  DirectFibUpdaterFixture()
+  {
+    // main and RIB thread share one io_service in this test
+    setMainIoService(&g_io);
+    setRibIoService(&g_io);
+
+    fibUpdater.setDirectUpdateFunc([this] (const FibUpdate& update) {
+      appliedUpdates.push_back(update);
+      switch (update.faceId) {
+        case UNKNOWN_FACE_ID:
+          return ndn::nfd::ControlResponse(410, "Face not found");
+        case REJECTED_FACE_ID:
+          return ndn::nfd::ControlResponse(500, "Rejected");
+        default:
+          return ndn::nfd::ControlResponse(200, "Success");
+      }
+    });
+  }
+
+  ~DirectFibUpdaterFixture()
+  {
+    setMainIoService(nullptr);
+    setRibIoService(nullptr);
+  }
+
+protected:
+  std::vector<FibUpdate> appliedUpdates;
+};
+
+class ControllerFibUpdaterFixture : public FibUpdaterFixture
+{
+protected:
+  ControllerFibUpdaterFixture()
+  {
+    face.onSendInterest.connect([this] (const Interest& interest) {
+      // command Interest name: /localhost/nfd/fib/<verb>/<parameters>/...
+      ndn::nfd::ControlParameters params(interest.getName().at(4).blockFromValue());
+      ndn::nfd::ControlResponse resp(200, "Success");
+      if (interest.getName().at(3) == name::Component("add-nexthop") &&
+          params.getFaceId() == UNKNOWN_FACE_ID) {
+        resp = ndn::nfd::ControlResponse(410, "Face not found");
+      }
+      else {
+        resp.setBody(params.wireEncode());
+      }
+
+      auto data = make_shared<Data>(interest.getName());
+      data->setContent(resp.wireEncode());
+      m_keyChain.sign(*data, ndn::security::SigningInfo(ndn::security::SigningInfo::SIGNER_TYPE_SHA256));
+      g_io.post([this, data] { face.receive(*data); });
+    });
+
+    rib.afterInsertEntry.connect([this] (const Name& name) { insertedEntries.push_back(name); });
+    rib.afterEraseEntry.connect([this] (const Name& name) { erasedEntries.push_back(name); });
+    rib.afterAddRoute.connect([this] (const rib::RibRouteRef& ref) {
+      addedRoutes.emplace_back(ref.entry->getName(), ref.route->faceId);
+    });
+    rib.beforeRemoveRoute.connect([this] (const rib::RibRouteRef& ref) {
+      removedRoutes.emplace_back(ref.entry->getName(), ref.route->faceId);
+    });
+  }
+
+protected:
+  std::vector<Name> insertedEntries;
+  std::vector<Name> erasedEntries;
+  std::vector<std::pair<Name, uint64_t>> addedRoutes;
+  std::vector<std::pair<Name, uint64_t>> removedRoutes;
+};
+
+BOOST_AUTO_TEST_SUITE(TestFibUpdater)
+
+BOOST_FIXTURE_TEST_SUITE(Direct, DirectFibUpdaterFixture)
+
+BOOST_AUTO_TEST_CASE(Apply)
+{
+  insertRoute("/", 1, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  BOOST_TEST(nSuccesses == 1);
+  BOOST_REQUIRE_EQUAL(appliedUpdates.size(), 1);
+  BOOST_TEST(appliedUpdates.back() == FibUpdate::createAddUpdate("/", 1, 10));
+
+  // inherited route and new route are applied together
+  appliedUpdates.clear();
+  insertRoute("/a", 2, 0);
+  BOOST_TEST(nSuccesses == 2);
+  BOOST_TEST(appliedUpdates.size() == 2);
+  BOOST_TEST(rib.find("/a") != rib.end());
+
+  // no management command is sent
+  BOOST_TEST(face.sentInterests.empty());
+}
+
+BOOST_AUTO_TEST_CASE(FaceNotFound)
+{
+  insertRoute("/b", UNKNOWN_FACE_ID, 0);
+  BOOST_TEST(nSuccesses == 0);
+  BOOST_REQUIRE_EQUAL(failures.size(), 1);
+  BOOST_TEST(failures.back() == 410);
+  BOOST_TEST(rib.find("/b") == rib.end());
+}
+
+BOOST_AUTO_TEST_CASE(DestroyedBeforeResponse)
+{
+  int nApplied = 0;
+  {
+    rib::Rib otherRib;
+    FibUpdater otherUpdater(otherRib, controller);
+    otherUpdater.setDirectUpdateFunc([&] (const FibUpdate&) {
+      ++nApplied;
+      return ndn::nfd::ControlResponse(200, "Success");
+    });
+
+    rib::RibUpdate update;
+    update.setAction(rib::RibUpdate::REGISTER)
+          .setName("/c")
+          .setRoute(createRoute(1, 0, 10, 0));
+    otherRib.beginApplyUpdate(update,
+                              [this] { ++nSuccesses; },
+                              [this] (uint32_t code, const std::string&) { failures.push_back(code); });
+  }
+
+  // the updates are still applied on the main thread, but the responses are not posted back
+  BOOST_CHECK_NO_THROW(pollIo());
+  BOOST_TEST(nApplied == 1);
+  BOOST_TEST(nSuccesses == 0);
+  BOOST_TEST(failures.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Direct
+
+BOOST_FIXTURE_TEST_SUITE(Transaction, DirectFibUpdaterFixture)
+
+BOOST_AUTO_TEST_CASE(Coalesce)
+{
+  // the first update is sent immediately, the others are queued until it completes
+  beginUpdate(rib::RibUpdate::REGISTER, "/", 1, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  beginUpdate(rib::RibUpdate::REGISTER, "/a", 2);
+  beginUpdate(rib::RibUpdate::REGISTER, "/b", 2);
+  beginUpdate(rib::RibUpdate::UNREGISTER, "/b", 2);
+  pollIo();
+
+  BOOST_TEST(nSuccesses == 4);
+  BOOST_TEST(failures.empty());
+  BOOST_TEST(rib.find("/a") != rib.end());
+  BOOST_TEST(rib.find("/b") == rib.end());
+
+  // the nexthops added and then removed on /b are not applied
+  std::vector<FibUpdate> expected{
+    FibUpdate::createAddUpdate("/", 1, 10),
+    FibUpdate::createAddUpdate("/a", 1, 10),
+    FibUpdate::createAddUpdate("/a", 2, 10),
+  };
+  BOOST_TEST(appliedUpdates == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(FaceNotFound)
+{
+  beginUpdate(rib::RibUpdate::REGISTER, "/a", 1);
+  beginUpdate(rib::RibUpdate::REGISTER, "/b", 2);
+  beginUpdate(rib::RibUpdate::REGISTER, "/c", UNKNOWN_FACE_ID);
+  pollIo();
+
+  BOOST_TEST(nSuccesses == 2);
+  BOOST_REQUIRE_EQUAL(failures.size(), 1);
+  BOOST_TEST(failures.back() == 410);
+  BOOST_TEST(rib.find("/b") != rib.end());
+
+  // the route on the non-existent face is removed afterwards
+  BOOST_TEST(rib.find("/c") == rib.end());
+}
+
+BOOST_AUTO_TEST_CASE(RollBack)
+{
+  insertRoute("/", 1, ndn::nfd::ROUTE_FLAG_CHILD_INHERIT);
+  insertRoute("/a", 2, 0);
+  BOOST_TEST(nSuccesses == 2);
+
+  // the first update is sent alone, the others form one transaction
+  beginUpdate(rib::RibUpdate::REGISTER, "/x", 1);
+  beginUpdate(rib::RibUpdate::UNREGISTER, "/a", 2);
+  beginUpdate(rib::RibUpdate::REGISTER, "/b", 2);
+  beginUpdate(rib::RibUpdate::REGISTER, "/c", REJECTED_FACE_ID);
+  BOOST_CHECK_NO_THROW(pollIo());
+
+  // all updates of the rejected transaction fail
+  BOOST_TEST(nSuccesses == 3);
+  std::vector<uint32_t> expectedFailures{500, 500, 500};
+  BOOST_TEST(failures == expectedFailures, boost::test_tools::per_element());
+
+  // and the RIB is as it was before the transaction
+  BOOST_TEST(rib.size() == 3);
+  BOOST_TEST(rib.find("/x") != rib.end());
+  BOOST_TEST(rib.find("/b") == rib.end());
+  BOOST_TEST(rib.find("/c") == rib.end());
+  auto a = rib.find("/a");
+  BOOST_REQUIRE(a != rib.end());
+  BOOST_TEST(a->second->hasFaceId(2));
+  BOOST_TEST(a->second->hasInheritedRoute(createRoute(1, 0)));
+  BOOST_CHECK(a->second->getParent() == rib.find("/")->second);
+
+  // the next update is not blocked by the failed transaction
+  insertRoute("/d", 2, 0);
+  BOOST_TEST(nSuccesses == 4);
+  BOOST_TEST(rib.find("/d") != rib.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Transaction
+
+BOOST_FIXTURE_TEST_SUITE(ControllerTransaction, ControllerFibUpdaterFixture)
+
+BOOST_AUTO_TEST_CASE(FaceNotFound)
+{
+  beginUpdate(rib::RibUpdate::REGISTER, "/a", 1);
+  beginUpdate(rib::RibUpdate::REGISTER, "/b", 2);
+  beginUpdate(rib::RibUpdate::REGISTER, "/b", UNKNOWN_FACE_ID);
+  beginUpdate(rib::RibUpdate::REGISTER, "/c", UNKNOWN_FACE_ID, ndn::nfd::ROUTE_FLAG_CAPTURE);
+  pollIo();
+
+  BOOST_TEST(nSuccesses == 2);
+  std::vector<uint32_t> expectedFailures{410, 410};
+  BOOST_TEST(failures == expectedFailures, boost::test_tools::per_element());
+
+  // the routes on the non-existent face are not left in the RIB
+  BOOST_TEST(rib.find("/b") != rib.end());
+  BOOST_TEST(rib.find("/b", createRoute(UNKNOWN_FACE_ID, 0)) == nullptr);
+  BOOST_TEST(rib.find("/c") == rib.end());
+  BOOST_TEST(rib.size() == 2);
+
+  // and are never announced, neither when they are added nor when they are removed
+  std::vector<Name> expectedEntries{"/a", "/b"};
+  BOOST_TEST(insertedEntries == expectedEntries, boost::test_tools::per_element());
+  std::vector<std::pair<Name, uint64_t>> expectedRoutes{{"/a", 1}, {"/b", 2}};
+  BOOST_CHECK(addedRoutes == expectedRoutes);
+  BOOST_TEST(erasedEntries.empty());
+  BOOST_TEST(removedRoutes.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ControllerTransaction
+BOOST_AUTO_TEST_SUITE_END() // TestFibUpdater
+
+} // namespace nfd::tests
@@ -295,6 +295,104 @@ BOOST_AUTO_TEST_CASE(ChangeDuringRetry)
   BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 0); // don't try to withdraw
 }
 
+BOOST_AUTO_TEST_CASE(HoldDown)
+{
+  ReadvertiseOptions options;
+  options.holdDown = 5_s;
+  readvertise->setOptions(options);
+  policy->decision = ReadvertiseAction{"/A", ndn::security::SigningInfo()};
+
+  this->insertRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 1);
+
+  // route comes back within hold-down, no command is sent
+  this->eraseRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(1_s);
+  this->insertRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(1_s, 10_s);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 1);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 0);
+
+  // withdrawal is sent after hold-down
+  this->eraseRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(1_s, 4_s);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 0);
+  this->advanceClocks(1_s, 2_s);
+  BOOST_REQUIRE_EQUAL(destination->withdrawHistory.size(), 1);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.at(0).prefix, "/A");
+}
+
+BOOST_AUTO_TEST_CASE(RateLimit)
+{
+  ReadvertiseOptions options;
+  options.commandRate = 2;
+  readvertise->setOptions(options);
+
+  for (const std::string prefix : {"/A", "/B", "/C", "/D"}) {
+    policy->decision = ReadvertiseAction{prefix, ndn::security::SigningInfo()};
+    this->insertRoute(Name(prefix).append("1"), 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  }
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 1);
+
+  // /D is removed before its advertisement is sent, so no command is sent for it
+  this->eraseRoute("/D/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(10_ms, 1200_ms);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 3);
+  this->advanceClocks(10_ms, 1_s);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 3);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.size(), 0);
+
+  // commands are at least 500 milliseconds apart
+  for (size_t i = 1; i < destination->advertiseHistory.size(); ++i) {
+    BOOST_CHECK(destination->advertiseHistory[i].timestamp -
+                destination->advertiseHistory[i - 1].timestamp >= 490_ms);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RateLimitHoldDown)
+{
+  ReadvertiseOptions options;
+  options.commandRate = 2;
+  options.commandBurst = 1;
+  options.holdDown = 5_s;
+  readvertise->setOptions(options);
+
+  policy->decision = ReadvertiseAction{"/A", ndn::security::SigningInfo()};
+  this->insertRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  policy->decision = ReadvertiseAction{"/B", ndn::security::SigningInfo()};
+  this->insertRoute("/B/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 1);
+
+  // /B is withdrawn and comes back within hold-down, before its advertisement is sent
+  this->eraseRoute("/B/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(100_ms);
+  this->insertRoute("/B/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+
+  // the advertisement is not lost
+  this->advanceClocks(10_ms, 1_s);
+  BOOST_REQUIRE_EQUAL(destination->advertiseHistory.size(), 2);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.at(1).prefix, "/B");
+
+  // /A is withdrawn after hold-down, because it has been advertised
+  this->eraseRoute("/A/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  policy->decision = ReadvertiseAction{"/D", ndn::security::SigningInfo()};
+  this->insertRoute("/D/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.size(), 3);
+
+  // /C is withdrawn before its advertisement is sent, so no command is sent for it
+  policy->decision = ReadvertiseAction{"/C", ndn::security::SigningInfo()};
+  this->insertRoute("/C/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->insertRoute("/C/2", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->eraseRoute("/C/1", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->eraseRoute("/C/2", 1, ndn::nfd::ROUTE_ORIGIN_CLIENT);
+  this->advanceClocks(100_ms, 10_s);
+
+  BOOST_REQUIRE_EQUAL(destination->advertiseHistory.size(), 3);
+  BOOST_CHECK_EQUAL(destination->advertiseHistory.at(2).prefix, "/D");
+  BOOST_REQUIRE_EQUAL(destination->withdrawHistory.size(), 1);
+  BOOST_CHECK_EQUAL(destination->withdrawHistory.at(0).prefix, "/A");
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestReadvertise
 BOOST_AUTO_TEST_SUITE_END() // Readvertise
 
@@ -100,6 +100,31 @@ BOOST_AUTO_TEST_CASE(Children)
   BOOST_CHECK_EQUAL((rib.find(name3)->second)->getParent()->getName(), name4);
 }
 
+BOOST_AUTO_TEST_CASE(ChildrenOfNewEntry)
+{
+  rib::Rib rib;
+  rib.insert("/a/b", createRoute(1, 20));
+  rib.insert("/a/b/c", createRoute(2, 20));
+  rib.insert("/a/b/c/d", createRoute(3, 20));
+  rib.insert("/a/e", createRoute(4, 20));
+  rib.insert("/ab", createRoute(5, 20));
+
+  // only the entries without another entry in between are adopted
+  rib.insert("/a", createRoute(6, 20));
+  auto a = rib.find("/a")->second;
+  BOOST_REQUIRE_EQUAL(a->getChildren().size(), 2);
+  BOOST_CHECK_EQUAL(a->getChildren().front()->getName(), "/a/b");
+  BOOST_CHECK_EQUAL(a->getChildren().back()->getName(), "/a/e");
+  BOOST_CHECK_EQUAL(rib.find("/a/b/c")->second->getParent()->getName(), "/a/b");
+  BOOST_CHECK(rib.find("/ab")->second->getParent() == nullptr);
+
+  // a new root adopts all top-level entries
+  rib.insert("/", createRoute(7, 20));
+  BOOST_CHECK_EQUAL(rib.find("/")->second->getChildren().size(), 2);
+  BOOST_CHECK_EQUAL(a->getParent()->getName(), "/");
+  BOOST_CHECK_EQUAL(rib.find("/ab")->second->getParent()->getName(), "/");
+}
+
 BOOST_AUTO_TEST_CASE(EraseFace)
 {
   rib::Rib rib;
@@ -69,6 +69,9 @@ BOOST_AUTO_TEST_CASE(Basic)
     BOOST_CHECK_EQUAL(pitEntry.hasInRecords(), false);
     BOOST_CHECK_EQUAL(pitEntry.hasOutRecords(), false);
   }
+  BOOST_CHECK_EQUAL(nameTree.size(), 302); // "/", "/P", and PIT entries
+  BOOST_CHECK(fib.findEntriesByNextHop(*face1).empty());
+  BOOST_CHECK(pit.findEntriesByFace(*face1).empty());
 }
 
 BOOST_AUTO_TEST_CASE(RemoveFibNexthops)
@@ -116,8 +119,8 @@ BOOST_AUTO_TEST_CASE(RemoveFibNexthops)
 
   const fib::Entry& foundA = fib.findLongestPrefixMatch("/A");
   BOOST_CHECK_EQUAL(foundA.getPrefix(), "/A");
-  BOOST_CHECK_EQUAL(foundA.getNextHops().size(), 1);
-  BOOST_CHECK_EQUAL(&foundA.getNextHops().begin()->getFace(), face2.get());
+  BOOST_CHECK_EQUAL(foundA.getNextHops()->size(), 1);
+  BOOST_CHECK_EQUAL(&foundA.getNextHops()->begin()->getFace(), face2.get());
 
   BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch("/B").getPrefix(), "/");
 
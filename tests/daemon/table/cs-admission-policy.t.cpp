@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2022,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "table/cs-admission-policy.hpp"
+
+#include "tests/daemon/table/cs-fixture.hpp"
+
+namespace nfd::tests {
+
+BOOST_AUTO_TEST_SUITE(Table)
+BOOST_AUTO_TEST_SUITE(TestCsAdmissionPolicy)
+
+BOOST_AUTO_TEST_CASE(Registration)
+{
+  std::set<std::string> policyNames = cs::AdmissionPolicy::getPolicyNames();
+  BOOST_CHECK_EQUAL(policyNames.count("admit-all"), 1);
+  BOOST_CHECK_EQUAL(policyNames.count("probabilistic"), 1);
+  BOOST_CHECK_EQUAL(policyNames.count("popularity"), 1);
+  BOOST_CHECK(cs::AdmissionPolicy::create("unknown") == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(Parameters)
+{
+  cs::AdmitAllAdmissionPolicy admitAll;
+  BOOST_CHECK_THROW(admitAll.setParameter("probability", "0.5"), std::invalid_argument);
+
+  cs::ProbabilisticAdmissionPolicy probabilistic;
+  BOOST_TEST(probabilistic.getProbability() == 0.5);
+  probabilistic.setParameter("probability", "1");
+  BOOST_TEST(probabilistic.getProbability() == 1.0);
+  BOOST_CHECK_THROW(probabilistic.setParameter("probability", "0"), std::invalid_argument);
+  BOOST_CHECK_THROW(probabilistic.setParameter("probability", "1.5"), std::invalid_argument);
+  BOOST_CHECK_THROW(probabilistic.setParameter("probability", "x"), std::invalid_argument);
+  BOOST_CHECK_THROW(probabilistic.setParameter("threshold", "2"), std::invalid_argument);
+
+  cs::PopularityAdmissionPolicy popularity;
+  BOOST_TEST(popularity.getThreshold() == 2);
+  popularity.setParameter("threshold", "3");
+  BOOST_TEST(popularity.getThreshold() == 3);
+  BOOST_CHECK_THROW(popularity.setParameter("threshold", "0"), std::invalid_argument);
+  BOOST_CHECK_THROW(popularity.setParameter("threshold", "256"), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Probabilistic)
+{
+  cs::ProbabilisticAdmissionPolicy policy;
+  auto data = makeData("/A");
+
+  policy.setParameter("probability", "1");
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK(policy.shouldAdmit(*data));
+  }
+
+  policy.setParameter("probability", "0.5");
+  int nAdmitted = 0;
+  for (int i = 0; i < 1000; ++i) {
+    nAdmitted += policy.shouldAdmit(*data);
+  }
+  BOOST_TEST(nAdmitted > 350);
+  BOOST_TEST(nAdmitted < 650);
+}
+
+BOOST_AUTO_TEST_CASE(Popularity)
+{
+  cs::PopularityAdmissionPolicy policy;
+  auto a = makeData("/A");
+  auto b = makeData("/B");
+
+  BOOST_CHECK(!policy.shouldAdmit(*a));
+  BOOST_CHECK(policy.shouldAdmit(*a));
+  BOOST_CHECK(policy.shouldAdmit(*a));
+  BOOST_CHECK(!policy.shouldAdmit(*b));
+
+  // counters are halved after N_COUNTERS observations, so /B is forgotten but /A is not
+  for (size_t i = 4; i < cs::PopularityAdmissionPolicy::N_COUNTERS; ++i) {
+    policy.shouldAdmit(*a);
+  }
+  BOOST_CHECK(!policy.shouldAdmit(*b));
+  BOOST_CHECK(policy.shouldAdmit(*a));
+}
+
+BOOST_FIXTURE_TEST_CASE(CsInsert, CsFixture)
+{
+  cs.setAdmissionPolicy(make_unique<cs::PopularityAdmissionPolicy>());
+  BOOST_TEST(cs.getAdmissionPolicy()->getName() == "popularity");
+
+  insert(1, "/A");
+  BOOST_CHECK_EQUAL(cs.size(), 0);
+  insert(1, "/A");
+  BOOST_CHECK_EQUAL(cs.size(), 1);
+
+  // unsolicited Data is governed by the unsolicited Data policy only
+  insert(2, "/B", nullptr, true);
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+
+  // Data already in the CS is refreshed without consulting the admission policy,
+  // so a solicited copy turns the unsolicited entry into a solicited one
+  insert(2, "/B");
+  BOOST_CHECK_EQUAL(cs.size(), 2);
+  auto entryB = std::find_if(cs.begin(), cs.end(), [] (const auto& e) { return e.getName() == Name("/B"); });
+  BOOST_REQUIRE(entryB != cs.end());
+  BOOST_CHECK_EQUAL(entryB->isUnsolicited(), false);
+
+  startInterest("/A");
+  CHECK_CS_FIND(1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestCsAdmissionPolicy
+BOOST_AUTO_TEST_SUITE_END() // Table
+
+} // namespace nfd::tests
@@ -236,6 +236,39 @@ BOOST_AUTO_TEST_CASE(CachePolicyNoCache)
   CHECK_CS_FIND(0);
 }
 
+BOOST_AUTO_TEST_CASE(DetachSharedWire)
+{
+  // a Data that shares a large buffer with other packets, as received by a StreamTransport
+  auto data = makeData("/A");
+  const Block& wire = data->wireEncode();
+  auto chunk = make_shared<ndn::Buffer>(65536);
+  std::copy(wire.begin(), wire.end(), chunk->begin());
+  auto received = make_shared<Data>(Block(chunk, chunk->begin(), chunk->begin() + wire.size()));
+  received->setTag(make_shared<lp::CongestionMarkTag>(1));
+  BOOST_CHECK_EQUAL(chunk.use_count(), 2);
+
+  cs.insert(*received);
+  BOOST_REQUIRE_EQUAL(cs.size(), 1);
+  received.reset();
+
+  // the cached Data does not keep the chunk alive
+  BOOST_CHECK_EQUAL(chunk.use_count(), 1);
+  const Data& cached = cs.begin()->getData();
+  BOOST_CHECK_EQUAL(cached.wireEncode().getBuffer()->size(), wire.size());
+  BOOST_CHECK_EQUAL(cached.wireEncode(), wire);
+  auto tag = cached.getTag<lp::CongestionMarkTag>();
+  BOOST_REQUIRE(tag != nullptr);
+  BOOST_CHECK_EQUAL(*tag, 1);
+
+  // a Data in a buffer of its own is stored without copying
+  cs.insert(*data);
+  BOOST_REQUIRE_EQUAL(cs.size(), 1);
+  auto other = makeData("/B");
+  cs.insert(*other);
+  BOOST_REQUIRE_EQUAL(cs.size(), 2);
+  BOOST_CHECK_EQUAL(other.use_count(), 2);
+}
+
 BOOST_AUTO_TEST_CASE(Enumeration)
 {
   Name nameA("/A");
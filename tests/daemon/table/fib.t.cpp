@@ -64,23 +64,23 @@ BOOST_AUTO_TEST_CASE(FibEntry)
   BOOST_CHECK_EQUAL(entry.getPrefix(), prefix);
 
   // []
-  BOOST_CHECK_EQUAL(entry.getNextHops().size(), 0);
+  BOOST_CHECK_EQUAL(entry.getNextHops()->size(), 0);
 
   expectedFace = face1.get();
   expectedCost = 20;
 
   fib.addOrUpdateNextHop(entry, *face1, 20);
   // [(face1,20)]
-  BOOST_CHECK_EQUAL(entry.getNextHops().size(), 1);
-  BOOST_CHECK_EQUAL(&entry.getNextHops().begin()->getFace(), face1.get());
-  BOOST_CHECK_EQUAL(entry.getNextHops().begin()->getCost(), 20);
+  BOOST_CHECK_EQUAL(entry.getNextHops()->size(), 1);
+  BOOST_CHECK_EQUAL(&entry.getNextHops()->begin()->getFace(), face1.get());
+  BOOST_CHECK_EQUAL(entry.getNextHops()->begin()->getCost(), 20);
   BOOST_CHECK_EQUAL(nNewNextHopSignals, 1);
 
   fib.addOrUpdateNextHop(entry, *face1, 30);
   // [(face1,30)]
-  BOOST_CHECK_EQUAL(entry.getNextHops().size(), 1);
-  BOOST_CHECK_EQUAL(&entry.getNextHops().begin()->getFace(), face1.get());
-  BOOST_CHECK_EQUAL(entry.getNextHops().begin()->getCost(), 30);
+  BOOST_CHECK_EQUAL(entry.getNextHops()->size(), 1);
+  BOOST_CHECK_EQUAL(&entry.getNextHops()->begin()->getFace(), face1.get());
+  BOOST_CHECK_EQUAL(entry.getNextHops()->begin()->getCost(), 30);
   BOOST_CHECK_EQUAL(nNewNextHopSignals, 1);
 
   expectedFace = face2.get();
@@ -88,40 +88,42 @@ BOOST_AUTO_TEST_CASE(FibEntry)
 
   fib.addOrUpdateNextHop(entry, *face2, 40);
   // [(face1,30), (face2,40)]
-  BOOST_CHECK_EQUAL(entry.getNextHops().size(), 2);
+  BOOST_CHECK_EQUAL(entry.getNextHops()->size(), 2);
   {
-    auto it = entry.getNextHops().begin();
-    BOOST_REQUIRE(it != entry.getNextHops().end());
+    auto nexthops = entry.getNextHops();
+    auto it = nexthops->begin();
+    BOOST_REQUIRE(it != nexthops->end());
     BOOST_CHECK_EQUAL(&it->getFace(), face1.get());
     BOOST_CHECK_EQUAL(it->getCost(), 30);
 
     ++it;
-    BOOST_REQUIRE(it != entry.getNextHops().end());
+    BOOST_REQUIRE(it != nexthops->end());
     BOOST_CHECK_EQUAL(&it->getFace(), face2.get());
     BOOST_CHECK_EQUAL(it->getCost(), 40);
 
     ++it;
-    BOOST_CHECK(it == entry.getNextHops().end());
+    BOOST_CHECK(it == nexthops->end());
 
     BOOST_CHECK_EQUAL(nNewNextHopSignals, 2);
   }
 
   fib.addOrUpdateNextHop(entry, *face2, 10);
   // [(face2,10), (face1,30)]
-  BOOST_CHECK_EQUAL(entry.getNextHops().size(), 2);
+  BOOST_CHECK_EQUAL(entry.getNextHops()->size(), 2);
   {
-    auto it = entry.getNextHops().begin();
-    BOOST_REQUIRE(it != entry.getNextHops().end());
+    auto nexthops = entry.getNextHops();
+    auto it = nexthops->begin();
+    BOOST_REQUIRE(it != nexthops->end());
     BOOST_CHECK_EQUAL(&it->getFace(), face2.get());
     BOOST_CHECK_EQUAL(it->getCost(), 10);
 
     ++it;
-    BOOST_REQUIRE(it != entry.getNextHops().end());
+    BOOST_REQUIRE(it != nexthops->end());
     BOOST_CHECK_EQUAL(&it->getFace(), face1.get());
     BOOST_CHECK_EQUAL(it->getCost(), 30);
 
     ++it;
-    BOOST_CHECK(it == entry.getNextHops().end());
+    BOOST_CHECK(it == nexthops->end());
 
     BOOST_CHECK_EQUAL(nNewNextHopSignals, 2);
   }
@@ -129,16 +131,16 @@ BOOST_AUTO_TEST_CASE(FibEntry)
   Fib::RemoveNextHopResult status = fib.removeNextHop(entry, *face1);
   // [(face2,10)]
   BOOST_CHECK(status == Fib::RemoveNextHopResult::NEXTHOP_REMOVED);
-  BOOST_CHECK_EQUAL(entry.getNextHops().size(), 1);
-  BOOST_CHECK_EQUAL(entry.getNextHops().begin()->getFace().getId(), face2->getId());
-  BOOST_CHECK_EQUAL(entry.getNextHops().begin()->getCost(), 10);
+  BOOST_CHECK_EQUAL(entry.getNextHops()->size(), 1);
+  BOOST_CHECK_EQUAL(entry.getNextHops()->begin()->getFace().getId(), face2->getId());
+  BOOST_CHECK_EQUAL(entry.getNextHops()->begin()->getCost(), 10);
 
   status = fib.removeNextHop(entry, *face1);
   // [(face2,10)]
   BOOST_CHECK(status == Fib::RemoveNextHopResult::NO_SUCH_NEXTHOP);
-  BOOST_CHECK_EQUAL(entry.getNextHops().size(), 1);
-  BOOST_CHECK_EQUAL(entry.getNextHops().begin()->getFace().getId(), face2->getId());
-  BOOST_CHECK_EQUAL(entry.getNextHops().begin()->getCost(), 10);
+  BOOST_CHECK_EQUAL(entry.getNextHops()->size(), 1);
+  BOOST_CHECK_EQUAL(entry.getNextHops()->begin()->getFace().getId(), face2->getId());
+  BOOST_CHECK_EQUAL(entry.getNextHops()->begin()->getCost(), 10);
 
   status = fib.removeNextHop(entry, *face2);
   // []
@@ -240,6 +242,36 @@ BOOST_AUTO_TEST_CASE(LongestPrefixMatchWithMeasurementsEntry)
   BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(mABCD).getPrefix(), "/A/B/C");
 }
 
+BOOST_AUTO_TEST_CASE(LongestPrefixMatchCacheInvalidation)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  Pit pit(nameTree);
+  shared_ptr<pit::Entry> pitABC = pit.insert(*makeInterest("/A/B/C")).first;
+
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).hasNextHops(), false);
+
+  fib.insert("/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/A");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/A");
+
+  fib.insert("/A/B");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/A/B");
+
+  fib.erase("/A/B");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/A");
+
+  // removing the last nexthop erases the entry
+  auto face1 = make_shared<DummyFace>();
+  Entry* entryA = fib.findExactMatch("/A");
+  fib.addOrUpdateNextHop(*entryA, *face1, 0);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getNextHops()->size(), 1);
+  fib.removeNextHop(*entryA, *face1);
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).getPrefix(), "/");
+  BOOST_CHECK_EQUAL(fib.findLongestPrefixMatch(*pitABC).hasNextHops(), false);
+}
+
 void
 validateFindExactMatch(Fib& fib, const Name& target)
 {
@@ -327,6 +359,99 @@ BOOST_AUTO_TEST_CASE(Erase)
   validateNoExactMatch(fib, "/");
 }
 
+BOOST_AUTO_TEST_CASE(FindEntriesByNextHop)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+
+  Entry* entryA = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entryA, *face1, 0);
+  fib.addOrUpdateNextHop(*entryA, *face2, 0);
+  Entry* entryB = fib.insert("/B").first;
+  fib.addOrUpdateNextHop(*entryB, *face1, 0);
+  fib.addOrUpdateNextHop(*entryB, *face1, 10);
+
+  auto byFace1 = fib.findEntriesByNextHop(*face1);
+  std::set<Entry*> entries(byFace1.begin(), byFace1.end());
+  BOOST_CHECK_EQUAL(byFace1.size(), 2);
+  BOOST_CHECK((entries == std::set<Entry*>{entryA, entryB}));
+  BOOST_CHECK((fib.findEntriesByNextHop(*face2) == std::vector<Entry*>{entryA}));
+
+  fib.removeNextHop(*entryA, *face1);
+  BOOST_CHECK((fib.findEntriesByNextHop(*face1) == std::vector<Entry*>{entryB}));
+
+  fib.erase(*entryA);
+  BOOST_CHECK(fib.findEntriesByNextHop(*face2).empty());
+
+  fib.removeNextHop(*entryB, *face1);
+  BOOST_CHECK(fib.findEntriesByNextHop(*face1).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Snapshot)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+
+  Entry* entryA = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entryA, *face1, 10);
+  Entry* entryB = fib.insert("/B").first;
+  fib.addOrUpdateNextHop(*entryB, *face2, 20);
+
+  auto snapshot = fib.takeSnapshot();
+  BOOST_REQUIRE_EQUAL(snapshot.size(), 2);
+  std::sort(snapshot.begin(), snapshot.end(),
+            [] (const auto& a, const auto& b) { return a.prefix < b.prefix; });
+  BOOST_CHECK_EQUAL(snapshot[0].prefix, "/A");
+  BOOST_CHECK_EQUAL(snapshot[0].nextHopsVersion, entryA->getNextHopsVersion());
+  // nexthop lists are shared, not copied
+  BOOST_CHECK_EQUAL(snapshot[0].nextHops.get(), entryA->getNextHops().get());
+
+  // modifications do not affect the snapshot
+  fib.addOrUpdateNextHop(*entryA, *face2, 5);
+  fib.removeNextHop(*entryB, *face2);
+  BOOST_CHECK_EQUAL(entryA->getNextHops()->size(), 2);
+  BOOST_CHECK_NE(snapshot[0].nextHopsVersion, entryA->getNextHopsVersion());
+  BOOST_REQUIRE_EQUAL(snapshot[0].nextHops->size(), 1);
+  BOOST_CHECK_EQUAL(&snapshot[0].nextHops->front().getFace(), face1.get());
+  BOOST_CHECK_EQUAL(snapshot[0].nextHops->front().getCost(), 10);
+  BOOST_CHECK_EQUAL(snapshot[1].prefix, "/B");
+  BOOST_REQUIRE_EQUAL(snapshot[1].nextHops->size(), 1);
+  BOOST_CHECK_EQUAL(snapshot[1].nextHops->front().getCost(), 20);
+}
+
+BOOST_AUTO_TEST_CASE(HeldNextHops)
+{
+  NameTree nameTree;
+  Fib fib(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto face3 = make_shared<DummyFace>();
+
+  Entry* entry = fib.insert("/A").first;
+  fib.addOrUpdateNextHop(*entry, *face1, 10);
+
+  // a list held by a caller is not modified
+  auto held = entry->getNextHops();
+  fib.addOrUpdateNextHop(*entry, *face2, 5);
+  fib.removeNextHop(*entry, *face1);
+  BOOST_REQUIRE_EQUAL(held->size(), 1);
+  BOOST_CHECK_EQUAL(&held->front().getFace(), face1.get());
+  BOOST_CHECK_NE(held.get(), entry->getNextHops().get());
+
+  // a list that is not shared is modified in place
+  held.reset();
+  const NextHopList* current = entry->getNextHops().get();
+  fib.addOrUpdateNextHop(*entry, *face3, 7);
+  fib.removeNextHop(*entry, *face2);
+  BOOST_CHECK_EQUAL(entry->getNextHops().get(), current);
+  BOOST_REQUIRE_EQUAL(entry->getNextHops()->size(), 1);
+  BOOST_CHECK_EQUAL(&entry->getNextHops()->front().getFace(), face3.get());
+}
+
 BOOST_AUTO_TEST_CASE(EraseGap)
 {
   NameTree nameTree;
@@ -206,6 +206,59 @@ BOOST_DATA_TEST_CASE(Lifetime, bdata::make(lifetimes), lifetime)
   BOOST_CHECK_LT(time::abs(expiryFromNow - expectedLifetime), 100_ms);
 }
 
+BOOST_AUTO_TEST_CASE(ManyInRecords)
+{
+  const size_t nFaces = Entry::IN_RECORD_INDEX_THRESHOLD * 2;
+  std::vector<shared_ptr<DummyFace>> faces;
+  for (size_t i = 0; i < nFaces; ++i) {
+    faces.push_back(make_shared<DummyFace>());
+  }
+
+  auto interest = makeInterest("/BZd5dFjK");
+  Entry entry(*interest);
+  for (size_t i = 0; i < nFaces; ++i) {
+    // Nonces 0 and 1 alternate
+    interest->setNonce(static_cast<uint32_t>(i % 2));
+    entry.insertOrUpdateInRecord(*faces[i], *interest);
+  }
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), nFaces);
+  BOOST_CHECK_EQUAL(entry.countInRecordsWithNonce(0), nFaces / 2);
+  BOOST_CHECK_EQUAL(entry.countInRecordsWithNonce(1), nFaces / 2);
+  BOOST_CHECK_EQUAL(entry.countInRecordsWithNonce(2), 0);
+
+  for (size_t i = 0; i < nFaces; ++i) {
+    auto inRecord = entry.getInRecord(*faces[i]);
+    BOOST_REQUIRE(inRecord != entry.in_end());
+    BOOST_CHECK_EQUAL(&inRecord->getFace(), faces[i].get());
+  }
+
+  // updating an in-record moves it to its new Nonce
+  interest->setNonce(2);
+  entry.insertOrUpdateInRecord(*faces[0], *interest);
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), nFaces);
+  BOOST_CHECK_EQUAL(entry.countInRecordsWithNonce(0), nFaces / 2 - 1);
+  BOOST_CHECK_EQUAL(entry.countInRecordsWithNonce(2), 1);
+
+  entry.deleteInRecord(*faces[0]);
+  entry.deleteInRecord(*faces[1]);
+  entry.deleteInRecord(*faces[1]);
+  BOOST_CHECK_EQUAL(entry.getInRecords().size(), nFaces - 2);
+  BOOST_CHECK(entry.getInRecord(*faces[0]) == entry.in_end());
+  BOOST_CHECK(entry.getInRecord(*faces[1]) == entry.in_end());
+  BOOST_CHECK(entry.getInRecord(*faces[2]) != entry.in_end());
+  BOOST_CHECK_EQUAL(entry.countInRecordsWithNonce(1), nFaces / 2 - 1);
+  BOOST_CHECK_EQUAL(entry.countInRecordsWithNonce(2), 0);
+
+  entry.clearInRecords();
+  BOOST_CHECK(entry.getInRecord(*faces[2]) == entry.in_end());
+  BOOST_CHECK_EQUAL(entry.countInRecordsWithNonce(0), 0);
+
+  interest->setNonce(0);
+  entry.insertOrUpdateInRecord(*faces[2], *interest);
+  BOOST_CHECK(entry.getInRecord(*faces[2]) != entry.in_end());
+  BOOST_CHECK_EQUAL(entry.countInRecordsWithNonce(0), 1);
+}
+
 BOOST_AUTO_TEST_CASE(OutRecordNack)
 {
   auto face1 = make_shared<DummyFace>();
@@ -27,6 +27,7 @@
 
 #include "tests/test-common.hpp"
 #include "tests/daemon/global-io-fixture.hpp"
+#include "tests/daemon/face/dummy-face.hpp"
 
 namespace nfd::tests {
 
@@ -158,6 +159,69 @@ BOOST_AUTO_TEST_CASE(EraseNameTreeEntry)
   BOOST_CHECK_EQUAL(nameTree.size(), nNameTreeEntriesBefore);
 }
 
+BOOST_AUTO_TEST_CASE(FindEntriesByFace)
+{
+  NameTree nameTree;
+  Pit pit(nameTree);
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+
+  auto interestA = makeInterest("/A");
+  auto entryA = pit.insert(*interestA).first;
+  entryA->insertOrUpdateInRecord(*face1, *interestA);
+  entryA->insertOrUpdateOutRecord(*face1, *interestA);
+  entryA->insertOrUpdateOutRecord(*face2, *interestA);
+  auto interestB = makeInterest("/B");
+  auto entryB = pit.insert(*interestB).first;
+  entryB->insertOrUpdateInRecord(*face2, *interestB);
+
+  BOOST_CHECK((pit.findEntriesByFace(*face1) == std::vector<Entry*>{entryA.get()}));
+  BOOST_CHECK_EQUAL(pit.findEntriesByFace(*face2).size(), 2);
+
+  // entry stays indexed while it has any record for the face
+  entryA->deleteOutRecord(*face1);
+  BOOST_CHECK((pit.findEntriesByFace(*face1) == std::vector<Entry*>{entryA.get()}));
+  entryA->clearInRecords();
+  BOOST_CHECK(pit.findEntriesByFace(*face1).empty());
+
+  pit.deleteInOutRecords(entryB.get(), *face2);
+  BOOST_CHECK((pit.findEntriesByFace(*face2) == std::vector<Entry*>{entryA.get()}));
+
+  // erased entry is no longer indexed, even if it is modified afterwards
+  pit.erase(entryA.get());
+  BOOST_CHECK(pit.findEntriesByFace(*face2).empty());
+  entryA->insertOrUpdateInRecord(*face1, *interestA);
+  BOOST_CHECK(pit.findEntriesByFace(*face1).empty());
+}
+
+BOOST_AUTO_TEST_CASE(DeleteInOutRecordsByFace)
+{
+  NameTree nameTree;
+  auto face1 = make_shared<DummyFace>();
+  auto face2 = make_shared<DummyFace>();
+  auto interest = makeInterest("/A");
+  shared_ptr<Entry> entry;
+
+  {
+    Pit pit(nameTree);
+    entry = pit.insert(*interest).first;
+    entry->insertOrUpdateInRecord(*face1, *interest);
+    entry->insertOrUpdateOutRecord(*face1, *interest);
+    entry->insertOrUpdateOutRecord(*face2, *interest);
+
+    pit.deleteInOutRecords(*face1);
+    BOOST_CHECK(!entry->hasInRecords());
+    BOOST_CHECK_EQUAL(entry->getOutRecords().size(), 1);
+    BOOST_CHECK(pit.findEntriesByFace(*face1).empty());
+    BOOST_CHECK((pit.findEntriesByFace(*face2) == std::vector<Entry*>{entry.get()}));
+  }
+
+  // the records outlive the index
+  BOOST_CHECK(entry->getOutRecord(*face2) != entry->out_end());
+  entry->deleteOutRecord(*face2);
+  BOOST_CHECK(!entry->hasOutRecords());
+}
+
 BOOST_AUTO_TEST_CASE(EraseWithFullName)
 {
   auto data = makeData("/test");
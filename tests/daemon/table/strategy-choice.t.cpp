@@ -252,6 +252,35 @@ BOOST_AUTO_TEST_CASE(FindEffectiveStrategyWithMeasurementsEntry)
   BOOST_CHECK_EQUAL(this->findInstanceName(mABCD), strategyNameQ);
 }
 
+BOOST_AUTO_TEST_CASE(FindEffectiveStrategyCacheInvalidation)
+{
+  BOOST_CHECK(sc.insert("/", strategyNameP));
+
+  Pit& pit = forwarder.getPit();
+  shared_ptr<pit::Entry> pitABC = pit.insert(*makeInterest("/A/B/C")).first;
+  measurements::Entry& mAB = forwarder.getMeasurements().get("/A/B");
+
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName("/A/B/C"), strategyNameP);
+
+  BOOST_CHECK(sc.insert("/A", strategyNameQ));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameQ);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameQ);
+  BOOST_CHECK_EQUAL(this->findInstanceName("/A/B/C"), strategyNameQ);
+
+  // changing the strategy of an existing entry replaces the Strategy instance
+  Name instanceQ1 = Name(strategyNameQ).append("param");
+  BOOST_CHECK(sc.insert("/A", instanceQ1));
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), instanceQ1);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), instanceQ1);
+
+  sc.erase("/A");
+  BOOST_CHECK_EQUAL(this->findInstanceName(*pitABC), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName(mAB), strategyNameP);
+  BOOST_CHECK_EQUAL(this->findInstanceName("/A/B/C"), strategyNameP);
+}
+
 BOOST_AUTO_TEST_CASE(Erase)
 {
   NameTree& nameTree = forwarder.getNameTree();
@@ -76,6 +76,29 @@ public:
   int m_id;
 };
 
+class LargeStrategyInfo : public StrategyInfo, noncopyable
+{
+public:
+  static constexpr int
+  getTypeId()
+  {
+    return 3;
+  }
+
+  LargeStrategyInfo()
+  {
+    ++g_DummyStrategyInfo_count;
+  }
+
+  ~LargeStrategyInfo() override
+  {
+    --g_DummyStrategyInfo_count;
+  }
+
+public:
+  std::array<uint64_t, 8> m_data{};
+};
+
 BOOST_AUTO_TEST_SUITE(Table)
 BOOST_FIXTURE_TEST_SUITE(TestStrategyInfoHost, GlobalIoFixture)
 
@@ -127,6 +150,48 @@ BOOST_AUTO_TEST_CASE(Types)
   BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfo>(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(InlineAndOverflow)
+{
+  static_assert(sizeof(DummyStrategyInfo) <= StrategyInfoHost::INLINE_SIZE);
+  static_assert(sizeof(LargeStrategyInfo) > StrategyInfoHost::INLINE_SIZE);
+  g_DummyStrategyInfo_count = 0;
+
+  {
+    StrategyInfoHost host;
+    auto* large = host.insertStrategyInfo<LargeStrategyInfo>().first;
+    auto* info1 = host.insertStrategyInfo<DummyStrategyInfo>(1).first;
+    auto* info2 = host.insertStrategyInfo<DummyStrategyInfo2>(2).first;
+    BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 2);
+
+    // the first small item is stored within the host, other items are not
+    auto isInside = [&host] (const void* p) {
+      auto begin = reinterpret_cast<const unsigned char*>(&host);
+      auto ptr = reinterpret_cast<const unsigned char*>(p);
+      return ptr >= begin && ptr < begin + sizeof(host);
+    };
+    BOOST_CHECK(!isInside(large));
+    BOOST_CHECK(isInside(info1));
+    BOOST_CHECK(!isInside(info2));
+
+    // the inline slot is reused after erasing
+    BOOST_CHECK_EQUAL(host.eraseStrategyInfo<DummyStrategyInfo>(), 1);
+    BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
+    info1 = host.insertStrategyInfo<DummyStrategyInfo>(3).first;
+    BOOST_CHECK(isInside(info1));
+    BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo>()->m_id, 3);
+    BOOST_CHECK_EQUAL(host.getStrategyInfo<DummyStrategyInfo2>()->m_id, 2);
+    BOOST_CHECK_EQUAL(host.getStrategyInfo<LargeStrategyInfo>(), large);
+
+    BOOST_CHECK_EQUAL(host.eraseStrategyInfo<LargeStrategyInfo>(), 1);
+    BOOST_CHECK(host.getStrategyInfo<LargeStrategyInfo>() == nullptr);
+    BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 1);
+    host.insertStrategyInfo<LargeStrategyInfo>();
+    BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 2);
+  }
+  // items are destroyed with the host
+  BOOST_CHECK_EQUAL(g_DummyStrategyInfo_count, 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestStrategyInfoHost
 BOOST_AUTO_TEST_SUITE_END() // Table
 
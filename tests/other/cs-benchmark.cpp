@@ -209,4 +209,34 @@ BOOST_FIXTURE_TEST_CASE(FindCanBePrefixHit, CsBenchmarkFixture)
   std::cout << "find(CanBePrefix-hit) " << (N_INTERESTS * N_CHILDREN * REPEAT) << ": " << d << std::endl;
 }
 
+// find, then insert on miss, under each admission policy
+BOOST_FIXTURE_TEST_CASE(FindInsertAdmission, CsBenchmarkFixture)
+{
+  constexpr size_t N_WORKLOAD = CS_CAPACITY * 2;
+  constexpr size_t REPEAT = 4;
+
+  auto interestWorkload = makeInterestWorkload(N_WORKLOAD);
+  auto dataWorkload = makeDataWorkload(N_WORKLOAD);
+
+  for (const auto& policyName : cs::AdmissionPolicy::getPolicyNames()) {
+    Cs store;
+    store.setLimit(CS_CAPACITY);
+    store.setAdmissionPolicy(cs::AdmissionPolicy::create(policyName));
+
+    size_t nHits = 0;
+    time::microseconds d = timedRun([&] {
+      for (size_t j = 0; j < REPEAT; ++j) {
+        for (size_t i = 0; i < N_WORKLOAD; ++i) {
+          store.find(*interestWorkload[i],
+                     [&] (auto&&...) { ++nHits; },
+                     [&] (auto&&...) { store.insert(*dataWorkload[i], false); });
+        }
+      }
+    });
+
+    std::cout << "find-insert(" << policyName << ") " << (N_WORKLOAD * REPEAT) << ": " << d
+              << " hits=" << nHits << std::endl;
+  }
+}
+
 } // namespace nfd::tests
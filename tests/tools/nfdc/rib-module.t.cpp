@@ -24,10 +24,14 @@
  */
 
 #include "nfdc/rib-module.hpp"
+#include "core/control-parameters-list.hpp"
 
 #include "execute-command-fixture.hpp"
 #include "status-fixture.hpp"
 
+#include <cstdio>
+#include <fstream>
+
 namespace nfd::tools::nfdc::tests {
 
 BOOST_AUTO_TEST_SUITE(Nfdc)
@@ -513,6 +517,93 @@ BOOST_AUTO_TEST_CASE(ErrorCommand)
 
 BOOST_AUTO_TEST_SUITE_END() // RemoveCommand
 
+class RouteLoadFixture : public ExecuteCommandFixture
+{
+protected:
+  void
+  writeRouteFile(const std::string& content)
+  {
+    std::ofstream file(filename);
+    file << content;
+  }
+
+  ~RouteLoadFixture()
+  {
+    std::remove(filename.data());
+  }
+
+protected:
+  const std::string filename = "nfdc-route-load.t.txt";
+};
+
+BOOST_FIXTURE_TEST_SUITE(LoadCommand, RouteLoadFixture)
+
+BOOST_AUTO_TEST_CASE(Normal)
+{
+  writeRouteFile("# comment\n"
+                 "/vxXoEaWeDB 10156\n"
+                 "\n"
+                 "  /FLQAsaYnYf 2249 702  \n");
+
+  this->processInterest = [this] (const Interest& interest) {
+    const Name commandPrefix("/localhost/nfd/rib/register-batch");
+    BOOST_REQUIRE(commandPrefix.isPrefixOf(interest.getName()));
+    ControlParametersList req(interest.getName().at(commandPrefix.size()).blockFromValue());
+    BOOST_REQUIRE_EQUAL(req.getItems().size(), 2);
+
+    const auto& first = req.getItems().front();
+    BOOST_CHECK_EQUAL(first.getName(), "/vxXoEaWeDB");
+    BOOST_CHECK_EQUAL(first.getFaceId(), 10156);
+    BOOST_CHECK_EQUAL(first.getOrigin(), 17591);
+    BOOST_CHECK_EQUAL(first.getCost(), 0);
+    BOOST_CHECK_EQUAL(first.getFlags(), ndn::nfd::ROUTE_FLAG_CAPTURE);
+    BOOST_CHECK_EQUAL(first.hasExpirationPeriod(), false);
+
+    const auto& second = req.getItems().back();
+    BOOST_CHECK_EQUAL(second.getName(), "/FLQAsaYnYf");
+    BOOST_CHECK_EQUAL(second.getFaceId(), 2249);
+    BOOST_CHECK_EQUAL(second.getCost(), 702);
+
+    this->sendCommandReply(interest, 200, "OK", req.wireEncode());
+  };
+
+  this->execute("route load " + filename + " origin 17591 no-inherit capture");
+  BOOST_CHECK_EQUAL(exitCode, 0);
+  BOOST_CHECK(out.is_equal("route-load-accepted routes=2 commands=1\n"));
+  BOOST_CHECK(err.is_empty());
+}
+
+BOOST_AUTO_TEST_CASE(ErrorCommand)
+{
+  writeRouteFile("/vxXoEaWeDB 10156\n");
+
+  this->processInterest = [this] (const Interest& interest) {
+    this->failCommand(interest, 403, "not authorized");
+  };
+
+  this->execute("route load " + filename);
+  BOOST_CHECK_EQUAL(exitCode, 1);
+  BOOST_CHECK(out.is_empty());
+  BOOST_CHECK(err.is_equal("Error 403 when loading routes: not authorized\n"));
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  writeRouteFile("/vxXoEaWeDB 10156\n"
+                 "/FLQAsaYnYf tcp4://32.121.182.82:6363\n");
+
+  this->processInterest = [] (const Interest&) {
+    BOOST_ERROR("unexpected command");
+  };
+
+  this->execute("route load " + filename);
+  BOOST_CHECK_EQUAL(exitCode, 2);
+  BOOST_CHECK(out.is_empty());
+  BOOST_CHECK(err.is_equal(filename + ":2: expecting <PREFIX> <FACEID> [<COST>]\n"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // LoadCommand
+
 const std::string STATUS_XML = stripXmlSpaces(R"XML(
   <rib>
     <ribEntry>
@@ -27,6 +27,12 @@
 #include "face-module.hpp"
 #include "face-helpers.hpp"
 #include "format-helpers.hpp"
+#include "core/control-parameters-list.hpp"
+
+#include <ndn-cxx/security/interest-signer.hpp>
+
+#include <fstream>
+#include <sstream>
 
 namespace nfd::tools::nfdc {
 
@@ -66,6 +72,16 @@ RibModule::registerCommands(CommandParser& parser)
     .addArg("nexthop", ArgValueType::FACE_ID_OR_URI, Required::YES, Positional::YES)
     .addArg("origin", ArgValueType::ROUTE_ORIGIN, Required::NO, Positional::NO);
   parser.addCommand(defRouteRemove, &RibModule::remove);
+
+  CommandDefinition defRouteLoad("route", "load");
+  defRouteLoad
+    .setTitle("add routes listed in a file")
+    .addArg("file", ArgValueType::STRING, Required::YES, Positional::YES)
+    .addArg("origin", ArgValueType::ROUTE_ORIGIN, Required::NO, Positional::NO)
+    .addArg("no-inherit", ArgValueType::NONE, Required::NO, Positional::NO)
+    .addArg("capture", ArgValueType::NONE, Required::NO, Positional::NO)
+    .addArg("expires", ArgValueType::UNSIGNED, Required::NO, Positional::NO);
+  parser.addCommand(defRouteLoad, &RibModule::load);
 }
 
 void
@@ -407,4 +423,126 @@ RibModule::formatRouteText(std::ostream& os, const RibEntry& entry, const Route&
   }
 }
 
+/** \brief Maximum encoded size of the routes sent in one rib/register-batch command,
+ *         leaving room for the rest of the signed Interest.
+ */
+constexpr size_t MAX_BATCH_SIZE = 7000;
+
+void
+RibModule::load(ExecuteContext& ctx)
+{
+  auto filename = ctx.args.get<std::string>("file");
+  auto origin = ctx.args.get<RouteOrigin>("origin", ndn::nfd::ROUTE_ORIGIN_STATIC);
+  bool wantChildInherit = !ctx.args.get<bool>("no-inherit", false);
+  bool wantCapture = ctx.args.get<bool>("capture", false);
+  auto expiresMillis = ctx.args.getOptional<uint64_t>("expires");
+
+  std::ifstream file(filename);
+  if (!file) {
+    ctx.exitCode = 1;
+    ctx.err << "Cannot open " << filename << '\n';
+    return;
+  }
+
+  // split the routes into batches that each fit in one command Interest
+  std::vector<ControlParametersList> batches(1);
+  size_t batchSize = 0;
+  size_t nRoutes = 0;
+  std::string line;
+  for (size_t lineNo = 1; std::getline(file, line); ++lineNo) {
+    std::istringstream is(line);
+    std::string prefix;
+    if (!(is >> prefix) || prefix.front() == '#') {
+      continue;
+    }
+
+    uint64_t faceId = 0;
+    uint64_t cost = 0;
+    bool isValid = static_cast<bool>(is >> faceId);
+    if (isValid && !(is >> std::ws).eof()) {
+      isValid = (is >> cost) && (is >> std::ws).eof();
+    }
+    if (!isValid) {
+      ctx.exitCode = 2;
+      ctx.err << filename << ":" << lineNo << ": expecting <PREFIX> <FACEID> [<COST>]\n";
+      return;
+    }
+
+    ControlParameters params;
+    try {
+      params.setName(Name(prefix));
+    }
+    catch (const Name::Error&) {
+      ctx.exitCode = 2;
+      ctx.err << filename << ":" << lineNo << ": invalid prefix " << prefix << '\n';
+      return;
+    }
+    params
+      .setFaceId(faceId)
+      .setOrigin(origin)
+      .setCost(cost)
+      .setFlags((wantChildInherit ? ndn::nfd::ROUTE_FLAG_CHILD_INHERIT : ndn::nfd::ROUTE_FLAGS_NONE) |
+                (wantCapture ? ndn::nfd::ROUTE_FLAG_CAPTURE : ndn::nfd::ROUTE_FLAGS_NONE));
+    if (expiresMillis) {
+      params.setExpirationPeriod(time::milliseconds(*expiresMillis));
+    }
+
+    size_t itemSize = params.wireEncode().size();
+    if (batchSize + itemSize > MAX_BATCH_SIZE && batchSize > 0) {
+      batches.emplace_back();
+      batchSize = 0;
+    }
+    batches.back().addItem(params);
+    batchSize += itemSize;
+    ++nRoutes;
+  }
+
+  if (nRoutes == 0) {
+    ctx.exitCode = 2;
+    ctx.err << filename << ": no route found\n";
+    return;
+  }
+
+  auto options = ctx.makeCommandOptions();
+  ndn::security::InterestSigner signer(ctx.keyChain);
+  size_t nAccepted = 0;
+  auto onFailure = ctx.makeCommandFailureHandler("loading routes");
+
+  for (const auto& batch : batches) {
+    Name commandName = options.getPrefix();
+    commandName.append("rib").append("register-batch")
+               .append(tlv::GenericNameComponent, batch.wireEncode());
+    Interest interest = signer.makeCommandInterest(commandName, options.getSigningInfo());
+    interest.setInterestLifetime(options.getTimeout());
+
+    ctx.face.expressInterest(interest,
+      [&, nItems = batch.getItems().size()] (const Interest&, const Data& data) {
+        ControlResponse resp;
+        try {
+          resp.wireDecode(data.getContent().blockFromValue());
+        }
+        catch (const tlv::Error& e) {
+          return onFailure(ControlResponse(Controller::ERROR_SERVER, e.what()));
+        }
+        if (resp.getCode() != 200) {
+          return onFailure(resp);
+        }
+        nAccepted += nItems;
+      },
+      [&] (const Interest&, const lp::Nack&) {
+        onFailure(ControlResponse(Controller::ERROR_NACK, "network Nack received"));
+      },
+      [&] (const Interest&) {
+        onFailure(ControlResponse(Controller::ERROR_TIMEOUT, "request timed out"));
+      });
+  }
+
+  ctx.face.processEvents();
+
+  if (nAccepted == nRoutes) {
+    text::ItemAttributes ia;
+    ctx.out << "route-load-accepted " << ia("routes") << nRoutes << ia("commands") << batches.size() << '\n';
+  }
+}
+
 } // namespace nfd::tools::nfdc
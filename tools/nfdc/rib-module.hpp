@@ -40,7 +40,7 @@ using ndn::nfd::Route;
 class RibModule : public Module, noncopyable
 {
 public:
-  /** \brief Register 'route list', 'route show', 'route add', 'route remove' commands.
+  /** \brief Register 'route list', 'route show', 'route add', 'route remove', 'route load' commands.
    */
   static void
   registerCommands(CommandParser& parser);
@@ -65,6 +65,14 @@ public:
   static void
   remove(ExecuteContext& ctx);
 
+  /** \brief The 'route load' command.
+   *
+   *  Registers the routes listed in a file with rib/register-batch commands, each carrying
+   *  as many routes as fit in one command Interest.
+   */
+  static void
+  load(ExecuteContext& ctx);
+
   void
   fetchStatus(Controller& controller,
               const std::function<void()>& onSuccess,